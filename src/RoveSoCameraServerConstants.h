@@ -12,6 +12,7 @@
 #define ROVESOCAMERASERVERCONSTANTS_H
 
 #include "./interfaces/Camera.hpp"
+#include "./util/ThreadScheduling.hpp"
 
 /// \cond
 #include <opencv2/opencv.hpp>
@@ -38,6 +39,8 @@ namespace constants
     const quill::LogLevel CONSOLE_MIN_LEVEL        = quill::LogLevel::TraceL3;    // The minimum logging level that is allowed to send to the console log stream.
     const quill::LogLevel FILE_MIN_LEVEL           = quill::LogLevel::TraceL3;    // The minimum logging level that is allowed to send to the file log streams.
     const quill::LogLevel ROVECOMM_MIN_LEVEL       = quill::LogLevel::Info;       // The minimum logging level that is allowed to send to the RoveComm log stream.
+    const THREAD_PRIORITIES LOGGING_PRIORITY       = THREAD_PRIORITIES::eBackground;    // The priority class of the thread that writes out logs.
+    const uint64_t LOGGING_CPU_AFFINITY            = 0;                                 // A bit for each CPU the logging thread may run on. 0 allows any CPU.
     const quill::LogLevel CONSOLE_DEFAULT_LEVEL    = quill::LogLevel::TraceL3;    // The default logging level for console stream.
     const quill::LogLevel FILE_DEFAULT_LEVEL       = quill::LogLevel::TraceL3;    // The default logging level for file streams.
     const quill::LogLevel ROVECOMM_DEFAULT_LEVEL   = quill::LogLevel::Info;       // The default logging level for RoveComm stream.
@@ -65,7 +68,55 @@ namespace constants
     ///////////////////////////////////////////////////////////////////////////
 
     // Recording adjustments.
-    const int RECORDER_FPS = 15;    // The FPS all recordings should run at.
+    const int RECORDER_FPS               = 15;      // The max FPS frames are sampled at for recordings. Frames keep their capture time, so playback speed never depends on this.
+    const int RECORDER_MAX_QUEUED_FRAMES = 3;       // The max number of frames each camera recorder can have waiting to be written before new ones are dropped.
+    const int RECORDER_STOP_COPY_TIMEOUT = 1000;    // How long in milliseconds a camera recorder being destroyed waits for the frame copies it still has queued.
+    // Recording encoder defaults. Each camera can be changed with RecordingHandler::SetEncoderSettings().
+    const std::string RECORDER_CODEC   = "libx264";     // The libavcodec encoder used for recordings.
+    const std::string RECORDER_PRESET  = "veryfast";    // The encoder speed preset. Faster presets use less CPU for bigger files.
+    const int RECORDER_CRF             = 23;            // The constant rate factor. Lower is better quality. Only used if RECORDER_BITRATE is 0.
+    const int64_t RECORDER_BITRATE     = 0;             // The target bitrate in bits per second. 0 uses RECORDER_CRF instead.
+    const int RECORDER_ENCODER_THREADS = 2;             // The number of threads each recording encoder may use.
+    const int RECORDER_GOP_SIZE        = 30;            // The max number of frames between keyframes in a recording.
+    // Recording segments and retention.
+    const int RECORDER_SEGMENT_DURATION         = 60;       // The length in seconds of each recording file. A new file is started on the next keyframe after this. 0 disables.
+    const int RECORDER_SEGMENT_MAX_SIZE         = 256;      // The size in megabytes of each recording file. A new file is started on the next keyframe after this. 0 disables.
+    const int64_t RECORDER_DISK_BUDGET          = 32768;    // The max megabytes of camera recordings to keep on disk. The oldest segments are deleted first. 0 disables.
+    const int RECORDER_RETENTION_CHECK_INTERVAL = 10;       // How often in seconds to check the recordings against the disk budget.
+    // Recording disk writes.
+    const bool RECORDER_ENABLE_ASYNC_WRITER      = true;       // Whether recordings are written to disk by a separate thread so encoding never waits on storage.
+    const size_t RECORDER_WRITE_BUFFER_SIZE      = 1048576;    // The size in bytes of each recording write buffer.
+    const size_t RECORDER_WRITE_BUFFER_COUNT     = 16;         // The max number of write buffers each recording can have waiting for storage.
+    const int RECORDER_FSYNC_INTERVAL            = 5000;       // How often in milliseconds recordings are synced to storage. 0 syncs every buffer, -1 leaves it to the OS.
+    const int RECORDER_WRITE_STATISTICS_INTERVAL = 60;         // How often in seconds to log recording disk write statistics.
+    // Recording instant replay.
+    const bool RECORDER_ENABLE_REPLAY_BUFFER = true;    // Whether each recorder keeps its most recent packets in memory so events can be saved after they happen.
+    const bool RECORDER_CONTINUOUS_RECORDING = true;    // Whether recordings are written to disk all the time. If false, only triggered replays are saved.
+    const int RECORDER_REPLAY_HISTORY        = 30;      // The number of seconds before a trigger that each replay buffer keeps.
+    const int RECORDER_REPLAY_POST_EVENT     = 30;      // The number of seconds after a trigger that are saved with the replay.
+    const int RECORDER_REPLAY_MAX_SIZE       = 64;      // The max megabytes of packets each replay buffer can hold. Older GOPs are dropped first.
+    // Recording black box.
+    const bool RECORDER_ENABLE_BLACKBOX            = false;    // Whether each recorder also stores its packets in a memory mapped ring file that survives a crash.
+    const int RECORDER_BLACKBOX_SIZE               = 64;       // The size in megabytes of each black box ring file's packet data.
+    const uint32_t RECORDER_BLACKBOX_INDEX_ENTRIES = 8192;     // The max number of packets each black box ring file can hold.
+    const int RECORDER_BLACKBOX_SYNC_INTERVAL      = 5;        // How often in seconds the black box is written to storage. Only limits loss on power failure. 0 leaves it to the OS.
+    // Recording frame index.
+    const bool RECORDER_ENABLE_FRAME_INDEX = true;    // Whether each recording file gets a .idx file with the capture time and position of every frame.
+    // Recording thread scheduling.
+    const THREAD_PRIORITIES RECORDER_PRIORITY = THREAD_PRIORITIES::eBackground;    // The priority class of the recording threads. Recording falls behind first when the CPU is saturated.
+    const uint64_t RECORDER_CPU_AFFINITY      = 0;                                 // A bit for each CPU the recording threads may run on. 0 allows any CPU.
+    // Recording background re-encoding. Shrinks finished segments with a slower preset so they are faster to pull off the rover.
+    const bool RECORDER_ENABLE_TRANSCODER            = false;       // Whether finished segments are re-encoded smaller in the background while the CPU is idle. Replaces the originals.
+    const double RECORDER_TRANSCODE_MAX_CPU_LOAD     = 0.3;         // The CPU load, from 0 to 1, above which re-encoding pauses. The re-encoding itself isn't counted.
+    const int RECORDER_TRANSCODE_IDLE_TIME           = 30;          // How many seconds the CPU load must stay under the max before re-encoding starts or resumes.
+    const int RECORDER_TRANSCODE_LOAD_CHECK_INTERVAL = 250;         // How often in milliseconds the CPU load is checked while re-encoding.
+    const int RECORDER_TRANSCODE_MIN_AGE             = 30;          // How many seconds a segment must go unchanged before it can be re-encoded.
+    const std::string RECORDER_TRANSCODE_PRESET      = "slower";    // The encoder speed preset for re-encoding. Slower presets make smaller files.
+    const int RECORDER_TRANSCODE_CRF                 = 28;          // The constant rate factor for re-encoding. Only used if RECORDER_TRANSCODE_BITRATE is 0.
+    const int64_t RECORDER_TRANSCODE_BITRATE         = 0;           // The target bitrate for re-encoding in bits per second. 0 uses RECORDER_TRANSCODE_CRF instead.
+    // Recording background re-encoding thread scheduling.
+    const THREAD_PRIORITIES RECORDER_TRANSCODE_PRIORITY = THREAD_PRIORITIES::eBackground;    // The priority class of the re-encoding thread.
+    const uint64_t RECORDER_TRANSCODE_CPU_AFFINITY      = 0;                                 // A bit for each CPU the re-encoding thread may run on. 0 allows any CPU.
     // Camera recording toggles.
     const bool BASICCAM_DRIVECAMLEFT_ENABLE_RECORDING   = true;    // Whether or not to record the left drive camera.
     const bool BASICCAM_DRIVECAMRIGHT_ENABLE_RECORDING  = true;    // Whether or not to record the right drive camera.
@@ -77,6 +128,18 @@ namespace constants
     const bool BASICCAM_AUXCAM3_ENABLE_RECORDING        = true;    // Whether or not to record the third auxiliary camera.
     const bool BASICCAM_AUXCAM4_ENABLE_RECORDING        = true;    // Whether or not to record the fourth auxiliary camera.
     const bool BASICCAM_MICROSCOPE_ENABLE_RECORDING     = true;    // Whether or not to record the microscope camera.
+    // Camera group recording. The cameras in the group are recorded into one file, with a track per camera on a shared timeline.
+    const bool RECORDER_ENABLE_CAMERA_GROUP            = false;    // Whether the cameras below are recorded as a group instead of a file each.
+    const bool BASICCAM_DRIVECAMLEFT_RECORD_IN_GROUP   = true;     // Whether the left drive camera is in the recording group.
+    const bool BASICCAM_DRIVECAMRIGHT_RECORD_IN_GROUP  = true;     // Whether the right drive camera is in the recording group.
+    const bool BASICCAM_GIMBALCAMLEFT_RECORD_IN_GROUP  = false;    // Whether the left gimbal camera is in the recording group.
+    const bool BASICCAM_GIMBALCAMRIGHT_RECORD_IN_GROUP = false;    // Whether the right gimbal camera is in the recording group.
+    const bool BASICCAM_BACKCAM_RECORD_IN_GROUP        = true;     // Whether the back camera is in the recording group.
+    const bool BASICCAM_AUXCAM1_RECORD_IN_GROUP        = false;    // Whether the first auxiliary camera is in the recording group.
+    const bool BASICCAM_AUXCAM2_RECORD_IN_GROUP        = false;    // Whether the second auxiliary camera is in the recording group.
+    const bool BASICCAM_AUXCAM3_RECORD_IN_GROUP        = false;    // Whether the third auxiliary camera is in the recording group.
+    const bool BASICCAM_AUXCAM4_RECORD_IN_GROUP        = false;    // Whether the fourth auxiliary camera is in the recording group.
+    const bool BASICCAM_MICROSCOPE_RECORD_IN_GROUP     = false;    // Whether the microscope camera is in the recording group.
     ///////////////////////////////////////////////////////////////////////////
 
     ///////////////////////////////////////////////////////////////////////////
@@ -84,7 +147,22 @@ namespace constants
     ///////////////////////////////////////////////////////////////////////////
 
     // BasicCam Basic Config.
-    const cv::InterpolationFlags BASICCAM_RESIZE_INTERPOLATION_METHOD = cv::InterpolationFlags::INTER_LINEAR;    // The algorithm used to fill in pixels when resizing.
+    const cv::InterpolationFlags BASICCAM_RESIZE_INTERPOLATION_METHOD = cv::InterpolationFlags::INTER_LINEAR;    // The algorithm used to fill in pixels when resizing. Rotated, flipped, or cropped frames only use nearest or bilinear, and area average when shrinking below half size.
+    const size_t BASICCAM_UNDISTORTION_MAP_CACHE_SIZE                 = 8;    // The max number of undistortion remap tables kept per camera. Each output size/region needs one. The least recently used is dropped when full.
+    // Camera replay. Plays recordings back in place of the cameras, so the server can be run against real footage without them.
+    const std::string REPLAYCAM_DIRECTORY = "";     // A cameras folder from a previous run to play back. Cameras without a recording in it stay live. Empty disables replay.
+    const double REPLAYCAM_SPEED          = 1.0;    // How fast recordings are played back. 1 keeps the original timing, 2 is twice as fast, 0 is as fast as they decode.
+    // Synthetic cameras. Generates frames in place of the cameras, so the server can be load tested at any resolution and frame rate without them.
+    const bool SYNTHETICCAM_ENABLE                = false;                         // Whether every camera is replaced by a synthetic one. Takes priority over replay.
+    const SYNTHETIC_PATTERNS SYNTHETICCAM_PATTERN = SYNTHETIC_PATTERNS::eNoise;    // The frames to generate. Noise is the hardest to encode, static the easiest.
+    const double SYNTHETICCAM_NOISE_LEVEL         = 0.25;                          // How strong the noise pattern is, from 0 to 1.
+    const int SYNTHETICCAM_RESOLUTIONX            = 0;                             // The X res of every synthetic camera. 0 uses the camera's own.
+    const int SYNTHETICCAM_RESOLUTIONY            = 0;                             // The Y res of every synthetic camera. 0 uses the camera's own.
+    const int SYNTHETICCAM_FPS                    = 0;                             // The FPS of every synthetic camera. 0 uses the camera's own.
+    const int SYNTHETICCAM_COUNT                  = 0;                             // The number of extra synthetic cameras added after the fixed ones, each set up, streamed, and recorded like the left drive camera. Max 254.
+    const int SYNTHETICCAM_EXTRA_INDEX            = 100;                           // The camera index of the first extra synthetic camera. Only used for names, file paths, and noise seeds.
+    // Camera streaming. Every stream scales, encodes, and sends its frames on these threads instead of the shared executor, since encoding takes a few milliseconds and sending can block.
+    const unsigned int STREAM_ENCODE_THREADS = 2;    // The number of threads shared by every stream. Each stream encodes one frame at a time, so more than one per stream doesn't help.
     ///////////////////////////////////////////////////////////////////////////
 
     ///////////////////////////////////////////////////////////////////////////
@@ -92,104 +170,205 @@ namespace constants
     ///////////////////////////////////////////////////////////////////////////
 
     // Drive Left Camera.
-    const int BASICCAM_DRIVECAMLEFT_RESOLUTIONX             = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
-    const int BASICCAM_DRIVECAMLEFT_RESOLUTIONY             = 720;     // The vertical pixel resolution to resize the basiccam images to.
-    const int BASICCAM_DRIVECAMLEFT_FPS                     = 30;      // The FPS to use for the basiccam.
-    const int BASICCAM_DRIVECAMLEFT_HORIZONTAL_FOV          = 110;     // The horizontal FOV of the camera. Useful for future calculations.
-    const int BASICCAM_DRIVECAMLEFT_VERTICAL_FOV            = 70;      // The vertical FOV of the camera. Useful for future calculations.
-    const int BASICCAM_DRIVECAMLEFT_FRAME_RETRIEVAL_THREADS = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
-    const int BASICCAM_DRIVECAMLEFT_INDEX                   = 0;       // The /dev/video index of the camera.
-    const PIXEL_FORMATS BASICCAM_DRIVECAMLEFT_PIXELTYPE     = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_DRIVECAMLEFT_RESOLUTIONX                   = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
+    const int BASICCAM_DRIVECAMLEFT_RESOLUTIONY                   = 720;     // The vertical pixel resolution to resize the basiccam images to.
+    const int BASICCAM_DRIVECAMLEFT_FPS                           = 30;      // The FPS to use for the basiccam.
+    const int BASICCAM_DRIVECAMLEFT_HORIZONTAL_FOV                = 110;     // The horizontal FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_DRIVECAMLEFT_VERTICAL_FOV                  = 70;      // The vertical FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_DRIVECAMLEFT_FRAME_RETRIEVAL_THREADS       = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
+    const int BASICCAM_DRIVECAMLEFT_INDEX                         = 0;       // The /dev/video index of the camera.
+    const PIXEL_FORMATS BASICCAM_DRIVECAMLEFT_PIXELTYPE           = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_DRIVECAMLEFT_ROTATION                      = 0;       // Clockwise rotation applied to the camera image. Must be 0, 90, 180, or 270. The resolution above is after rotating.
+    const bool BASICCAM_DRIVECAMLEFT_FLIP_HORIZONTAL              = false;    // Whether or not to mirror the camera image left to right after rotating.
+    const bool BASICCAM_DRIVECAMLEFT_FLIP_VERTICAL                = false;    // Whether or not to mirror the camera image top to bottom after rotating.
+    const cv::Rect BASICCAM_DRIVECAMLEFT_CROP                     = cv::Rect();    // The region of the raw camera image to keep. An empty rect keeps the whole image.
+    const std::string BASICCAM_DRIVECAMLEFT_CALIBRATION_FILE      = "";    // The OpenCV calibration file used to undistort the camera image. Empty disables undistortion.
+    const THREAD_PRIORITIES BASICCAM_DRIVECAMLEFT_PRIORITY        = THREAD_PRIORITIES::eCritical;    // The priority class of the camera's capture thread and frame copies.
+    const uint64_t BASICCAM_DRIVECAMLEFT_CPU_AFFINITY             = 0;                               // A bit for each CPU the capture thread may run on. 0 allows any CPU.
+    const THREAD_PRIORITIES BASICCAM_DRIVECAMLEFT_STREAM_PRIORITY = THREAD_PRIORITIES::eCritical;    // The priority class of the camera's stream.
+    const int BASICCAM_DRIVECAMLEFT_STALL_TIMEOUT                 = 500;                             // How long in milliseconds the capture thread can go without finishing a frame before the watchdog restarts it.
 
     // Drive Right Camera.
-    const int BASICCAM_DRIVECAMRIGHT_RESOLUTIONX             = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
-    const int BASICCAM_DRIVECAMRIGHT_RESOLUTIONY             = 720;     // The vertical pixel resolution to resize the basiccam images to.
-    const int BASICCAM_DRIVECAMRIGHT_FPS                     = 30;      // The FPS to use for the basiccam.
-    const int BASICCAM_DRIVECAMRIGHT_HORIZONTAL_FOV          = 110;     // The horizontal FOV of the camera. Useful for future calculations.
-    const int BASICCAM_DRIVECAMRIGHT_VERTICAL_FOV            = 70;      // The vertical FOV of the camera. Useful for future calculations.
-    const int BASICCAM_DRIVECAMRIGHT_FRAME_RETRIEVAL_THREADS = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
-    const int BASICCAM_DRIVECAMRIGHT_INDEX                   = 1;       // The /dev/video index of the camera.
-    const PIXEL_FORMATS BASICCAM_DRIVECAMRIGHT_PIXELTYPE     = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_DRIVECAMRIGHT_RESOLUTIONX                   = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
+    const int BASICCAM_DRIVECAMRIGHT_RESOLUTIONY                   = 720;     // The vertical pixel resolution to resize the basiccam images to.
+    const int BASICCAM_DRIVECAMRIGHT_FPS                           = 30;      // The FPS to use for the basiccam.
+    const int BASICCAM_DRIVECAMRIGHT_HORIZONTAL_FOV                = 110;     // The horizontal FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_DRIVECAMRIGHT_VERTICAL_FOV                  = 70;      // The vertical FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_DRIVECAMRIGHT_FRAME_RETRIEVAL_THREADS       = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
+    const int BASICCAM_DRIVECAMRIGHT_INDEX                         = 1;       // The /dev/video index of the camera.
+    const PIXEL_FORMATS BASICCAM_DRIVECAMRIGHT_PIXELTYPE           = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_DRIVECAMRIGHT_ROTATION                      = 0;       // Clockwise rotation applied to the camera image. Must be 0, 90, 180, or 270. The resolution above is after rotating.
+    const bool BASICCAM_DRIVECAMRIGHT_FLIP_HORIZONTAL              = false;    // Whether or not to mirror the camera image left to right after rotating.
+    const bool BASICCAM_DRIVECAMRIGHT_FLIP_VERTICAL                = false;    // Whether or not to mirror the camera image top to bottom after rotating.
+    const cv::Rect BASICCAM_DRIVECAMRIGHT_CROP                     = cv::Rect();    // The region of the raw camera image to keep. An empty rect keeps the whole image.
+    const std::string BASICCAM_DRIVECAMRIGHT_CALIBRATION_FILE      = "";    // The OpenCV calibration file used to undistort the camera image. Empty disables undistortion.
+    const THREAD_PRIORITIES BASICCAM_DRIVECAMRIGHT_PRIORITY        = THREAD_PRIORITIES::eCritical;    // The priority class of the camera's capture thread and frame copies.
+    const uint64_t BASICCAM_DRIVECAMRIGHT_CPU_AFFINITY             = 0;                               // A bit for each CPU the capture thread may run on. 0 allows any CPU.
+    const THREAD_PRIORITIES BASICCAM_DRIVECAMRIGHT_STREAM_PRIORITY = THREAD_PRIORITIES::eCritical;    // The priority class of the camera's stream.
+    const int BASICCAM_DRIVECAMRIGHT_STALL_TIMEOUT                 = 500;                             // How long in milliseconds the capture thread can go without finishing a frame before the watchdog restarts it.
 
     // Gimbal Left Camera.
-    const int BASICCAM_GIMBALCAMLEFT_RESOLUTIONX             = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
-    const int BASICCAM_GIMBALCAMLEFT_RESOLUTIONY             = 720;     // The vertical pixel resolution to resize the basiccam images to.
-    const int BASICCAM_GIMBALCAMLEFT_FPS                     = 30;      // The FPS to use for the basiccam.
-    const int BASICCAM_GIMBALCAMLEFT_HORIZONTAL_FOV          = 110;     // The horizontal FOV of the camera. Useful for future calculations.
-    const int BASICCAM_GIMBALCAMLEFT_VERTICAL_FOV            = 70;      // The vertical FOV of the camera. Useful for future calculations.
-    const int BASICCAM_GIMBALCAMLEFT_FRAME_RETRIEVAL_THREADS = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
-    const int BASICCAM_GIMBALCAMLEFT_INDEX                   = 2;       // The /dev/video index of the camera.
-    const PIXEL_FORMATS BASICCAM_GIMBALCAMLEFT_PIXELTYPE     = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_GIMBALCAMLEFT_RESOLUTIONX                   = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
+    const int BASICCAM_GIMBALCAMLEFT_RESOLUTIONY                   = 720;     // The vertical pixel resolution to resize the basiccam images to.
+    const int BASICCAM_GIMBALCAMLEFT_FPS                           = 30;      // The FPS to use for the basiccam.
+    const int BASICCAM_GIMBALCAMLEFT_HORIZONTAL_FOV                = 110;     // The horizontal FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_GIMBALCAMLEFT_VERTICAL_FOV                  = 70;      // The vertical FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_GIMBALCAMLEFT_FRAME_RETRIEVAL_THREADS       = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
+    const int BASICCAM_GIMBALCAMLEFT_INDEX                         = 2;       // The /dev/video index of the camera.
+    const PIXEL_FORMATS BASICCAM_GIMBALCAMLEFT_PIXELTYPE           = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_GIMBALCAMLEFT_ROTATION                      = 0;       // Clockwise rotation applied to the camera image. Must be 0, 90, 180, or 270. The resolution above is after rotating.
+    const bool BASICCAM_GIMBALCAMLEFT_FLIP_HORIZONTAL              = false;    // Whether or not to mirror the camera image left to right after rotating.
+    const bool BASICCAM_GIMBALCAMLEFT_FLIP_VERTICAL                = false;    // Whether or not to mirror the camera image top to bottom after rotating.
+    const cv::Rect BASICCAM_GIMBALCAMLEFT_CROP                     = cv::Rect();    // The region of the raw camera image to keep. An empty rect keeps the whole image.
+    const std::string BASICCAM_GIMBALCAMLEFT_CALIBRATION_FILE      = "";    // The OpenCV calibration file used to undistort the camera image. Empty disables undistortion.
+    const THREAD_PRIORITIES BASICCAM_GIMBALCAMLEFT_PRIORITY        = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's capture thread and frame copies.
+    const uint64_t BASICCAM_GIMBALCAMLEFT_CPU_AFFINITY             = 0;                             // A bit for each CPU the capture thread may run on. 0 allows any CPU.
+    const THREAD_PRIORITIES BASICCAM_GIMBALCAMLEFT_STREAM_PRIORITY = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's stream.
+    const int BASICCAM_GIMBALCAMLEFT_STALL_TIMEOUT                 = 1000;                          // How long in milliseconds the capture thread can go without finishing a frame before the watchdog restarts it.
 
     // Gimbal Right Camera.
-    const int BASICCAM_GIMBALCAMRIGHT_RESOLUTIONX             = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
-    const int BASICCAM_GIMBALCAMRIGHT_RESOLUTIONY             = 720;     // The vertical pixel resolution to resize the basiccam images to.
-    const int BASICCAM_GIMBALCAMRIGHT_FPS                     = 30;      // The FPS to use for the basiccam.
-    const int BASICCAM_GIMBALCAMRIGHT_HORIZONTAL_FOV          = 110;     // The horizontal FOV of the camera. Useful for future calculations.
-    const int BASICCAM_GIMBALCAMRIGHT_VERTICAL_FOV            = 70;      // The vertical FOV of the camera. Useful for future calculations.
-    const int BASICCAM_GIMBALCAMRIGHT_FRAME_RETRIEVAL_THREADS = 5;    // The number of threads allocated to the threadpool for performing frame copies to other threads.
-    const int BASICCAM_GIMBALCAMRIGHT_INDEX                   = 3;    // The /dev/video index of the camera.
-    const PIXEL_FORMATS BASICCAM_GIMBALCAMRIGHT_PIXELTYPE     = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_GIMBALCAMRIGHT_RESOLUTIONX                   = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
+    const int BASICCAM_GIMBALCAMRIGHT_RESOLUTIONY                   = 720;     // The vertical pixel resolution to resize the basiccam images to.
+    const int BASICCAM_GIMBALCAMRIGHT_FPS                           = 30;      // The FPS to use for the basiccam.
+    const int BASICCAM_GIMBALCAMRIGHT_HORIZONTAL_FOV                = 110;     // The horizontal FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_GIMBALCAMRIGHT_VERTICAL_FOV                  = 70;      // The vertical FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_GIMBALCAMRIGHT_FRAME_RETRIEVAL_THREADS       = 5;    // The number of threads allocated to the threadpool for performing frame copies to other threads.
+    const int BASICCAM_GIMBALCAMRIGHT_INDEX                         = 3;    // The /dev/video index of the camera.
+    const PIXEL_FORMATS BASICCAM_GIMBALCAMRIGHT_PIXELTYPE           = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_GIMBALCAMRIGHT_ROTATION                      = 0;    // Clockwise rotation applied to the camera image. Must be 0, 90, 180, or 270. The resolution above is after rotating.
+    const bool BASICCAM_GIMBALCAMRIGHT_FLIP_HORIZONTAL              = false;    // Whether or not to mirror the camera image left to right after rotating.
+    const bool BASICCAM_GIMBALCAMRIGHT_FLIP_VERTICAL                = false;    // Whether or not to mirror the camera image top to bottom after rotating.
+    const cv::Rect BASICCAM_GIMBALCAMRIGHT_CROP                     = cv::Rect();    // The region of the raw camera image to keep. An empty rect keeps the whole image.
+    const std::string BASICCAM_GIMBALCAMRIGHT_CALIBRATION_FILE      = "";    // The OpenCV calibration file used to undistort the camera image. Empty disables undistortion.
+    const THREAD_PRIORITIES BASICCAM_GIMBALCAMRIGHT_PRIORITY        = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's capture thread and frame copies.
+    const uint64_t BASICCAM_GIMBALCAMRIGHT_CPU_AFFINITY             = 0;                             // A bit for each CPU the capture thread may run on. 0 allows any CPU.
+    const THREAD_PRIORITIES BASICCAM_GIMBALCAMRIGHT_STREAM_PRIORITY = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's stream.
+    const int BASICCAM_GIMBALCAMRIGHT_STALL_TIMEOUT                 = 1000;                          // How long in milliseconds the capture thread can go without finishing a frame before the watchdog restarts it.
 
     // Back Camera.
-    const int BASICCAM_BACKCAM_RESOLUTIONX             = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
-    const int BASICCAM_BACKCAM_RESOLUTIONY             = 720;     // The vertical pixel resolution to resize the basiccam images to.
-    const int BASICCAM_BACKCAM_FPS                     = 30;      // The FPS to use for the basiccam.
-    const int BASICCAM_BACKCAM_HORIZONTAL_FOV          = 110;     // The horizontal FOV of the camera. Useful for future calculations.
-    const int BASICCAM_BACKCAM_VERTICAL_FOV            = 70;      // The vertical FOV of the camera. Useful for future calculations.
-    const int BASICCAM_BACKCAM_FRAME_RETRIEVAL_THREADS = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
-    const int BASICCAM_BACKCAM_INDEX                   = 4;       // The /dev/video index of the camera.
-    const PIXEL_FORMATS BASICCAM_BACKCAM_PIXELTYPE     = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_BACKCAM_RESOLUTIONX                   = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
+    const int BASICCAM_BACKCAM_RESOLUTIONY                   = 720;     // The vertical pixel resolution to resize the basiccam images to.
+    const int BASICCAM_BACKCAM_FPS                           = 30;      // The FPS to use for the basiccam.
+    const int BASICCAM_BACKCAM_HORIZONTAL_FOV                = 110;     // The horizontal FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_BACKCAM_VERTICAL_FOV                  = 70;      // The vertical FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_BACKCAM_FRAME_RETRIEVAL_THREADS       = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
+    const int BASICCAM_BACKCAM_INDEX                         = 4;       // The /dev/video index of the camera.
+    const PIXEL_FORMATS BASICCAM_BACKCAM_PIXELTYPE           = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_BACKCAM_ROTATION                      = 0;       // Clockwise rotation applied to the camera image. Must be 0, 90, 180, or 270. The resolution above is after rotating.
+    const bool BASICCAM_BACKCAM_FLIP_HORIZONTAL              = false;    // Whether or not to mirror the camera image left to right after rotating.
+    const bool BASICCAM_BACKCAM_FLIP_VERTICAL                = false;    // Whether or not to mirror the camera image top to bottom after rotating.
+    const cv::Rect BASICCAM_BACKCAM_CROP                     = cv::Rect();    // The region of the raw camera image to keep. An empty rect keeps the whole image.
+    const std::string BASICCAM_BACKCAM_CALIBRATION_FILE      = "";    // The OpenCV calibration file used to undistort the camera image. Empty disables undistortion.
+    const THREAD_PRIORITIES BASICCAM_BACKCAM_PRIORITY        = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's capture thread and frame copies.
+    const uint64_t BASICCAM_BACKCAM_CPU_AFFINITY             = 0;                             // A bit for each CPU the capture thread may run on. 0 allows any CPU.
+    const THREAD_PRIORITIES BASICCAM_BACKCAM_STREAM_PRIORITY = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's stream.
+    const int BASICCAM_BACKCAM_STALL_TIMEOUT                 = 1000;                          // How long in milliseconds the capture thread can go without finishing a frame before the watchdog restarts it.
 
     // Aux Camera 1.
-    const int BASICCAM_AUXCAM1_RESOLUTIONX             = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
-    const int BASICCAM_AUXCAM1_RESOLUTIONY             = 720;     // The vertical pixel resolution to resize the basiccam images to.
-    const int BASICCAM_AUXCAM1_FPS                     = 30;      // The FPS to use for the basiccam.
-    const int BASICCAM_AUXCAM1_HORIZONTAL_FOV          = 110;     // The horizontal FOV of the camera. Useful for future calculations.
-    const int BASICCAM_AUXCAM1_VERTICAL_FOV            = 70;      // The vertical FOV of the camera. Useful for future calculations.
-    const int BASICCAM_AUXCAM1_FRAME_RETRIEVAL_THREADS = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
-    const int BASICCAM_AUXCAM1_INDEX                   = 5;       // The /dev/video index of the camera.
-    const PIXEL_FORMATS BASICCAM_AUXCAM1_PIXELTYPE     = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_AUXCAM1_RESOLUTIONX                   = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
+    const int BASICCAM_AUXCAM1_RESOLUTIONY                   = 720;     // The vertical pixel resolution to resize the basiccam images to.
+    const int BASICCAM_AUXCAM1_FPS                           = 30;      // The FPS to use for the basiccam.
+    const int BASICCAM_AUXCAM1_HORIZONTAL_FOV                = 110;     // The horizontal FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_AUXCAM1_VERTICAL_FOV                  = 70;      // The vertical FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_AUXCAM1_FRAME_RETRIEVAL_THREADS       = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
+    const int BASICCAM_AUXCAM1_INDEX                         = 5;       // The /dev/video index of the camera.
+    const PIXEL_FORMATS BASICCAM_AUXCAM1_PIXELTYPE           = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_AUXCAM1_ROTATION                      = 0;       // Clockwise rotation applied to the camera image. Must be 0, 90, 180, or 270. The resolution above is after rotating.
+    const bool BASICCAM_AUXCAM1_FLIP_HORIZONTAL              = false;    // Whether or not to mirror the camera image left to right after rotating.
+    const bool BASICCAM_AUXCAM1_FLIP_VERTICAL                = false;    // Whether or not to mirror the camera image top to bottom after rotating.
+    const cv::Rect BASICCAM_AUXCAM1_CROP                     = cv::Rect();    // The region of the raw camera image to keep. An empty rect keeps the whole image.
+    const std::string BASICCAM_AUXCAM1_CALIBRATION_FILE      = "";    // The OpenCV calibration file used to undistort the camera image. Empty disables undistortion.
+    const THREAD_PRIORITIES BASICCAM_AUXCAM1_PRIORITY        = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's capture thread and frame copies.
+    const uint64_t BASICCAM_AUXCAM1_CPU_AFFINITY             = 0;                             // A bit for each CPU the capture thread may run on. 0 allows any CPU.
+    const THREAD_PRIORITIES BASICCAM_AUXCAM1_STREAM_PRIORITY = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's stream.
+    const int BASICCAM_AUXCAM1_STALL_TIMEOUT                 = 1000;                          // How long in milliseconds the capture thread can go without finishing a frame before the watchdog restarts it.
 
     // Aux Camera 2.
-    const int BASICCAM_AUXCAM2_RESOLUTIONX             = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
-    const int BASICCAM_AUXCAM2_RESOLUTIONY             = 720;     // The vertical pixel resolution to resize the basiccam images to.
-    const int BASICCAM_AUXCAM2_FPS                     = 30;      // The FPS to use for the basiccam.
-    const int BASICCAM_AUXCAM2_HORIZONTAL_FOV          = 110;     // The horizontal FOV of the camera. Useful for future calculations.
-    const int BASICCAM_AUXCAM2_VERTICAL_FOV            = 70;      // The vertical FOV of the camera. Useful for future calculations.
-    const int BASICCAM_AUXCAM2_FRAME_RETRIEVAL_THREADS = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
-    const int BASICCAM_AUXCAM2_INDEX                   = 6;       // The /dev/video index of the camera.
-    const PIXEL_FORMATS BASICCAM_AUXCAM2_PIXELTYPE     = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_AUXCAM2_RESOLUTIONX                   = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
+    const int BASICCAM_AUXCAM2_RESOLUTIONY                   = 720;     // The vertical pixel resolution to resize the basiccam images to.
+    const int BASICCAM_AUXCAM2_FPS                           = 30;      // The FPS to use for the basiccam.
+    const int BASICCAM_AUXCAM2_HORIZONTAL_FOV                = 110;     // The horizontal FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_AUXCAM2_VERTICAL_FOV                  = 70;      // The vertical FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_AUXCAM2_FRAME_RETRIEVAL_THREADS       = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
+    const int BASICCAM_AUXCAM2_INDEX                         = 6;       // The /dev/video index of the camera.
+    const PIXEL_FORMATS BASICCAM_AUXCAM2_PIXELTYPE           = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_AUXCAM2_ROTATION                      = 0;       // Clockwise rotation applied to the camera image. Must be 0, 90, 180, or 270. The resolution above is after rotating.
+    const bool BASICCAM_AUXCAM2_FLIP_HORIZONTAL              = false;    // Whether or not to mirror the camera image left to right after rotating.
+    const bool BASICCAM_AUXCAM2_FLIP_VERTICAL                = false;    // Whether or not to mirror the camera image top to bottom after rotating.
+    const cv::Rect BASICCAM_AUXCAM2_CROP                     = cv::Rect();    // The region of the raw camera image to keep. An empty rect keeps the whole image.
+    const std::string BASICCAM_AUXCAM2_CALIBRATION_FILE      = "";    // The OpenCV calibration file used to undistort the camera image. Empty disables undistortion.
+    const THREAD_PRIORITIES BASICCAM_AUXCAM2_PRIORITY        = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's capture thread and frame copies.
+    const uint64_t BASICCAM_AUXCAM2_CPU_AFFINITY             = 0;                             // A bit for each CPU the capture thread may run on. 0 allows any CPU.
+    const THREAD_PRIORITIES BASICCAM_AUXCAM2_STREAM_PRIORITY = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's stream.
+    const int BASICCAM_AUXCAM2_STALL_TIMEOUT                 = 1000;                          // How long in milliseconds the capture thread can go without finishing a frame before the watchdog restarts it.
 
     // Aux Camera 3.
-    const int BASICCAM_AUXCAM3_RESOLUTIONX             = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
-    const int BASICCAM_AUXCAM3_RESOLUTIONY             = 720;     // The vertical pixel resolution to resize the basiccam images to.
-    const int BASICCAM_AUXCAM3_FPS                     = 30;      // The FPS to use for the basiccam.
-    const int BASICCAM_AUXCAM3_HORIZONTAL_FOV          = 110;     // The horizontal FOV of the camera. Useful for future calculations.
-    const int BASICCAM_AUXCAM3_VERTICAL_FOV            = 70;      // The vertical FOV of the camera. Useful for future calculations.
-    const int BASICCAM_AUXCAM3_FRAME_RETRIEVAL_THREADS = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
-    const int BASICCAM_AUXCAM3_INDEX                   = 7;       // The /dev/video index of the camera.
-    const PIXEL_FORMATS BASICCAM_AUXCAM3_PIXELTYPE     = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_AUXCAM3_RESOLUTIONX                   = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
+    const int BASICCAM_AUXCAM3_RESOLUTIONY                   = 720;     // The vertical pixel resolution to resize the basiccam images to.
+    const int BASICCAM_AUXCAM3_FPS                           = 30;      // The FPS to use for the basiccam.
+    const int BASICCAM_AUXCAM3_HORIZONTAL_FOV                = 110;     // The horizontal FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_AUXCAM3_VERTICAL_FOV                  = 70;      // The vertical FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_AUXCAM3_FRAME_RETRIEVAL_THREADS       = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
+    const int BASICCAM_AUXCAM3_INDEX                         = 7;       // The /dev/video index of the camera.
+    const PIXEL_FORMATS BASICCAM_AUXCAM3_PIXELTYPE           = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_AUXCAM3_ROTATION                      = 0;       // Clockwise rotation applied to the camera image. Must be 0, 90, 180, or 270. The resolution above is after rotating.
+    const bool BASICCAM_AUXCAM3_FLIP_HORIZONTAL              = false;    // Whether or not to mirror the camera image left to right after rotating.
+    const bool BASICCAM_AUXCAM3_FLIP_VERTICAL                = false;    // Whether or not to mirror the camera image top to bottom after rotating.
+    const cv::Rect BASICCAM_AUXCAM3_CROP                     = cv::Rect();    // The region of the raw camera image to keep. An empty rect keeps the whole image.
+    const std::string BASICCAM_AUXCAM3_CALIBRATION_FILE      = "";    // The OpenCV calibration file used to undistort the camera image. Empty disables undistortion.
+    const THREAD_PRIORITIES BASICCAM_AUXCAM3_PRIORITY        = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's capture thread and frame copies.
+    const uint64_t BASICCAM_AUXCAM3_CPU_AFFINITY             = 0;                             // A bit for each CPU the capture thread may run on. 0 allows any CPU.
+    const THREAD_PRIORITIES BASICCAM_AUXCAM3_STREAM_PRIORITY = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's stream.
+    const int BASICCAM_AUXCAM3_STALL_TIMEOUT                 = 1000;                          // How long in milliseconds the capture thread can go without finishing a frame before the watchdog restarts it.
 
     // Aux Camera 4.
-    const int BASICCAM_AUXCAM4_RESOLUTIONX             = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
-    const int BASICCAM_AUXCAM4_RESOLUTIONY             = 720;     // The vertical pixel resolution to resize the basiccam images to.
-    const int BASICCAM_AUXCAM4_FPS                     = 30;      // The FPS to use for the basiccam.
-    const int BASICCAM_AUXCAM4_HORIZONTAL_FOV          = 110;     // The horizontal FOV of the camera. Useful for future calculations.
-    const int BASICCAM_AUXCAM4_VERTICAL_FOV            = 70;      // The vertical FOV of the camera. Useful for future calculations.
-    const int BASICCAM_AUXCAM4_FRAME_RETRIEVAL_THREADS = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
-    const int BASICCAM_AUXCAM4_INDEX                   = 8;       // The /dev/video index of the camera.
-    const PIXEL_FORMATS BASICCAM_AUXCAM4_PIXELTYPE     = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_AUXCAM4_RESOLUTIONX                   = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
+    const int BASICCAM_AUXCAM4_RESOLUTIONY                   = 720;     // The vertical pixel resolution to resize the basiccam images to.
+    const int BASICCAM_AUXCAM4_FPS                           = 30;      // The FPS to use for the basiccam.
+    const int BASICCAM_AUXCAM4_HORIZONTAL_FOV                = 110;     // The horizontal FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_AUXCAM4_VERTICAL_FOV                  = 70;      // The vertical FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_AUXCAM4_FRAME_RETRIEVAL_THREADS       = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
+    const int BASICCAM_AUXCAM4_INDEX                         = 8;       // The /dev/video index of the camera.
+    const PIXEL_FORMATS BASICCAM_AUXCAM4_PIXELTYPE           = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_AUXCAM4_ROTATION                      = 0;       // Clockwise rotation applied to the camera image. Must be 0, 90, 180, or 270. The resolution above is after rotating.
+    const bool BASICCAM_AUXCAM4_FLIP_HORIZONTAL              = false;    // Whether or not to mirror the camera image left to right after rotating.
+    const bool BASICCAM_AUXCAM4_FLIP_VERTICAL                = false;    // Whether or not to mirror the camera image top to bottom after rotating.
+    const cv::Rect BASICCAM_AUXCAM4_CROP                     = cv::Rect();    // The region of the raw camera image to keep. An empty rect keeps the whole image.
+    const std::string BASICCAM_AUXCAM4_CALIBRATION_FILE      = "";    // The OpenCV calibration file used to undistort the camera image. Empty disables undistortion.
+    const THREAD_PRIORITIES BASICCAM_AUXCAM4_PRIORITY        = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's capture thread and frame copies.
+    const uint64_t BASICCAM_AUXCAM4_CPU_AFFINITY             = 0;                             // A bit for each CPU the capture thread may run on. 0 allows any CPU.
+    const THREAD_PRIORITIES BASICCAM_AUXCAM4_STREAM_PRIORITY = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's stream.
+    const int BASICCAM_AUXCAM4_STALL_TIMEOUT                 = 1000;                          // How long in milliseconds the capture thread can go without finishing a frame before the watchdog restarts it.
 
     // Microscope Camera.
-    const int BASICCAM_MICROSCOPE_RESOLUTIONX             = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
-    const int BASICCAM_MICROSCOPE_RESOLUTIONY             = 720;     // The vertical pixel resolution to resize the basiccam images to.
-    const int BASICCAM_MICROSCOPE_FPS                     = 30;      // The FPS to use for the basiccam.
-    const int BASICCAM_MICROSCOPE_HORIZONTAL_FOV          = 110;     // The horizontal FOV of the camera. Useful for future calculations.
-    const int BASICCAM_MICROSCOPE_VERTICAL_FOV            = 70;      // The vertical FOV of the camera. Useful for future calculations.
-    const int BASICCAM_MICROSCOPE_FRAME_RETRIEVAL_THREADS = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
-    const int BASICCAM_MICROSCOPE_INDEX                   = 9;       // The /dev/video index of the camera.
-    const PIXEL_FORMATS BASICCAM_MICROSCOPE_PIXELTYPE     = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_MICROSCOPE_RESOLUTIONX                   = 1280;    // The horizontal pixel resolution to resize the basiccam images to.
+    const int BASICCAM_MICROSCOPE_RESOLUTIONY                   = 720;     // The vertical pixel resolution to resize the basiccam images to.
+    const int BASICCAM_MICROSCOPE_FPS                           = 30;      // The FPS to use for the basiccam.
+    const int BASICCAM_MICROSCOPE_HORIZONTAL_FOV                = 110;     // The horizontal FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_MICROSCOPE_VERTICAL_FOV                  = 70;      // The vertical FOV of the camera. Used for undistortion if the calibration has no camera matrix.
+    const int BASICCAM_MICROSCOPE_FRAME_RETRIEVAL_THREADS       = 5;       // The number of threads allocated to the threadpool for performing frame copies to other threads.
+    const int BASICCAM_MICROSCOPE_INDEX                         = 9;       // The /dev/video index of the camera.
+    const PIXEL_FORMATS BASICCAM_MICROSCOPE_PIXELTYPE           = PIXEL_FORMATS::eBGR;    // The pixel layout of the camera.
+    const int BASICCAM_MICROSCOPE_ROTATION                      = 0;       // Clockwise rotation applied to the camera image. Must be 0, 90, 180, or 270. The resolution above is after rotating.
+    const bool BASICCAM_MICROSCOPE_FLIP_HORIZONTAL              = false;    // Whether or not to mirror the camera image left to right after rotating.
+    const bool BASICCAM_MICROSCOPE_FLIP_VERTICAL                = false;    // Whether or not to mirror the camera image top to bottom after rotating.
+    const cv::Rect BASICCAM_MICROSCOPE_CROP                     = cv::Rect();    // The region of the raw camera image to keep. An empty rect keeps the whole image.
+    const std::string BASICCAM_MICROSCOPE_CALIBRATION_FILE      = "";    // The OpenCV calibration file used to undistort the camera image. Empty disables undistortion.
+    const THREAD_PRIORITIES BASICCAM_MICROSCOPE_PRIORITY        = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's capture thread and frame copies.
+    const uint64_t BASICCAM_MICROSCOPE_CPU_AFFINITY             = 0;                             // A bit for each CPU the capture thread may run on. 0 allows any CPU.
+    const THREAD_PRIORITIES BASICCAM_MICROSCOPE_STREAM_PRIORITY = THREAD_PRIORITIES::eNormal;    // The priority class of the camera's stream.
+    const int BASICCAM_MICROSCOPE_STALL_TIMEOUT                 = 1000;                          // How long in milliseconds the capture thread can go without finishing a frame before the watchdog restarts it.
+    ///////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    //// Watchdog Handler Adjustments.
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Watchdog Handler.
+    const int WATCHDOG_FPS                    = 20;                              // How many times a second the heartbeats are checked.
+    const THREAD_PRIORITIES WATCHDOG_PRIORITY = THREAD_PRIORITIES::eCritical;    // The priority class of the watchdog thread. It must keep running while others are stuck.
+    const int WATCHDOG_STREAM_STALL_TIMEOUT   = 2000;                            // How long in milliseconds a stream can go without sending a frame before it's reported.
+    const int WATCHDOG_RECORDER_STALL_TIMEOUT = 2000;                            // How long in milliseconds the recording handler can go without an iteration before it's reported.
     ///////////////////////////////////////////////////////////////////////////
 
 }    // namespace constants
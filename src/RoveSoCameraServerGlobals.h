@@ -11,6 +11,7 @@
 #ifndef ROVESOCAMERA_GLOBALS_H
 #define ROVESOCAMERA_GLOBALS_H
 
+#include "RoveSoCameraServerLogging.h"
 #include "handlers/CameraHandler.h"
 
 /// \cond
@@ -35,6 +36,114 @@ namespace globals
     /////////////////////////////////////////
     // Camera Handler:
     extern CameraHandler* g_pCameraHandler;    // Global Camera Handler
+
+    /////////////////////////////////////////
+    // Declare namespace callbacks.
+    /////////////////////////////////////////
+
+    // SETSTREAMROI: Sets a camera stream region of interest. [Camera, X, Y, Width, Height] as floats.
+    const std::function<void(const rovecomm::RoveCommPacket<float>&, const sockaddr_in&)> SetStreamRegionOfInterestCallback =
+        [](const rovecomm::RoveCommPacket<float>& stPacket, const sockaddr_in& stdAddr)
+    {
+        // Not using this.
+        (void) stdAddr;
+
+        // Check that the packet has a camera and a region.
+        if (stPacket.vData.size() < 5)
+        {
+            // Submit logger message.
+            LOG_WARNING(logging::g_qSharedLogger, "Incoming SETSTREAMROI packet only had {} values, expected 5! Ignoring...", stPacket.vData.size());
+            return;
+        }
+
+        // Check that the camera is valid.
+        const int nCamera = static_cast<int>(stPacket.vData[0]);
+        if (nCamera <= static_cast<int>(CameraHandler::BasicCamName::BASICCAM_START) || nCamera >= static_cast<int>(CameraHandler::BasicCamName::BASICCAM_END))
+        {
+            // Submit logger message.
+            LOG_WARNING(logging::g_qSharedLogger, "Incoming SETSTREAMROI packet had invalid camera {}! Ignoring...", nCamera);
+            return;
+        }
+
+        // Set the region of interest on the stream. An empty region streams the whole image.
+        cv::Rect2d cvRegionOfInterest(stPacket.vData[1], stPacket.vData[2], stPacket.vData[3], stPacket.vData[4]);
+        g_pCameraHandler->GetFFmpegUDPCameraStreamer(static_cast<CameraHandler::BasicCamName>(nCamera))->SetRegionOfInterest(cvRegionOfInterest);
+
+        // Submit logger message.
+        LOG_INFO(logging::g_qSharedLogger,
+                 "Incoming SETSTREAMROI: [Camera: {}, X: {}, Y: {}, Width: {}, Height: {}]",
+                 nCamera,
+                 stPacket.vData[1],
+                 stPacket.vData[2],
+                 stPacket.vData[3],
+                 stPacket.vData[4]);
+    };
+
+    // TRIGGERREPLAY: Saves a camera's instant replay. [Camera] as uint8, 0 saves every camera.
+    const std::function<void(const rovecomm::RoveCommPacket<uint8_t>&, const sockaddr_in&)> TriggerReplayCallback =
+        [](const rovecomm::RoveCommPacket<uint8_t>& stPacket, const sockaddr_in& stdAddr)
+    {
+        // Not using this.
+        (void) stdAddr;
+
+        // Check that the packet has a camera.
+        if (stPacket.vData.empty())
+        {
+            // Submit logger message.
+            LOG_WARNING(logging::g_qSharedLogger, "Incoming TRIGGERREPLAY packet was empty! Ignoring...");
+            return;
+        }
+
+        // Check that the camera is valid. BASICCAM_START saves every camera.
+        const int nCamera = static_cast<int>(stPacket.vData[0]);
+        if (nCamera < static_cast<int>(CameraHandler::BasicCamName::BASICCAM_START) || nCamera >= static_cast<int>(CameraHandler::BasicCamName::BASICCAM_END))
+        {
+            // Submit logger message.
+            LOG_WARNING(logging::g_qSharedLogger, "Incoming TRIGGERREPLAY packet had invalid camera {}! Ignoring...", nCamera);
+            return;
+        }
+
+        // Submit logger message.
+        LOG_INFO(logging::g_qSharedLogger, "Incoming TRIGGERREPLAY: [Camera: {}]", nCamera);
+
+        // Save the replay.
+        if (!g_pCameraHandler->GetRecordingHandler()->TriggerReplay(nCamera))
+        {
+            // Submit logger message.
+            LOG_WARNING(logging::g_qSharedLogger, "TRIGGERREPLAY: No replay available for camera {}.", nCamera);
+        }
+    };
+
+    // SETRECORDING: Turns recording of a camera on or off. [Camera, Enable] as uint8, 0 sets every camera.
+    const std::function<void(const rovecomm::RoveCommPacket<uint8_t>&, const sockaddr_in&)> SetRecordingCallback =
+        [](const rovecomm::RoveCommPacket<uint8_t>& stPacket, const sockaddr_in& stdAddr)
+    {
+        // Not using this.
+        (void) stdAddr;
+
+        // Check that the packet has a camera and a state.
+        if (stPacket.vData.size() < 2)
+        {
+            // Submit logger message.
+            LOG_WARNING(logging::g_qSharedLogger, "Incoming SETRECORDING packet only had {} values, expected 2! Ignoring...", stPacket.vData.size());
+            return;
+        }
+
+        // Check that the camera is valid. BASICCAM_START sets every camera.
+        const int nCamera = static_cast<int>(stPacket.vData[0]);
+        if (nCamera < static_cast<int>(CameraHandler::BasicCamName::BASICCAM_START) || nCamera >= static_cast<int>(CameraHandler::BasicCamName::BASICCAM_END))
+        {
+            // Submit logger message.
+            LOG_WARNING(logging::g_qSharedLogger, "Incoming SETRECORDING packet had invalid camera {}! Ignoring...", nCamera);
+            return;
+        }
+
+        // Submit logger message.
+        LOG_INFO(logging::g_qSharedLogger, "Incoming SETRECORDING: [Camera: {}, Enable: {}]", nCamera, stPacket.vData[1] != 0);
+
+        // Turn recording on or off. The recording thread applies it on its next iteration.
+        g_pCameraHandler->GetRecordingHandler()->SetCameraRecording(nCamera, stPacket.vData[1] != 0);
+    };
 }    // namespace globals
 
 #endif    // ROVESOCAMERA_GLOBALS_H
@@ -18,6 +18,7 @@
 #include <ctime>
 #include <filesystem>
 #include <iostream>
+#include <thread>
 
 /// \endcond
 
@@ -159,8 +160,15 @@ namespace logging
         // Configure Quill
         quill::BackendOptions qBackendConfig;
 
-        // Start Quill
-        quill::Backend::start(qBackendConfig);
+        // Start Quill from a thread in the logging priority class, so the backend thread it creates inherits the class and CPUs.
+        std::thread thBackendStarter(
+            [&qBackendConfig]()
+            {
+                scheduling::SetCurrentThreadPriority(constants::LOGGING_PRIORITY);
+                scheduling::SetCurrentThreadAffinity(constants::LOGGING_CPU_AFFINITY);
+                quill::Backend::start(qBackendConfig);
+            });
+        thBackendStarter.join();
 
         // Set Handler Filters
         qLogFileSink->add_filter(std::make_unique<LoggingFilter>("LogFileFilter", quill::LogLevel::TraceL3));
@@ -192,6 +200,34 @@ namespace logging
         g_qSharedLogger->init_backtrace(10, quill::LogLevel::Critical);
     }
 
+    /******************************************************************************
+     * @brief Log an exception thrown by a WorkStealingExecutor task that nobody is
+     *      waiting on. Given to each executor as its exception handler.
+     *
+     * @param pException - The exception the task threw.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    void LogTaskException(std::exception_ptr pException)
+    {
+        // Find out what was thrown.
+        try
+        {
+            std::rethrow_exception(pException);
+        }
+        catch (const std::exception& stException)
+        {
+            // Submit logger message.
+            LOG_ERROR(g_qSharedLogger, "WorkStealingExecutor: A task threw an exception: {}", stException.what());
+        }
+        catch (...)
+        {
+            // Submit logger message.
+            LOG_ERROR(g_qSharedLogger, "WorkStealingExecutor: A task threw an unknown exception.");
+        }
+    }
+
     /******************************************************************************
      * @brief Writes a log message to the MRDT console sink, formats the message
      * using the provided formatter, and then passes the formatted log message
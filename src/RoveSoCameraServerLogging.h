@@ -31,6 +31,7 @@
 #include <RoveComm/RoveComm.h>
 #include <RoveComm/RoveCommManifest.h>
 #include <atomic>
+#include <exception>
 #include <shared_mutex>
 
 /// \endcond
@@ -88,6 +89,7 @@ namespace logging
     /////////////////////////////////////////
 
     void InitializeLoggers(std::string szLoggingOutputPath);
+    void LogTaskException(std::exception_ptr pException);
 
     /////////////////////////////////////////
     // Declare namespace callbacks.
@@ -10,6 +10,9 @@
 
 #include "CameraHandler.h"
 #include "../RoveSoCameraServerConstants.h"
+#include "../RoveSoCameraServerLogging.h"
+#include "../vision/cameras/ReplayCam.h"
+#include "../vision/cameras/SyntheticCam.h"
 
 /******************************************************************************
  * @brief Construct a new Camera Handler Thread:: Camera Handler Thread object.
@@ -19,130 +22,305 @@
  ******************************************************************************/
 CameraHandler::CameraHandler()
 {
-    // Initialize left drive camera.
-    m_pDriveCamLeft = new BasicCam(constants::BASICCAM_DRIVECAMLEFT_INDEX,
-                                   constants::BASICCAM_DRIVECAMLEFT_RESOLUTIONX,
-                                   constants::BASICCAM_DRIVECAMLEFT_RESOLUTIONY,
-                                   constants::BASICCAM_DRIVECAMLEFT_FPS,
-                                   constants::BASICCAM_DRIVECAMLEFT_PIXELTYPE,
-                                   constants::BASICCAM_DRIVECAMLEFT_HORIZONTAL_FOV,
-                                   constants::BASICCAM_DRIVECAMLEFT_VERTICAL_FOV,
-                                   constants::BASICCAM_DRIVECAMLEFT_ENABLE_RECORDING,
-                                   constants::BASICCAM_DRIVECAMLEFT_FRAME_RETRIEVAL_THREADS);
-
-    // Initialize right drive camera.
-    m_pDriveCamRight = new BasicCam(constants::BASICCAM_DRIVECAMRIGHT_INDEX,
-                                    constants::BASICCAM_DRIVECAMRIGHT_RESOLUTIONX,
-                                    constants::BASICCAM_DRIVECAMRIGHT_RESOLUTIONY,
-                                    constants::BASICCAM_DRIVECAMRIGHT_FPS,
-                                    constants::BASICCAM_DRIVECAMRIGHT_PIXELTYPE,
-                                    constants::BASICCAM_DRIVECAMRIGHT_HORIZONTAL_FOV,
-                                    constants::BASICCAM_DRIVECAMRIGHT_VERTICAL_FOV,
-                                    constants::BASICCAM_DRIVECAMRIGHT_ENABLE_RECORDING,
-                                    constants::BASICCAM_DRIVECAMRIGHT_FRAME_RETRIEVAL_THREADS);
-
-    // Initialize left gimbal camera.
-    m_pGimbalCamLeft = new BasicCam(constants::BASICCAM_GIMBALCAMLEFT_INDEX,
-                                    constants::BASICCAM_GIMBALCAMLEFT_RESOLUTIONX,
-                                    constants::BASICCAM_GIMBALCAMLEFT_RESOLUTIONY,
-                                    constants::BASICCAM_GIMBALCAMLEFT_FPS,
-                                    constants::BASICCAM_GIMBALCAMLEFT_PIXELTYPE,
-                                    constants::BASICCAM_GIMBALCAMLEFT_HORIZONTAL_FOV,
-                                    constants::BASICCAM_GIMBALCAMLEFT_VERTICAL_FOV,
-                                    constants::BASICCAM_GIMBALCAMLEFT_ENABLE_RECORDING,
-                                    constants::BASICCAM_GIMBALCAMLEFT_FRAME_RETRIEVAL_THREADS);
-
-    // Initialize right gimbal camera.
-    m_pGimbalCamRight = new BasicCam(constants::BASICCAM_GIMBALCAMRIGHT_INDEX,
-                                     constants::BASICCAM_GIMBALCAMRIGHT_RESOLUTIONX,
-                                     constants::BASICCAM_GIMBALCAMRIGHT_RESOLUTIONY,
-                                     constants::BASICCAM_GIMBALCAMRIGHT_FPS,
-                                     constants::BASICCAM_GIMBALCAMRIGHT_PIXELTYPE,
-                                     constants::BASICCAM_GIMBALCAMRIGHT_HORIZONTAL_FOV,
-                                     constants::BASICCAM_GIMBALCAMRIGHT_VERTICAL_FOV,
-                                     constants::BASICCAM_GIMBALCAMRIGHT_ENABLE_RECORDING,
-                                     constants::BASICCAM_GIMBALCAMRIGHT_FRAME_RETRIEVAL_THREADS);
-
-    // Initialize back camera.
-    m_pBackCam = new BasicCam(constants::BASICCAM_BACKCAM_INDEX,
-                              constants::BASICCAM_BACKCAM_RESOLUTIONX,
-                              constants::BASICCAM_BACKCAM_RESOLUTIONY,
-                              constants::BASICCAM_BACKCAM_FPS,
-                              constants::BASICCAM_BACKCAM_PIXELTYPE,
-                              constants::BASICCAM_BACKCAM_HORIZONTAL_FOV,
-                              constants::BASICCAM_BACKCAM_VERTICAL_FOV,
-                              constants::BASICCAM_BACKCAM_ENABLE_RECORDING,
-                              constants::BASICCAM_BACKCAM_FRAME_RETRIEVAL_THREADS);
-
-    // Initialize auxiliary camera 1.
-    m_pAuxCamera1 = new BasicCam(constants::BASICCAM_AUXCAM1_INDEX,
-                                 constants::BASICCAM_AUXCAM1_RESOLUTIONX,
-                                 constants::BASICCAM_AUXCAM1_RESOLUTIONY,
-                                 constants::BASICCAM_AUXCAM1_FPS,
-                                 constants::BASICCAM_AUXCAM1_PIXELTYPE,
-                                 constants::BASICCAM_AUXCAM1_HORIZONTAL_FOV,
-                                 constants::BASICCAM_AUXCAM1_VERTICAL_FOV,
-                                 constants::BASICCAM_AUXCAM1_ENABLE_RECORDING,
-                                 constants::BASICCAM_AUXCAM1_FRAME_RETRIEVAL_THREADS);
-
-    // Initialize auxiliary camera 2.
-    m_pAuxCamera2 = new BasicCam(constants::BASICCAM_AUXCAM2_INDEX,
-                                 constants::BASICCAM_AUXCAM2_RESOLUTIONX,
-                                 constants::BASICCAM_AUXCAM2_RESOLUTIONY,
-                                 constants::BASICCAM_AUXCAM2_FPS,
-                                 constants::BASICCAM_AUXCAM2_PIXELTYPE,
-                                 constants::BASICCAM_AUXCAM2_HORIZONTAL_FOV,
-                                 constants::BASICCAM_AUXCAM2_VERTICAL_FOV,
-                                 constants::BASICCAM_AUXCAM2_ENABLE_RECORDING,
-                                 constants::BASICCAM_AUXCAM2_FRAME_RETRIEVAL_THREADS);
-
-    // Initialize auxiliary camera 3.
-    m_pAuxCamera3 = new BasicCam(constants::BASICCAM_AUXCAM3_INDEX,
-                                 constants::BASICCAM_AUXCAM3_RESOLUTIONX,
-                                 constants::BASICCAM_AUXCAM3_RESOLUTIONY,
-                                 constants::BASICCAM_AUXCAM3_FPS,
-                                 constants::BASICCAM_AUXCAM3_PIXELTYPE,
-                                 constants::BASICCAM_AUXCAM3_HORIZONTAL_FOV,
-                                 constants::BASICCAM_AUXCAM3_VERTICAL_FOV,
-                                 constants::BASICCAM_AUXCAM3_ENABLE_RECORDING,
-                                 constants::BASICCAM_AUXCAM3_FRAME_RETRIEVAL_THREADS);
-
-    // Initialize auxiliary camera 4.
-    m_pAuxCamera4 = new BasicCam(constants::BASICCAM_AUXCAM4_INDEX,
-                                 constants::BASICCAM_AUXCAM4_RESOLUTIONX,
-                                 constants::BASICCAM_AUXCAM4_RESOLUTIONY,
-                                 constants::BASICCAM_AUXCAM4_FPS,
-                                 constants::BASICCAM_AUXCAM4_PIXELTYPE,
-                                 constants::BASICCAM_AUXCAM4_HORIZONTAL_FOV,
-                                 constants::BASICCAM_AUXCAM4_VERTICAL_FOV,
-                                 constants::BASICCAM_AUXCAM4_ENABLE_RECORDING,
-                                 constants::BASICCAM_AUXCAM4_FRAME_RETRIEVAL_THREADS);
-
-    // Initialize microscope camera.
-    m_pMicroscope = new BasicCam(constants::BASICCAM_MICROSCOPE_INDEX,
-                                 constants::BASICCAM_MICROSCOPE_RESOLUTIONX,
-                                 constants::BASICCAM_MICROSCOPE_RESOLUTIONY,
-                                 constants::BASICCAM_MICROSCOPE_FPS,
-                                 constants::BASICCAM_MICROSCOPE_PIXELTYPE,
-                                 constants::BASICCAM_MICROSCOPE_HORIZONTAL_FOV,
-                                 constants::BASICCAM_MICROSCOPE_VERTICAL_FOV,
-                                 constants::BASICCAM_MICROSCOPE_ENABLE_RECORDING,
-                                 constants::BASICCAM_MICROSCOPE_FRAME_RETRIEVAL_THREADS);
+    // The constants of each camera, its stream, and its watchdog entry.
+    const std::vector<BasicCamSetup> vBasicCamSetups = {
+        {&m_pDriveCamLeft,
+         &m_pDriveCamLeftStream,
+         "DriveCamLeft",
+         constants::BASICCAM_DRIVECAMLEFT_INDEX,
+         constants::BASICCAM_DRIVECAMLEFT_RESOLUTIONX,
+         constants::BASICCAM_DRIVECAMLEFT_RESOLUTIONY,
+         constants::BASICCAM_DRIVECAMLEFT_FPS,
+         constants::BASICCAM_DRIVECAMLEFT_PIXELTYPE,
+         constants::BASICCAM_DRIVECAMLEFT_HORIZONTAL_FOV,
+         constants::BASICCAM_DRIVECAMLEFT_VERTICAL_FOV,
+         constants::BASICCAM_DRIVECAMLEFT_ENABLE_RECORDING,
+         constants::BASICCAM_DRIVECAMLEFT_FRAME_RETRIEVAL_THREADS,
+         {constants::BASICCAM_DRIVECAMLEFT_ROTATION,
+          constants::BASICCAM_DRIVECAMLEFT_FLIP_HORIZONTAL,
+          constants::BASICCAM_DRIVECAMLEFT_FLIP_VERTICAL,
+          constants::BASICCAM_DRIVECAMLEFT_CROP},
+         constants::BASICCAM_DRIVECAMLEFT_CALIBRATION_FILE,
+         constants::BASICCAM_DRIVECAMLEFT_PRIORITY,
+         constants::BASICCAM_DRIVECAMLEFT_CPU_AFFINITY,
+         "239.0.0.1",
+         constants::BASICCAM_DRIVECAMLEFT_STREAM_PRIORITY,
+         constants::BASICCAM_DRIVECAMLEFT_STALL_TIMEOUT},
+        {&m_pDriveCamRight,
+         &m_pDriveCamRightStream,
+         "DriveCamRight",
+         constants::BASICCAM_DRIVECAMRIGHT_INDEX,
+         constants::BASICCAM_DRIVECAMRIGHT_RESOLUTIONX,
+         constants::BASICCAM_DRIVECAMRIGHT_RESOLUTIONY,
+         constants::BASICCAM_DRIVECAMRIGHT_FPS,
+         constants::BASICCAM_DRIVECAMRIGHT_PIXELTYPE,
+         constants::BASICCAM_DRIVECAMRIGHT_HORIZONTAL_FOV,
+         constants::BASICCAM_DRIVECAMRIGHT_VERTICAL_FOV,
+         constants::BASICCAM_DRIVECAMRIGHT_ENABLE_RECORDING,
+         constants::BASICCAM_DRIVECAMRIGHT_FRAME_RETRIEVAL_THREADS,
+         {constants::BASICCAM_DRIVECAMRIGHT_ROTATION,
+          constants::BASICCAM_DRIVECAMRIGHT_FLIP_HORIZONTAL,
+          constants::BASICCAM_DRIVECAMRIGHT_FLIP_VERTICAL,
+          constants::BASICCAM_DRIVECAMRIGHT_CROP},
+         constants::BASICCAM_DRIVECAMRIGHT_CALIBRATION_FILE,
+         constants::BASICCAM_DRIVECAMRIGHT_PRIORITY,
+         constants::BASICCAM_DRIVECAMRIGHT_CPU_AFFINITY,
+         "239.0.0.2",
+         constants::BASICCAM_DRIVECAMRIGHT_STREAM_PRIORITY,
+         constants::BASICCAM_DRIVECAMRIGHT_STALL_TIMEOUT},
+        {&m_pGimbalCamLeft,
+         &m_pGimbalCamLeftStream,
+         "GimbalCamLeft",
+         constants::BASICCAM_GIMBALCAMLEFT_INDEX,
+         constants::BASICCAM_GIMBALCAMLEFT_RESOLUTIONX,
+         constants::BASICCAM_GIMBALCAMLEFT_RESOLUTIONY,
+         constants::BASICCAM_GIMBALCAMLEFT_FPS,
+         constants::BASICCAM_GIMBALCAMLEFT_PIXELTYPE,
+         constants::BASICCAM_GIMBALCAMLEFT_HORIZONTAL_FOV,
+         constants::BASICCAM_GIMBALCAMLEFT_VERTICAL_FOV,
+         constants::BASICCAM_GIMBALCAMLEFT_ENABLE_RECORDING,
+         constants::BASICCAM_GIMBALCAMLEFT_FRAME_RETRIEVAL_THREADS,
+         {constants::BASICCAM_GIMBALCAMLEFT_ROTATION,
+          constants::BASICCAM_GIMBALCAMLEFT_FLIP_HORIZONTAL,
+          constants::BASICCAM_GIMBALCAMLEFT_FLIP_VERTICAL,
+          constants::BASICCAM_GIMBALCAMLEFT_CROP},
+         constants::BASICCAM_GIMBALCAMLEFT_CALIBRATION_FILE,
+         constants::BASICCAM_GIMBALCAMLEFT_PRIORITY,
+         constants::BASICCAM_GIMBALCAMLEFT_CPU_AFFINITY,
+         "239.0.0.3",
+         constants::BASICCAM_GIMBALCAMLEFT_STREAM_PRIORITY,
+         constants::BASICCAM_GIMBALCAMLEFT_STALL_TIMEOUT},
+        {&m_pGimbalCamRight,
+         &m_pGimbalCamRightStream,
+         "GimbalCamRight",
+         constants::BASICCAM_GIMBALCAMRIGHT_INDEX,
+         constants::BASICCAM_GIMBALCAMRIGHT_RESOLUTIONX,
+         constants::BASICCAM_GIMBALCAMRIGHT_RESOLUTIONY,
+         constants::BASICCAM_GIMBALCAMRIGHT_FPS,
+         constants::BASICCAM_GIMBALCAMRIGHT_PIXELTYPE,
+         constants::BASICCAM_GIMBALCAMRIGHT_HORIZONTAL_FOV,
+         constants::BASICCAM_GIMBALCAMRIGHT_VERTICAL_FOV,
+         constants::BASICCAM_GIMBALCAMRIGHT_ENABLE_RECORDING,
+         constants::BASICCAM_GIMBALCAMRIGHT_FRAME_RETRIEVAL_THREADS,
+         {constants::BASICCAM_GIMBALCAMRIGHT_ROTATION,
+          constants::BASICCAM_GIMBALCAMRIGHT_FLIP_HORIZONTAL,
+          constants::BASICCAM_GIMBALCAMRIGHT_FLIP_VERTICAL,
+          constants::BASICCAM_GIMBALCAMRIGHT_CROP},
+         constants::BASICCAM_GIMBALCAMRIGHT_CALIBRATION_FILE,
+         constants::BASICCAM_GIMBALCAMRIGHT_PRIORITY,
+         constants::BASICCAM_GIMBALCAMRIGHT_CPU_AFFINITY,
+         "239.0.0.4",
+         constants::BASICCAM_GIMBALCAMRIGHT_STREAM_PRIORITY,
+         constants::BASICCAM_GIMBALCAMRIGHT_STALL_TIMEOUT},
+        {&m_pBackCam,
+         &m_pBackCamStream,
+         "BackCam",
+         constants::BASICCAM_BACKCAM_INDEX,
+         constants::BASICCAM_BACKCAM_RESOLUTIONX,
+         constants::BASICCAM_BACKCAM_RESOLUTIONY,
+         constants::BASICCAM_BACKCAM_FPS,
+         constants::BASICCAM_BACKCAM_PIXELTYPE,
+         constants::BASICCAM_BACKCAM_HORIZONTAL_FOV,
+         constants::BASICCAM_BACKCAM_VERTICAL_FOV,
+         constants::BASICCAM_BACKCAM_ENABLE_RECORDING,
+         constants::BASICCAM_BACKCAM_FRAME_RETRIEVAL_THREADS,
+         {constants::BASICCAM_BACKCAM_ROTATION,
+          constants::BASICCAM_BACKCAM_FLIP_HORIZONTAL,
+          constants::BASICCAM_BACKCAM_FLIP_VERTICAL,
+          constants::BASICCAM_BACKCAM_CROP},
+         constants::BASICCAM_BACKCAM_CALIBRATION_FILE,
+         constants::BASICCAM_BACKCAM_PRIORITY,
+         constants::BASICCAM_BACKCAM_CPU_AFFINITY,
+         "239.0.0.5",
+         constants::BASICCAM_BACKCAM_STREAM_PRIORITY,
+         constants::BASICCAM_BACKCAM_STALL_TIMEOUT},
+        {&m_pAuxCamera1,
+         &m_pAuxCamera1Stream,
+         "AuxCamera1",
+         constants::BASICCAM_AUXCAM1_INDEX,
+         constants::BASICCAM_AUXCAM1_RESOLUTIONX,
+         constants::BASICCAM_AUXCAM1_RESOLUTIONY,
+         constants::BASICCAM_AUXCAM1_FPS,
+         constants::BASICCAM_AUXCAM1_PIXELTYPE,
+         constants::BASICCAM_AUXCAM1_HORIZONTAL_FOV,
+         constants::BASICCAM_AUXCAM1_VERTICAL_FOV,
+         constants::BASICCAM_AUXCAM1_ENABLE_RECORDING,
+         constants::BASICCAM_AUXCAM1_FRAME_RETRIEVAL_THREADS,
+         {constants::BASICCAM_AUXCAM1_ROTATION,
+          constants::BASICCAM_AUXCAM1_FLIP_HORIZONTAL,
+          constants::BASICCAM_AUXCAM1_FLIP_VERTICAL,
+          constants::BASICCAM_AUXCAM1_CROP},
+         constants::BASICCAM_AUXCAM1_CALIBRATION_FILE,
+         constants::BASICCAM_AUXCAM1_PRIORITY,
+         constants::BASICCAM_AUXCAM1_CPU_AFFINITY,
+         "239.0.0.6",
+         constants::BASICCAM_AUXCAM1_STREAM_PRIORITY,
+         constants::BASICCAM_AUXCAM1_STALL_TIMEOUT},
+        {&m_pAuxCamera2,
+         &m_pAuxCamera2Stream,
+         "AuxCamera2",
+         constants::BASICCAM_AUXCAM2_INDEX,
+         constants::BASICCAM_AUXCAM2_RESOLUTIONX,
+         constants::BASICCAM_AUXCAM2_RESOLUTIONY,
+         constants::BASICCAM_AUXCAM2_FPS,
+         constants::BASICCAM_AUXCAM2_PIXELTYPE,
+         constants::BASICCAM_AUXCAM2_HORIZONTAL_FOV,
+         constants::BASICCAM_AUXCAM2_VERTICAL_FOV,
+         constants::BASICCAM_AUXCAM2_ENABLE_RECORDING,
+         constants::BASICCAM_AUXCAM2_FRAME_RETRIEVAL_THREADS,
+         {constants::BASICCAM_AUXCAM2_ROTATION,
+          constants::BASICCAM_AUXCAM2_FLIP_HORIZONTAL,
+          constants::BASICCAM_AUXCAM2_FLIP_VERTICAL,
+          constants::BASICCAM_AUXCAM2_CROP},
+         constants::BASICCAM_AUXCAM2_CALIBRATION_FILE,
+         constants::BASICCAM_AUXCAM2_PRIORITY,
+         constants::BASICCAM_AUXCAM2_CPU_AFFINITY,
+         "239.0.0.7",
+         constants::BASICCAM_AUXCAM2_STREAM_PRIORITY,
+         constants::BASICCAM_AUXCAM2_STALL_TIMEOUT},
+        {&m_pAuxCamera3,
+         &m_pAuxCamera3Stream,
+         "AuxCamera3",
+         constants::BASICCAM_AUXCAM3_INDEX,
+         constants::BASICCAM_AUXCAM3_RESOLUTIONX,
+         constants::BASICCAM_AUXCAM3_RESOLUTIONY,
+         constants::BASICCAM_AUXCAM3_FPS,
+         constants::BASICCAM_AUXCAM3_PIXELTYPE,
+         constants::BASICCAM_AUXCAM3_HORIZONTAL_FOV,
+         constants::BASICCAM_AUXCAM3_VERTICAL_FOV,
+         constants::BASICCAM_AUXCAM3_ENABLE_RECORDING,
+         constants::BASICCAM_AUXCAM3_FRAME_RETRIEVAL_THREADS,
+         {constants::BASICCAM_AUXCAM3_ROTATION,
+          constants::BASICCAM_AUXCAM3_FLIP_HORIZONTAL,
+          constants::BASICCAM_AUXCAM3_FLIP_VERTICAL,
+          constants::BASICCAM_AUXCAM3_CROP},
+         constants::BASICCAM_AUXCAM3_CALIBRATION_FILE,
+         constants::BASICCAM_AUXCAM3_PRIORITY,
+         constants::BASICCAM_AUXCAM3_CPU_AFFINITY,
+         "239.0.0.8",
+         constants::BASICCAM_AUXCAM3_STREAM_PRIORITY,
+         constants::BASICCAM_AUXCAM3_STALL_TIMEOUT},
+        {&m_pAuxCamera4,
+         &m_pAuxCamera4Stream,
+         "AuxCamera4",
+         constants::BASICCAM_AUXCAM4_INDEX,
+         constants::BASICCAM_AUXCAM4_RESOLUTIONX,
+         constants::BASICCAM_AUXCAM4_RESOLUTIONY,
+         constants::BASICCAM_AUXCAM4_FPS,
+         constants::BASICCAM_AUXCAM4_PIXELTYPE,
+         constants::BASICCAM_AUXCAM4_HORIZONTAL_FOV,
+         constants::BASICCAM_AUXCAM4_VERTICAL_FOV,
+         constants::BASICCAM_AUXCAM4_ENABLE_RECORDING,
+         constants::BASICCAM_AUXCAM4_FRAME_RETRIEVAL_THREADS,
+         {constants::BASICCAM_AUXCAM4_ROTATION,
+          constants::BASICCAM_AUXCAM4_FLIP_HORIZONTAL,
+          constants::BASICCAM_AUXCAM4_FLIP_VERTICAL,
+          constants::BASICCAM_AUXCAM4_CROP},
+         constants::BASICCAM_AUXCAM4_CALIBRATION_FILE,
+         constants::BASICCAM_AUXCAM4_PRIORITY,
+         constants::BASICCAM_AUXCAM4_CPU_AFFINITY,
+         "239.0.0.9",
+         constants::BASICCAM_AUXCAM4_STREAM_PRIORITY,
+         constants::BASICCAM_AUXCAM4_STALL_TIMEOUT},
+        {&m_pMicroscope,
+         &m_pMicroscopeStream,
+         "Microscope",
+         constants::BASICCAM_MICROSCOPE_INDEX,
+         constants::BASICCAM_MICROSCOPE_RESOLUTIONX,
+         constants::BASICCAM_MICROSCOPE_RESOLUTIONY,
+         constants::BASICCAM_MICROSCOPE_FPS,
+         constants::BASICCAM_MICROSCOPE_PIXELTYPE,
+         constants::BASICCAM_MICROSCOPE_HORIZONTAL_FOV,
+         constants::BASICCAM_MICROSCOPE_VERTICAL_FOV,
+         constants::BASICCAM_MICROSCOPE_ENABLE_RECORDING,
+         constants::BASICCAM_MICROSCOPE_FRAME_RETRIEVAL_THREADS,
+         {constants::BASICCAM_MICROSCOPE_ROTATION,
+          constants::BASICCAM_MICROSCOPE_FLIP_HORIZONTAL,
+          constants::BASICCAM_MICROSCOPE_FLIP_VERTICAL,
+          constants::BASICCAM_MICROSCOPE_CROP},
+         constants::BASICCAM_MICROSCOPE_CALIBRATION_FILE,
+         constants::BASICCAM_MICROSCOPE_PRIORITY,
+         constants::BASICCAM_MICROSCOPE_CPU_AFFINITY,
+         "239.0.0.10",
+         constants::BASICCAM_MICROSCOPE_STREAM_PRIORITY,
+         constants::BASICCAM_MICROSCOPE_STALL_TIMEOUT}};
+    // Initialize each camera, and set its orientation and crop correction, lens calibration, and thread scheduling.
+    for (const BasicCamSetup& stBasicCamSetup : vBasicCamSetups)
+    {
+        this->SetupBasicCam(stBasicCamSetup);
+    }
+
+    // Check if there are more extra synthetic cameras than stream addresses for them.
+    if (constants::SYNTHETICCAM_COUNT > 254)
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger, "CameraHandler: Only 254 extra synthetic cameras can be streamed, {} were asked for.", constants::SYNTHETICCAM_COUNT);
+    }
+    // Initialize the extra synthetic cameras. They have no fixed slot, so they're kept in a list and set up like the left drive camera.
+    for (int nIter = 0; nIter < std::min(constants::SYNTHETICCAM_COUNT, 254); ++nIter)
+    {
+        BasicCam* pSyntheticCam =
+            new SyntheticCam(constants::SYNTHETICCAM_EXTRA_INDEX + nIter,
+                             constants::SYNTHETICCAM_PATTERN,
+                             constants::SYNTHETICCAM_NOISE_LEVEL,
+                             constants::SYNTHETICCAM_RESOLUTIONX > 0 ? constants::SYNTHETICCAM_RESOLUTIONX : constants::BASICCAM_DRIVECAMLEFT_RESOLUTIONX,
+                             constants::SYNTHETICCAM_RESOLUTIONY > 0 ? constants::SYNTHETICCAM_RESOLUTIONY : constants::BASICCAM_DRIVECAMLEFT_RESOLUTIONY,
+                             constants::SYNTHETICCAM_FPS > 0 ? constants::SYNTHETICCAM_FPS : constants::BASICCAM_DRIVECAMLEFT_FPS,
+                             constants::BASICCAM_DRIVECAMLEFT_HORIZONTAL_FOV,
+                             constants::BASICCAM_DRIVECAMLEFT_VERTICAL_FOV,
+                             constants::BASICCAM_DRIVECAMLEFT_ENABLE_RECORDING,
+                             constants::BASICCAM_DRIVECAMLEFT_FRAME_RETRIEVAL_THREADS);
+        pSyntheticCam->SetThreadPriority(constants::BASICCAM_DRIVECAMLEFT_PRIORITY, constants::BASICCAM_DRIVECAMLEFT_CPU_AFFINITY);
+        m_vExtraSyntheticCams.push_back(pSyntheticCam);
+    }
 
     // Initialize recording handler for cameras.
-    m_pRecordingHandler = new RecordingHandler(RecordingHandler::RecordingMode::eCameraHandler);
-
-    // Initialize streaming handlers for cameras.
-    m_pDriveCamLeftStream   = new FFmpegUDPCameraStreamer(m_pDriveCamLeft, "239.0.0.1", 50000);
-    m_pDriveCamRightStream  = new FFmpegUDPCameraStreamer(m_pDriveCamRight, "239.0.0.2", 50000);
-    m_pGimbalCamLeftStream  = new FFmpegUDPCameraStreamer(m_pGimbalCamLeft, "239.0.0.3", 50000);
-    m_pGimbalCamRightStream = new FFmpegUDPCameraStreamer(m_pGimbalCamRight, "239.0.0.4", 50000);
-    m_pBackCamStream        = new FFmpegUDPCameraStreamer(m_pBackCam, "239.0.0.5", 50000);
-    m_pAuxCamera1Stream     = new FFmpegUDPCameraStreamer(m_pAuxCamera1, "239.0.0.6", 50000);
-    m_pAuxCamera2Stream     = new FFmpegUDPCameraStreamer(m_pAuxCamera2, "239.0.0.7", 50000);
-    m_pAuxCamera3Stream     = new FFmpegUDPCameraStreamer(m_pAuxCamera3, "239.0.0.8", 50000);
-    m_pAuxCamera4Stream     = new FFmpegUDPCameraStreamer(m_pAuxCamera4, "239.0.0.9", 50000);
-    m_pMicroscopeStream     = new FFmpegUDPCameraStreamer(m_pMicroscope, "239.0.0.10", 50000);
+    m_pRecordingHandler = new RecordingHandler(RecordingHandler::RecordingMode::eCameraHandler, static_cast<int>(m_vExtraSyntheticCams.size()));
+    m_pRecordingHandler->SetThreadPriority(constants::RECORDER_PRIORITY, constants::RECORDER_CPU_AFFINITY);
+    // Hand each camera to the recording handler, so it hears about the camera opening and closing.
+    for (int nCamera = int(BasicCamName::BASICCAM_START) + 1; nCamera != int(BasicCamName::BASICCAM_END); ++nCamera)
+    {
+        m_pRecordingHandler->AddCamera(nCamera, this->GetBasicCam(static_cast<BasicCamName>(nCamera)));
+    }
+    // The extra synthetic cameras are numbered after the fixed ones.
+    for (size_t siIter = 0; siIter < m_vExtraSyntheticCams.size(); ++siIter)
+    {
+        m_pRecordingHandler->AddCamera(int(BasicCamName::BASICCAM_END) + static_cast<int>(siIter), m_vExtraSyntheticCams[siIter]);
+    }
+
+    // Initialize a stream for each camera, and set its priority class.
+    for (const BasicCamSetup& stBasicCamSetup : vBasicCamSetups)
+    {
+        *stBasicCamSetup.ppStream = new FFmpegUDPCameraStreamer(*stBasicCamSetup.ppCamera, stBasicCamSetup.szStreamAddress, 50000);
+        (*stBasicCamSetup.ppStream)->SetThreadPriority(stBasicCamSetup.eStreamPriority);
+    }
+    // Initialize a stream for each extra synthetic camera.
+    for (size_t siIter = 0; siIter < m_vExtraSyntheticCams.size(); ++siIter)
+    {
+        m_vExtraSyntheticCamStreams.push_back(new FFmpegUDPCameraStreamer(m_vExtraSyntheticCams[siIter], "239.0.1." + std::to_string(siIter + 1), 50000));
+        m_vExtraSyntheticCamStreams.back()->SetThreadPriority(constants::BASICCAM_DRIVECAMLEFT_STREAM_PRIORITY);
+    }
+
+    // Initialize watchdog for the camera, stream, and recording threads.
+    m_pWatchdogHandler = new WatchdogHandler();
+    m_pWatchdogHandler->SetThreadPriority(constants::WATCHDOG_PRIORITY);
+    // Watch each camera and its stream.
+    for (const BasicCamSetup& stBasicCamSetup : vBasicCamSetups)
+    {
+        this->WatchCamera(*stBasicCamSetup.ppCamera, *stBasicCamSetup.ppStream, stBasicCamSetup.szName, stBasicCamSetup.nStallTimeout);
+    }
+    for (size_t siIter = 0; siIter < m_vExtraSyntheticCams.size(); ++siIter)
+    {
+        this->WatchCamera(m_vExtraSyntheticCams[siIter],
+                          m_vExtraSyntheticCamStreams[siIter],
+                          "SyntheticCam" + m_vExtraSyntheticCams[siIter]->GetCameraLocation(),
+                          constants::BASICCAM_DRIVECAMLEFT_STALL_TIMEOUT);
+    }
+    // Only report the recording handler. It waits on camera frame copies, so it comes back once the camera it waits on is recovered.
+    RecordingHandler* pRecordingHandler = m_pRecordingHandler;
+    m_pWatchdogHandler->AddThread("RecordingHandler",
+                                  [pRecordingHandler]() { return pRecordingHandler->GetTimeSinceHeartbeat(); },
+                                  constants::WATCHDOG_RECORDER_STALL_TIMEOUT);
 }
 
 /******************************************************************************
@@ -156,6 +334,9 @@ CameraHandler::~CameraHandler()
     // Signal and wait for cameras to stop.
     this->StopAllCameras();
 
+    // Delete watchdog dynamic memory.
+    delete m_pWatchdogHandler;
+
     // Delete streams dynamic memory.
     delete m_pDriveCamLeftStream;
     delete m_pDriveCamRightStream;
@@ -167,6 +348,10 @@ CameraHandler::~CameraHandler()
     delete m_pAuxCamera3Stream;
     delete m_pAuxCamera4Stream;
     delete m_pMicroscopeStream;
+    for (FFmpegUDPCameraStreamer* pStream : m_vExtraSyntheticCamStreams)
+    {
+        delete pStream;
+    }
 
     // Delete recording handler dynamic memory.
     delete m_pRecordingHandler;
@@ -182,6 +367,10 @@ CameraHandler::~CameraHandler()
     delete m_pAuxCamera3;
     delete m_pAuxCamera4;
     delete m_pMicroscope;
+    for (BasicCam* pCamera : m_vExtraSyntheticCams)
+    {
+        delete pCamera;
+    }
 
     // Set streams dangling pointers to nullptr.
     m_pDriveCamLeftStream   = nullptr;
@@ -194,6 +383,10 @@ CameraHandler::~CameraHandler()
     m_pAuxCamera3Stream     = nullptr;
     m_pAuxCamera4Stream     = nullptr;
     m_pMicroscopeStream     = nullptr;
+    m_vExtraSyntheticCamStreams.clear();
+
+    // Set watchdog dangling pointer to nullptr.
+    m_pWatchdogHandler = nullptr;
 
     // Set recording handler dangling pointer to nullptr.
     m_pRecordingHandler = nullptr;
@@ -209,6 +402,140 @@ CameraHandler::~CameraHandler()
     m_pAuxCamera3     = nullptr;
     m_pAuxCamera4     = nullptr;
     m_pMicroscope     = nullptr;
+    m_vExtraSyntheticCams.clear();
+}
+
+/******************************************************************************
+ * @brief Create the camera at a video index. If synthetic cameras are enabled, a
+ *      SyntheticCam that generates frames is created in its place. Otherwise, if
+ *      recordings are being replayed and there is one for this camera, a ReplayCam
+ *      that plays it back is created in its place.
+ *
+ * @param nCameraIndex - The video index that the camera is connected on.
+ * @param nPropResolutionX - X res of camera.
+ * @param nPropResolutionY - Y res of camera.
+ * @param nPropFramesPerSecond - FPS camera is running at.
+ * @param ePropPixelFormat - The pixel layout/format of the image.
+ * @param dPropHorizontalFOV - The horizontal field of view.
+ * @param dPropVerticalFOV - The vertical field of view.
+ * @param bEnableRecordingFlag - Whether or not this camera should be recorded.
+ * @param nNumFrameRetrievalThreads - The number of threads to use for frame queueing and copying.
+ * @return BasicCam* - The new camera.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+BasicCam* CameraHandler::CreateBasicCam(const int nCameraIndex,
+                                        const int nPropResolutionX,
+                                        const int nPropResolutionY,
+                                        const int nPropFramesPerSecond,
+                                        const PIXEL_FORMATS ePropPixelFormat,
+                                        const double dPropHorizontalFOV,
+                                        const double dPropVerticalFOV,
+                                        const bool bEnableRecordingFlag,
+                                        const int nNumFrameRetrievalThreads)
+{
+    // Check if frames should be generated instead of using the cameras.
+    if (constants::SYNTHETICCAM_ENABLE)
+    {
+        return new SyntheticCam(nCameraIndex,
+                                constants::SYNTHETICCAM_PATTERN,
+                                constants::SYNTHETICCAM_NOISE_LEVEL,
+                                constants::SYNTHETICCAM_RESOLUTIONX > 0 ? constants::SYNTHETICCAM_RESOLUTIONX : nPropResolutionX,
+                                constants::SYNTHETICCAM_RESOLUTIONY > 0 ? constants::SYNTHETICCAM_RESOLUTIONY : nPropResolutionY,
+                                constants::SYNTHETICCAM_FPS > 0 ? constants::SYNTHETICCAM_FPS : nPropFramesPerSecond,
+                                dPropHorizontalFOV,
+                                dPropVerticalFOV,
+                                bEnableRecordingFlag,
+                                nNumFrameRetrievalThreads);
+    }
+
+    // Check if recordings should be played back instead of using the cameras.
+    if (!constants::REPLAYCAM_DIRECTORY.empty())
+    {
+        // Find this camera's recording.
+        std::string szRecordingPath = ReplayCam::FindRecording(constants::REPLAYCAM_DIRECTORY, nCameraIndex);
+        if (!szRecordingPath.empty())
+        {
+            return new ReplayCam(nCameraIndex,
+                                 szRecordingPath,
+                                 constants::REPLAYCAM_SPEED,
+                                 nPropResolutionX,
+                                 nPropResolutionY,
+                                 nPropFramesPerSecond,
+                                 dPropHorizontalFOV,
+                                 dPropVerticalFOV,
+                                 bEnableRecordingFlag,
+                                 nNumFrameRetrievalThreads);
+        }
+
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger, "CameraHandler: No recording of camera {} in {}. Using the camera instead.", nCameraIndex, constants::REPLAYCAM_DIRECTORY);
+    }
+
+    return new BasicCam(nCameraIndex,
+                        nPropResolutionX,
+                        nPropResolutionY,
+                        nPropFramesPerSecond,
+                        ePropPixelFormat,
+                        dPropHorizontalFOV,
+                        dPropVerticalFOV,
+                        bEnableRecordingFlag,
+                        nNumFrameRetrievalThreads);
+}
+
+/******************************************************************************
+ * @brief Create a camera from its constants, apply its orientation and crop
+ *      correction, load its lens calibration if it has one, and set the priority
+ *      class and CPUs of its threads.
+ *
+ * @param stBasicCamSetup - The camera's constants, and the member to store it in.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void CameraHandler::SetupBasicCam(const BasicCamSetup& stBasicCamSetup)
+{
+    // Create the camera.
+    *stBasicCamSetup.ppCamera = this->CreateBasicCam(stBasicCamSetup.nCameraIndex,
+                                                     stBasicCamSetup.nResolutionX,
+                                                     stBasicCamSetup.nResolutionY,
+                                                     stBasicCamSetup.nFramesPerSecond,
+                                                     stBasicCamSetup.ePixelFormat,
+                                                     stBasicCamSetup.dHorizontalFOV,
+                                                     stBasicCamSetup.dVerticalFOV,
+                                                     stBasicCamSetup.bEnableRecording,
+                                                     stBasicCamSetup.nFrameRetrievalThreads);
+    // Set orientation and crop correction.
+    (*stBasicCamSetup.ppCamera)->SetFrameTransform(stBasicCamSetup.stFrameTransform);
+    // Load lens calibration if there is one.
+    if (!stBasicCamSetup.szCalibrationFile.empty())
+    {
+        (*stBasicCamSetup.ppCamera)->LoadCalibration(stBasicCamSetup.szCalibrationFile);
+    }
+    // Set the priority class and CPUs of the camera's threads.
+    (*stBasicCamSetup.ppCamera)->SetThreadPriority(stBasicCamSetup.ePriority, stBasicCamSetup.unCPUAffinityMask);
+}
+
+/******************************************************************************
+ * @brief Add a camera and its stream to the watchdog. The camera is restarted on a
+ *      fresh capture if it stalls. The stream is only reported, since it waits on
+ *      frame copies from the camera and comes back once the camera does.
+ *
+ * @param pCamera - The camera to watch.
+ * @param pStream - The stream of the camera.
+ * @param szName - The name of the camera, used in log messages.
+ * @param nStallTimeout - How long in milliseconds the camera can go without finishing a frame before it's restarted.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void CameraHandler::WatchCamera(BasicCam* pCamera, FFmpegUDPCameraStreamer* pStream, const std::string& szName, const int nStallTimeout)
+{
+    // Watch the camera and restart it when it stalls.
+    m_pWatchdogHandler->AddThread(szName, [pCamera]() { return pCamera->GetTimeSinceHeartbeat(); }, nStallTimeout, [pCamera]() { return pCamera->RecoverFromStall(); });
+    // Only report the stream.
+    m_pWatchdogHandler->AddThread(szName + "Stream", [pStream]() { return pStream->GetTimeSinceHeartbeat(); }, constants::WATCHDOG_STREAM_STALL_TIMEOUT);
 }
 
 void CameraHandler::StartCameras(bool bDriveCamLeft,
@@ -220,7 +547,8 @@ void CameraHandler::StartCameras(bool bDriveCamLeft,
                                  bool bAuxCamera2,
                                  bool bAuxCamera3,
                                  bool bAuxCamera4,
-                                 bool bMicroscope)
+                                 bool bMicroscope,
+                                 bool bExtraSyntheticCams)
 {
     if (bDriveCamLeft)
     {
@@ -262,6 +590,30 @@ void CameraHandler::StartCameras(bool bDriveCamLeft,
     {
         m_pMicroscope->Start();
     }
+    if (bExtraSyntheticCams)
+    {
+        for (BasicCam* pCamera : m_vExtraSyntheticCams)
+        {
+            pCamera->Start();
+        }
+    }
+
+    // Check that each started camera got its priority class and CPUs.
+    std::vector<BasicCam*> vCameras = m_vExtraSyntheticCams;
+    for (int nCamera = int(BasicCamName::BASICCAM_START) + 1; nCamera != int(BasicCamName::BASICCAM_END); ++nCamera)
+    {
+        vCameras.push_back(this->GetBasicCam(static_cast<BasicCamName>(nCamera)));
+    }
+    for (BasicCam* pCamera : vCameras)
+    {
+        if (!pCamera->GetThreadSchedulingApplied())
+        {
+            // Submit logger message.
+            LOG_WARNING(logging::g_qSharedLogger,
+                        "CameraHandler: Could not set the thread priority or CPU affinity of camera {}. Raising priority needs CAP_SYS_NICE.",
+                        pCamera->GetCameraLocation());
+        }
+    }
 }
 
 /******************************************************************************
@@ -283,8 +635,9 @@ void CameraHandler::StartAllCameras()
  ******************************************************************************/
 void CameraHandler::StartRecording()
 {
-    // Start recording handler.
+    // Start recording handler and any camera recorders it has that were stopped.
     m_pRecordingHandler->Start();
+    m_pRecordingHandler->StartCameraRecorders();
 }
 
 /******************************************************************************
@@ -302,7 +655,8 @@ void CameraHandler::StartStreaming(bool bDriveCamLeft,
                                    bool bAuxCamera2,
                                    bool bAuxCamera3,
                                    bool bAuxCamera4,
-                                   bool bMicroscope)
+                                   bool bMicroscope,
+                                   bool bExtraSyntheticCams)
 {
     // Start streaming handlers.
     if (bDriveCamLeft)
@@ -345,6 +699,13 @@ void CameraHandler::StartStreaming(bool bDriveCamLeft,
     {
         m_pMicroscopeStream->Start();
     }
+    if (bExtraSyntheticCams)
+    {
+        for (FFmpegUDPCameraStreamer* pStream : m_vExtraSyntheticCamStreams)
+        {
+            pStream->Start();
+        }
+    }
 }
 
 void CameraHandler::StopCameras(bool bDriveCamLeft,
@@ -356,7 +717,8 @@ void CameraHandler::StopCameras(bool bDriveCamLeft,
                                 bool bAuxCamera2,
                                 bool bAuxCamera3,
                                 bool bAuxCamera4,
-                                bool bMicroscope)
+                                bool bMicroscope,
+                                bool bExtraSyntheticCams)
 {
     if (bDriveCamLeft)
     {
@@ -408,6 +770,28 @@ void CameraHandler::StopCameras(bool bDriveCamLeft,
         m_pMicroscope->RequestStop();
         m_pMicroscope->Join();
     }
+    if (bExtraSyntheticCams)
+    {
+        for (BasicCam* pCamera : m_vExtraSyntheticCams)
+        {
+            pCamera->RequestStop();
+            pCamera->Join();
+        }
+    }
+}
+
+/******************************************************************************
+ * @brief Signal the WatchdogHandler to start watching the camera, stream, and
+ *      recording threads for stalls. Threads that aren't running are ignored, so
+ *      it can be started before or after them.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void CameraHandler::StartWatchdog()
+{
+    // Start watchdog handler.
+    m_pWatchdogHandler->Start();
 }
 
 /******************************************************************************
@@ -418,6 +802,9 @@ void CameraHandler::StopCameras(bool bDriveCamLeft,
  ******************************************************************************/
 void CameraHandler::StopAllCameras()
 {
+    // Stop watchdog handler, so nothing is recovered while it stops.
+    StopWatchdog();
+
     // Stop streaming handlers.
     StopStreaming();
 
@@ -439,6 +826,8 @@ void CameraHandler::StopRecording()
     // Stop recording handler.
     m_pRecordingHandler->RequestStop();
     m_pRecordingHandler->Join();
+    // Stop camera recorders before the cameras, so none of them are left waiting on a frame copy.
+    m_pRecordingHandler->StopCameraRecorders();
 }
 
 void CameraHandler::StopStreaming(bool bDriveCamLeft,
@@ -450,7 +839,8 @@ void CameraHandler::StopStreaming(bool bDriveCamLeft,
                                   bool bAuxCamera2,
                                   bool bAuxCamera3,
                                   bool bAuxCamera4,
-                                  bool bMicroscope)
+                                  bool bMicroscope,
+                                  bool bExtraSyntheticCams)
 {
     // Stop streaming handlers.
     if (bDriveCamLeft)
@@ -503,6 +893,27 @@ void CameraHandler::StopStreaming(bool bDriveCamLeft,
         m_pMicroscopeStream->RequestStop();
         m_pMicroscopeStream->Join();
     }
+    if (bExtraSyntheticCams)
+    {
+        for (FFmpegUDPCameraStreamer* pStream : m_vExtraSyntheticCamStreams)
+        {
+            pStream->RequestStop();
+            pStream->Join();
+        }
+    }
+}
+
+/******************************************************************************
+ * @brief Signal the WatchdogHandler to stop watching for stalls.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void CameraHandler::StopWatchdog()
+{
+    // Stop watchdog handler.
+    m_pWatchdogHandler->RequestStop();
+    m_pWatchdogHandler->Join();
 }
 
 /******************************************************************************
@@ -551,3 +962,59 @@ FFmpegUDPCameraStreamer* CameraHandler::GetFFmpegUDPCameraStreamer(BasicCamName
         default: return m_pDriveCamLeftStream;
     }
 }
+
+/******************************************************************************
+ * @brief Accessor for the extra synthetic cameras added by SYNTHETICCAM_COUNT.
+ *
+ * @return const std::vector<BasicCam*>& - The extra synthetic cameras, in the order they're numbered after the fixed cameras.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+const std::vector<BasicCam*>& CameraHandler::GetExtraSyntheticCams() const
+{
+    // Return member variable value.
+    return m_vExtraSyntheticCams;
+}
+
+/******************************************************************************
+ * @brief Accessor for the streams of the extra synthetic cameras.
+ *
+ * @return const std::vector<FFmpegUDPCameraStreamer*>& - The streams, in the same order as GetExtraSyntheticCams().
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+const std::vector<FFmpegUDPCameraStreamer*>& CameraHandler::GetExtraSyntheticCamStreams() const
+{
+    // Return member variable value.
+    return m_vExtraSyntheticCamStreams;
+}
+
+/******************************************************************************
+ * @brief Accessor for the RecordingHandler.
+ *
+ * @return RecordingHandler* - A pointer to the handler recording the cameras.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+RecordingHandler* CameraHandler::GetRecordingHandler()
+{
+    // Return member variable value.
+    return m_pRecordingHandler;
+}
+
+/******************************************************************************
+ * @brief Accessor for the WatchdogHandler.
+ *
+ * @return WatchdogHandler* - A pointer to the handler watching the camera, stream, and recording threads for stalls.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+WatchdogHandler* CameraHandler::GetWatchdogHandler()
+{
+    // Return member variable value.
+    return m_pWatchdogHandler;
+}
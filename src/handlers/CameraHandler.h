@@ -14,9 +14,13 @@
 #include "../vision/cameras/BasicCam.h"
 #include "../vision/streamers/FFmpegUDPCameraStreamer.h"
 #include "RecordingHandler.h"
+#include "WatchdogHandler.h"
 
 /// \cond
+#include <cstdint>
 #include <opencv2/core.hpp>
+#include <string>
+#include <vector>
 
 /// \endcond
 
@@ -57,6 +61,50 @@ class CameraHandler
         FFmpegUDPCameraStreamer* m_pAuxCamera3Stream;
         FFmpegUDPCameraStreamer* m_pAuxCamera4Stream;
         FFmpegUDPCameraStreamer* m_pMicroscopeStream;
+        std::vector<BasicCam*> m_vExtraSyntheticCams;
+        std::vector<FFmpegUDPCameraStreamer*> m_vExtraSyntheticCamStreams;
+        WatchdogHandler* m_pWatchdogHandler;
+
+        // The constants of a camera, its stream, and its watchdog entry, and the members the camera and stream are stored in.
+        struct BasicCamSetup
+        {
+            public:
+                BasicCam** ppCamera;
+                FFmpegUDPCameraStreamer** ppStream;
+                std::string szName;
+                int nCameraIndex;
+                int nResolutionX;
+                int nResolutionY;
+                int nFramesPerSecond;
+                PIXEL_FORMATS ePixelFormat;
+                double dHorizontalFOV;
+                double dVerticalFOV;
+                bool bEnableRecording;
+                int nFrameRetrievalThreads;
+                conversions::FrameTransform stFrameTransform;
+                std::string szCalibrationFile;
+                THREAD_PRIORITIES ePriority;
+                uint64_t unCPUAffinityMask;
+                std::string szStreamAddress;
+                THREAD_PRIORITIES eStreamPriority;
+                int nStallTimeout;
+        };
+
+        /////////////////////////////////////////
+        // Declare private class methods.
+        /////////////////////////////////////////
+
+        BasicCam* CreateBasicCam(const int nCameraIndex,
+                                 const int nPropResolutionX,
+                                 const int nPropResolutionY,
+                                 const int nPropFramesPerSecond,
+                                 const PIXEL_FORMATS ePropPixelFormat,
+                                 const double dPropHorizontalFOV,
+                                 const double dPropVerticalFOV,
+                                 const bool bEnableRecordingFlag,
+                                 const int nNumFrameRetrievalThreads);
+        void SetupBasicCam(const BasicCamSetup& stBasicCamSetup);
+        void WatchCamera(BasicCam* pCamera, FFmpegUDPCameraStreamer* pStream, const std::string& szName, const int nStallTimeout);
 
     public:
         /////////////////////////////////////////
@@ -85,50 +133,56 @@ class CameraHandler
 
         CameraHandler();
         ~CameraHandler();
-        void StartCameras(bool bDriveCamLeft   = true,
-                          bool bDriveCamRight  = true,
-                          bool bGimbalCamLeft  = true,
-                          bool bGimbalCamRight = true,
-                          bool bBackCam        = true,
-                          bool bAuxCamera1     = true,
-                          bool bAuxCamera2     = true,
-                          bool bAuxCamera3     = true,
-                          bool bAuxCamera4     = true,
-                          bool bMicroscope     = true);
+        void StartCameras(bool bDriveCamLeft       = true,
+                          bool bDriveCamRight      = true,
+                          bool bGimbalCamLeft      = true,
+                          bool bGimbalCamRight     = true,
+                          bool bBackCam            = true,
+                          bool bAuxCamera1         = true,
+                          bool bAuxCamera2         = true,
+                          bool bAuxCamera3         = true,
+                          bool bAuxCamera4         = true,
+                          bool bMicroscope         = true,
+                          bool bExtraSyntheticCams = true);
         void StartAllCameras();
         void StartRecording();
-        void StartStreaming(bool bDriveCamLeft   = true,
-                            bool bDriveCamRight  = true,
-                            bool bGimbalCamLeft  = true,
-                            bool bGimbalCamRight = true,
-                            bool bBackCam        = true,
-                            bool bAuxCamera1     = true,
-                            bool bAuxCamera2     = true,
-                            bool bAuxCamera3     = true,
-                            bool bAuxCamera4     = true,
-                            bool bMicroscope     = true);
-        void StopCameras(bool bDriveCamLeft   = true,
-                         bool bDriveCamRight  = true,
-                         bool bGimbalCamLeft  = true,
-                         bool bGimbalCamRight = true,
-                         bool bBackCam        = true,
-                         bool bAuxCamera1     = true,
-                         bool bAuxCamera2     = true,
-                         bool bAuxCamera3     = true,
-                         bool bAuxCamera4     = true,
-                         bool bMicroscope     = true);
+        void StartStreaming(bool bDriveCamLeft       = true,
+                            bool bDriveCamRight      = true,
+                            bool bGimbalCamLeft      = true,
+                            bool bGimbalCamRight     = true,
+                            bool bBackCam            = true,
+                            bool bAuxCamera1         = true,
+                            bool bAuxCamera2         = true,
+                            bool bAuxCamera3         = true,
+                            bool bAuxCamera4         = true,
+                            bool bMicroscope         = true,
+                            bool bExtraSyntheticCams = true);
+        void StopCameras(bool bDriveCamLeft       = true,
+                         bool bDriveCamRight      = true,
+                         bool bGimbalCamLeft      = true,
+                         bool bGimbalCamRight     = true,
+                         bool bBackCam            = true,
+                         bool bAuxCamera1         = true,
+                         bool bAuxCamera2         = true,
+                         bool bAuxCamera3         = true,
+                         bool bAuxCamera4         = true,
+                         bool bMicroscope         = true,
+                         bool bExtraSyntheticCams = true);
+        void StartWatchdog();
         void StopAllCameras();
         void StopRecording();
-        void StopStreaming(bool bDriveCamLeft   = true,
-                           bool bDriveCamRight  = true,
-                           bool bGimbalCamLeft  = true,
-                           bool bGimbalCamRight = true,
-                           bool bBackCam        = true,
-                           bool bAuxCamera1     = true,
-                           bool bAuxCamera2     = true,
-                           bool bAuxCamera3     = true,
-                           bool bAuxCamera4     = true,
-                           bool bMicroscope     = true);
+        void StopStreaming(bool bDriveCamLeft       = true,
+                           bool bDriveCamRight      = true,
+                           bool bGimbalCamLeft      = true,
+                           bool bGimbalCamRight     = true,
+                           bool bBackCam            = true,
+                           bool bAuxCamera1         = true,
+                           bool bAuxCamera2         = true,
+                           bool bAuxCamera3         = true,
+                           bool bAuxCamera4         = true,
+                           bool bMicroscope         = true,
+                           bool bExtraSyntheticCams = true);
+        void StopWatchdog();
 
         /////////////////////////////////////////
         // Accessors.
@@ -136,6 +190,10 @@ class CameraHandler
 
         BasicCam* GetBasicCam(BasicCamName eCameraName);
         FFmpegUDPCameraStreamer* GetFFmpegUDPCameraStreamer(BasicCamName eCameraName);
+        const std::vector<BasicCam*>& GetExtraSyntheticCams() const;
+        const std::vector<FFmpegUDPCameraStreamer*>& GetExtraSyntheticCamStreams() const;
+        RecordingHandler* GetRecordingHandler();
+        WatchdogHandler* GetWatchdogHandler();
 };
 
 #endif    // CAMERA_HANDLER_H
@@ -14,7 +14,10 @@
 #include "../RoveSoCameraServerLogging.h"
 
 /// \cond
+#include <algorithm>
+#include <ctime>
 #include <filesystem>
+#include <unordered_set>
 
 /// \endcond
 
@@ -22,14 +25,21 @@
  * @brief Construct a new Recording Handler:: Recording Handler object.
  *
  * @param eRecordingMode - The mode the recorder should run in.
+ * @param nExtraVideoFeeds - The number of cameras numbered after the fixed ones, like extra synthetic cameras.
  *
  * @author Eli Byrd (edbgkk@mst.edu)
  * @date 2024-11-04
  ******************************************************************************/
-RecordingHandler::RecordingHandler(RecordingMode eRecordingMode)
+RecordingHandler::RecordingHandler(RecordingMode eRecordingMode, const int nExtraVideoFeeds)
 {
     // Initialize member variables.
-    m_eRecordingMode = eRecordingMode;
+    m_eRecordingMode           = eRecordingMode;
+    m_tmLastRetentionCheck     = std::chrono::steady_clock::now();
+    m_tmLastWriteStatisticsLog = std::chrono::steady_clock::now();
+    m_pGroupMuxer              = nullptr;
+    m_pRecordingTranscoder     = nullptr;
+    m_pRecordingRetention      = nullptr;
+    m_bRecordingEventsPending  = false;
     // Set max FPS of the ThreadedContinuousCode method.
     this->SetMainThreadIPSLimit(constants::RECORDER_FPS);
 
@@ -39,14 +49,25 @@ RecordingHandler::RecordingHandler(RecordingMode eRecordingMode)
         // RecordingHandler was initialized to record feeds from the CameraHandler.
         case RecordingMode::eCameraHandler:
             // Initialize member variables.
-            m_nTotalVideoFeeds = int(CameraHandler::BasicCamName::BASICCAM_END) - 1;
+            m_nTotalVideoFeeds = int(CameraHandler::BasicCamName::BASICCAM_END) - 1 + std::max(nExtraVideoFeeds, 0);
             // Resize member vectors to match number of total video feeds to record.
-            m_vBasicCameras.resize(m_nTotalVideoFeeds);
-            m_vCameraWriters.resize(m_nTotalVideoFeeds);
+            m_vBasicCameras.resize(m_nTotalVideoFeeds, nullptr);
+            m_vCameraRecorders.resize(m_nTotalVideoFeeds, nullptr);
+            m_vGroupTracks.resize(m_nTotalVideoFeeds, -1);
+            m_vEncoderSettings.resize(m_nTotalVideoFeeds,
+                                      {constants::RECORDER_CODEC,
+                                       constants::RECORDER_PRESET,
+                                       constants::RECORDER_CRF,
+                                       constants::RECORDER_BITRATE,
+                                       constants::RECORDER_ENCODER_THREADS,
+                                       constants::RECORDER_FPS,
+                                       constants::RECORDER_GOP_SIZE});
             m_vRecordingToggles.resize(m_nTotalVideoFeeds);
-            m_vFrames.resize(m_nTotalVideoFeeds);
+            m_vRecordingEnabled.resize(m_nTotalVideoFeeds, false);
+            m_vCameraIsOpen.resize(m_nTotalVideoFeeds, false);
+            m_vRecordingTakes.resize(m_nTotalVideoFeeds, 0);
+            m_vLastEncodeCPUTimes.resize(m_nTotalVideoFeeds, std::chrono::nanoseconds(0));
             m_vGPUFrames.resize(m_nTotalVideoFeeds);
-            m_vFrameFutures.resize(m_nTotalVideoFeeds);
             break;
 
         default:
@@ -63,22 +84,177 @@ RecordingHandler::RecordingHandler(RecordingMode eRecordingMode)
  ******************************************************************************/
 RecordingHandler::~RecordingHandler()
 {
+    // Stop the cameras from publishing events to this handler.
+    for (BasicCam* pBasicCamera : m_vBasicCameras)
+    {
+        if (pBasicCamera != nullptr)
+        {
+            pBasicCamera->SetCameraStateCallback(nullptr);
+        }
+    }
+
     // Signal and wait for recording thread to stop.
     this->RequestStop();
     this->Join();
+    // Stop re-encoding. A segment that was being re-encoded is left as it was.
+    delete m_pRecordingTranscoder;
+    m_pRecordingTranscoder = nullptr;
+    // Stop deleting old segments.
+    delete m_pRecordingRetention;
+    m_pRecordingRetention = nullptr;
+
+    // Loop through and stop camera recorders. This also closes their video writers.
+    std::lock_guard<std::mutex> lkCameraRecordersLock(m_muCameraRecordersMutex);
+    for (CameraRecorder*& pCameraRecorder : m_vCameraRecorders)
+    {
+        // Delete camera recorder dynamic memory.
+        delete pCameraRecorder;
+        pCameraRecorder = nullptr;
+    }
+    // Finish the group recording once none of its recorders are writing to it.
+    delete m_pGroupMuxer;
+    m_pGroupMuxer = nullptr;
+}
+
+/******************************************************************************
+ * @brief Give the handler a camera to record. Recording starts if the camera has
+ *      recording enabled, and then follows the camera as it closes and reopens. Must
+ *      be called for each camera before the handler is started.
+ *
+ * @param nCamera - The camera, as a CameraHandler::BasicCamName value, or BASICCAM_END and up for extra cameras.
+ * @param pBasicCamera - A pointer to the camera. Must outlive this handler.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingHandler::AddCamera(const int nCamera, BasicCam* pBasicCamera)
+{
+    // Check that the camera is valid.
+    if (nCamera < 1 || nCamera > m_nTotalVideoFeeds || pBasicCamera == nullptr)
+    {
+        // Submit logger message.
+        LOG_ERROR(logging::g_qSharedLogger, "RecordingHandler: Can't add camera {}, it doesn't exist!", nCamera);
+        return;
+    }
+
+    // Store camera pointer in vector so we can get images later.
+    m_vBasicCameras[nCamera - 1]     = pBasicCamera;
+    m_vRecordingEnabled[nCamera - 1] = pBasicCamera->GetEnableRecordingFlag();
+
+    // Publish an event whenever the camera opens or closes. This is called right away with the current state.
+    pBasicCamera->SetCameraStateCallback([this, nCamera](const bool bCameraIsOpen)
+                                         { this->PublishRecordingEvent(bCameraIsOpen ? RecordingEventType::eCameraOpened : RecordingEventType::eCameraClosed, nCamera); });
+}
+
+/******************************************************************************
+ * @brief Save the instant replay of a camera, or of every camera, to the events
+ *      folder of this run. The history from before the trigger and the next
+ *      RECORDER_REPLAY_POST_EVENT seconds are saved in the background.
+ *
+ * @param nCamera - The camera to save, as a CameraHandler::BasicCamName value. BASICCAM_START saves every camera.
+ * @return true - At least one camera started saving.
+ * @return false - No camera had a replay to save.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool RecordingHandler::TriggerReplay(const int nCamera)
+{
+    // Assemble the events directory.
+    std::filesystem::path szFilePath = constants::LOGGING_OUTPUT_PATH_ABSOLUTE;
+    szFilePath += logging::g_szProgramStartTimeString + "/events";
+    std::error_code errCode;
+    std::filesystem::create_directories(szFilePath, errCode);
+    if (errCode)
+    {
+        // Submit logger message.
+        LOG_ERROR(logging::g_qSharedLogger, "Unable to create the event output directory: {}", szFilePath.string());
+        return false;
+    }
 
-    // Loop through and close video writers.
-    for (cv::VideoWriter cvCameraWriter : m_vCameraWriters)
+    // Name the event after the time it was triggered.
+    char aTimeString[32];
+    std::time_t tmNow = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::strftime(aTimeString, sizeof(aTimeString), "%Y%m%d-%H%M%S", std::localtime(&tmNow));
+
+    // Loop through camera recorders.
+    bool bTriggered = false;
+    std::lock_guard<std::mutex> lkCameraRecordersLock(m_muCameraRecordersMutex);
+    for (int nIter = 0; nIter < static_cast<int>(m_vCameraRecorders.size()); ++nIter)
+    {
+        // Check if this camera was asked for and is being recorded.
+        if ((nCamera != 0 && nCamera - 1 != nIter) || m_vCameraRecorders[nIter] == nullptr)
+        {
+            continue;
+        }
+
+        // Start saving the event.
+        std::filesystem::path szFullOutputPath = szFilePath / (m_vBasicCameras[nIter]->GetCameraLocation() + "_" + aTimeString + ".mkv");
+        if (m_vCameraRecorders[nIter]->TriggerReplay(szFullOutputPath.string(), constants::RECORDER_REPLAY_POST_EVENT))
+        {
+            bTriggered = true;
+            // Submit logger message.
+            LOG_INFO(logging::g_qSharedLogger, "RecordingHandler: Saving replay of camera {} to {}", m_vBasicCameras[nIter]->GetCameraLocation(), szFullOutputPath.string());
+        }
+    }
+
+    return bTriggered;
+}
+
+/******************************************************************************
+ * @brief Start the thread of every camera recorder that is stopped. Recorders stopped
+ *      by StopCameraRecorders() pick up where they left off. Running recorders are left
+ *      alone, since starting a running thread restarts it.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingHandler::StartCameraRecorders()
+{
+    // Loop through camera recorders and start the stopped ones.
+    std::lock_guard<std::mutex> lkCameraRecordersLock(m_muCameraRecordersMutex);
+    for (CameraRecorder* pCameraRecorder : m_vCameraRecorders)
     {
-        // Release video writer.
-        cvCameraWriter.release();
+        if (pCameraRecorder != nullptr && pCameraRecorder->GetThreadState() == AutonomyThreadState::eStopped)
+        {
+            pCameraRecorder->Start();
+        }
+    }
+}
+
+/******************************************************************************
+ * @brief Stop the thread of every camera recorder and wait for them to finish.
+ *      This must be called before the cameras are stopped, since a recorder
+ *      waits on frame copies from its camera.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingHandler::StopCameraRecorders()
+{
+    // Signal every recorder first so they all wind down at the same time.
+    std::lock_guard<std::mutex> lkCameraRecordersLock(m_muCameraRecordersMutex);
+    for (CameraRecorder* pCameraRecorder : m_vCameraRecorders)
+    {
+        if (pCameraRecorder != nullptr)
+        {
+            pCameraRecorder->RequestStop();
+        }
+    }
+    // Wait for each recorder to finish its current frame.
+    for (CameraRecorder* pCameraRecorder : m_vCameraRecorders)
+    {
+        if (pCameraRecorder != nullptr)
+        {
+            pCameraRecorder->Join();
+        }
     }
 }
 
 /******************************************************************************
  * @brief This code will run continuously in a separate thread. New frames from
- *      the cameras that have recording enabled are grabbed and the images are
- *      written to the filesystem.
+ *      the cameras that have recording enabled are scheduled on each camera's
+ *      recorder, which writes them to the filesystem in its own thread.
  *
  * @author Eli Byrd (edbgkk@mst.edu)
  * @date 2024-11-04
@@ -90,10 +266,32 @@ void RecordingHandler::ThreadedContinuousCode()
     {
         // Record video feeds from the CameraHandler.
         case RecordingMode::eCameraHandler:
-            // Update recordable cameras.
-            this->UpdateRecordableCameras();
-            // Grab and write frames to VideoWriters.
-            this->RequestAndWriteCameraFrames();
+            // Open the camera group recording the first time through, so every camera in it gets a track from the start.
+            if (constants::RECORDER_ENABLE_CAMERA_GROUP && m_pGroupMuxer == nullptr)
+            {
+                this->OpenCameraGroup();
+            }
+            // Apply camera and recording changes only when there are some.
+            if (m_bRecordingEventsPending.load(std::memory_order_acquire))
+            {
+                this->ProcessRecordingEvents();
+            }
+            // Schedule frames on the camera recorders.
+            this->ScheduleCameraFrames();
+            // Check if it's time to enforce the recording disk budget and look for segments to re-encode.
+            if (std::chrono::steady_clock::now() - m_tmLastRetentionCheck >= std::chrono::seconds(constants::RECORDER_RETENTION_CHECK_INTERVAL))
+            {
+                // Hand the open files to the background threads that do the scanning.
+                this->UpdateRecordingMaintenance();
+                m_tmLastRetentionCheck = std::chrono::steady_clock::now();
+            }
+            // Check if it's time to report how storage is keeping up.
+            if (std::chrono::steady_clock::now() - m_tmLastWriteStatisticsLog >= std::chrono::seconds(constants::RECORDER_WRITE_STATISTICS_INTERVAL))
+            {
+                // Log disk write statistics.
+                this->LogWriteStatistics();
+                m_tmLastWriteStatisticsLog = std::chrono::steady_clock::now();
+            }
             break;
 
         // Shutdown recording handler.
@@ -118,132 +316,481 @@ void RecordingHandler::ThreadedContinuousCode()
 void RecordingHandler::PooledLinearCode() {}
 
 /******************************************************************************
- * @brief This method is used internally by the class to update the number of cameras
- *      that have recording enabled from the camera handler.
+ * @brief Turn recording of a camera, or of every camera, on or off while running.
+ *      Turning a camera off finishes its recording file, and turning it back on starts
+ *      a new one. Cameras in the camera group recording keep their track, which just
+ *      has a gap while they are off. The change is applied by the recording thread.
+ *
+ * @param nCamera - The camera, as a CameraHandler::BasicCamName value. BASICCAM_START sets every camera.
+ * @param bEnable - Whether the camera should be recorded.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingHandler::SetCameraRecording(const int nCamera, const bool bEnable)
+{
+    // Loop through cameras.
+    for (int nIter = 1; nIter <= m_nTotalVideoFeeds; ++nIter)
+    {
+        // Check if this camera was asked for.
+        if (nCamera == 0 || nCamera == nIter)
+        {
+            this->PublishRecordingEvent(bEnable ? RecordingEventType::eRecordingEnabled : RecordingEventType::eRecordingDisabled, nIter);
+        }
+    }
+}
+
+/******************************************************************************
+ * @brief Queue a change to a camera for the recording thread. Safe to call from any
+ *      thread, including the camera threads.
+ *
+ * @param eType - What changed.
+ * @param nCamera - The camera, as a CameraHandler::BasicCamName value.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingHandler::PublishRecordingEvent(const RecordingEventType eType, const int nCamera)
+{
+    // Acquire lock on the event queue.
+    std::lock_guard<std::mutex> lkRecordingEventsLock(m_muRecordingEventsMutex);
+    // Queue the event and let the recording thread know.
+    m_vRecordingEvents.push_back({eType, nCamera});
+    m_bRecordingEventsPending.store(true, std::memory_order_release);
+}
+
+/******************************************************************************
+ * @brief This method is used internally by the class to apply the queued camera and
+ *      recording changes, in the order they happened.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingHandler::ProcessRecordingEvents()
+{
+    // Take the queued events, so publishers aren't held up while recorders are opened and closed.
+    std::vector<RecordingEvent> vRecordingEvents;
+    std::unique_lock<std::mutex> lkRecordingEventsLock(m_muRecordingEventsMutex);
+    vRecordingEvents.swap(m_vRecordingEvents);
+    m_bRecordingEventsPending.store(false, std::memory_order_release);
+    lkRecordingEventsLock.unlock();
+
+    // Loop through the events.
+    for (const RecordingEvent& stEvent : vRecordingEvents)
+    {
+        // Skip cameras that were never added.
+        if (stEvent.nCamera < 1 || stEvent.nCamera > m_nTotalVideoFeeds || m_vBasicCameras[stEvent.nCamera - 1] == nullptr)
+        {
+            continue;
+        }
+
+        // Update the camera's state.
+        switch (stEvent.eType)
+        {
+            case RecordingEventType::eCameraOpened: m_vCameraIsOpen[stEvent.nCamera - 1] = true; break;
+            case RecordingEventType::eCameraClosed: m_vCameraIsOpen[stEvent.nCamera - 1] = false; break;
+            case RecordingEventType::eRecordingEnabled: m_vRecordingEnabled[stEvent.nCamera - 1] = true; break;
+            case RecordingEventType::eRecordingDisabled: m_vRecordingEnabled[stEvent.nCamera - 1] = false; break;
+        }
+        // Start, pause, or stop its recorder to match.
+        this->UpdateCameraRecorder(stEvent.nCamera);
+    }
+}
+
+/******************************************************************************
+ * @brief This method is used internally by the class to start, pause, or stop the
+ *      recorder of a camera after its state changed. A camera is recorded while it is
+ *      open and has recording enabled.
+ *
+ * @param nCamera - The camera, as a CameraHandler::BasicCamName value.
  *
  * @author Eli Byrd (edbgkk@mst.edu)
  * @date 2024-11-04
  ******************************************************************************/
-void RecordingHandler::UpdateRecordableCameras()
+void RecordingHandler::UpdateCameraRecorder(const int nCamera)
 {
-    // Loop through all Basic cameras from the CameraHandler.
-    for (int nCamera = int(CameraHandler::BasicCamName::BASICCAM_START) + 1; nCamera != int(CameraHandler::BasicCamName::BASICCAM_END); ++nCamera)
+    // Get pointer to camera.
+    BasicCam* pBasicCamera = m_vBasicCameras[nCamera - 1];
+
+    // Check if this camera should be recorded.
+    if (m_vRecordingEnabled[nCamera - 1] && m_vCameraIsOpen[nCamera - 1])
     {
-        // Get pointer to camera.
-        BasicCam* pBasicCamera = globals::g_pCameraHandler->GetBasicCam(static_cast<CameraHandler::BasicCamName>(nCamera));
-        // Store camera pointer in vector so we can get images later.
-        m_vBasicCameras[nCamera - 1] = pBasicCamera;
+        // Set recording toggle. A recorder that was paused resumes with a keyframe.
+        m_vRecordingToggles[nCamera - 1] = true;
+        // Setup a camera recorder on this camera's track of the group recording if it's in the group.
+        if (m_vCameraRecorders[nCamera - 1] == nullptr && m_vGroupTracks[nCamera - 1] >= 0)
+        {
+            // Create and start the camera recorder. It encodes in its own thread and hands the packets to the group muxer.
+            std::lock_guard<std::mutex> lkCameraRecordersLock(m_muCameraRecordersMutex);
+            m_vCameraRecorders[nCamera - 1] = new CameraRecorder(pBasicCamera, m_pGroupMuxer, m_vGroupTracks[nCamera - 1], constants::RECORDER_MAX_QUEUED_FRAMES);
+            m_vCameraRecorders[nCamera - 1]->SetThreadPriority(constants::RECORDER_PRIORITY, constants::RECORDER_CPU_AFFINITY);
+            m_vCameraRecorders[nCamera - 1]->Start();
+        }
+        // Setup camera recorder if needed.
+        else if (m_vCameraRecorders[nCamera - 1] == nullptr)
+        {
+            // Assemble filepath string. Recordings after the first one for a camera get numbered, so they don't overwrite it.
+            std::filesystem::path szFilePath;
+            std::filesystem::path szFilenameWithExtension;
+            szFilePath = constants::LOGGING_OUTPUT_PATH_ABSOLUTE;                    // Main location for all recordings.
+            szFilePath += logging::g_szProgramStartTimeString + "/cameras";          // Folder for each program run.
+            szFilenameWithExtension = pBasicCamera->GetCameraLocation();             // File for each camera index or name.
+            if (m_vRecordingTakes[nCamera - 1] > 0)
+            {
+                szFilenameWithExtension += "_take" + std::to_string(m_vRecordingTakes[nCamera - 1] + 1);
+            }
+            szFilenameWithExtension += ".mkv";
+            ++m_vRecordingTakes[nCamera - 1];
+
+            // Create directory if it doesn't exist.
+            std::error_code errCode;
+            std::filesystem::create_directories(szFilePath, errCode);
+            if (errCode)
+            {
+                // Submit logger message.
+                LOG_ERROR(logging::g_qSharedLogger,
+                          "Unable to create the VideoWriter output directory: {} for camera {}",
+                          szFilePath.string(),
+                          pBasicCamera->GetCameraLocation());
+            }
 
-        // Check if recording for this camera is enabled.
-        if (pBasicCamera->GetEnableRecordingFlag() && pBasicCamera->GetCameraIsOpen())
+            // Construct the full output path.
+            std::filesystem::path szFullOutputPath = szFilePath / szFilenameWithExtension;
+
+            // Get the encoder settings for this camera.
+            std::unique_lock<std::mutex> lkEncoderSettingsLock(m_muEncoderSettingsMutex);
+            FFmpegRecordingMuxer::EncoderSettings stEncoderSettings = m_vEncoderSettings[nCamera - 1];
+            lkEncoderSettingsLock.unlock();
+
+            // Create and start the camera recorder. It opens the writer and writes frames in its own thread.
+            std::lock_guard<std::mutex> lkCameraRecordersLock(m_muCameraRecordersMutex);
+            m_vCameraRecorders[nCamera - 1] =
+                new CameraRecorder(pBasicCamera,
+                                   szFullOutputPath.string(),
+                                   stEncoderSettings,
+                                   constants::RECORDER_SEGMENT_DURATION,
+                                   constants::RECORDER_SEGMENT_MAX_SIZE,
+                                   constants::RECORDER_MAX_QUEUED_FRAMES);
+            m_vCameraRecorders[nCamera - 1]->SetThreadPriority(constants::RECORDER_PRIORITY, constants::RECORDER_CPU_AFFINITY);
+            m_vCameraRecorders[nCamera - 1]->Start();
+
+            // Submit logger message.
+            LOG_INFO(logging::g_qSharedLogger, "RecordingHandler: Recording camera {} to {}", pBasicCamera->GetCameraLocation(), szFullOutputPath.string());
+        }
+    }
+    else
+    {
+        // Set recording toggle.
+        bool bWasRecording               = m_vRecordingToggles[nCamera - 1];
+        m_vRecordingToggles[nCamera - 1] = false;
+
+        // Check if recording was turned off for a camera with its own file.
+        if (!m_vRecordingEnabled[nCamera - 1] && m_vGroupTracks[nCamera - 1] < 0 && m_vCameraRecorders[nCamera - 1] != nullptr)
         {
-            // Set recording toggle.
-            m_vRecordingToggles[nCamera - 1] = true;
-            // Setup VideoWriter if needed.
-            if (!m_vCameraWriters[nCamera - 1].isOpened())
+            // Take the recorder out of the list, then delete it. This finishes the file once its queued frames are written.
+            std::unique_lock<std::mutex> lkCameraRecordersLock(m_muCameraRecordersMutex);
+            CameraRecorder* pCameraRecorder = m_vCameraRecorders[nCamera - 1];
+            m_vCameraRecorders[nCamera - 1] = nullptr;
+            lkCameraRecordersLock.unlock();
+            delete pCameraRecorder;
+
+            // Submit logger message.
+            LOG_INFO(logging::g_qSharedLogger, "RecordingHandler: Stopped recording camera {}.", pBasicCamera->GetCameraLocation());
+        }
+        // Check if a camera that was being recorded was just paused.
+        else if (bWasRecording && m_vCameraRecorders[nCamera - 1] != nullptr)
+        {
+            // Submit logger message.
+            if (m_vCameraIsOpen[nCamera - 1])
+            {
+                LOG_INFO(logging::g_qSharedLogger, "RecordingHandler: Recording of camera {} paused.", pBasicCamera->GetCameraLocation());
+            }
+            else
             {
-                // Assemble filepath string.
-                std::filesystem::path szFilePath;
-                std::filesystem::path szFilenameWithExtension;
-                szFilePath = constants::LOGGING_OUTPUT_PATH_ABSOLUTE;                    // Main location for all recordings.
-                szFilePath += logging::g_szProgramStartTimeString + "/cameras";          // Folder for each program run.
-                szFilenameWithExtension = pBasicCamera->GetCameraLocation() + ".mkv";    // Folder for each camera index or name.
-
-                // Check if directory exists.
-                if (!std::filesystem::exists(szFilePath))
-                {
-                    // Create directory.
-                    if (!std::filesystem::create_directories(szFilePath))
-                    {
-                        // Submit logger message.
-                        LOG_ERROR(logging::g_qSharedLogger,
-                                  "Unable to create the VideoWriter output directory: {} for camera {}",
-                                  szFilePath.string(),
-                                  pBasicCamera->GetCameraLocation());
-                    }
-                }
-
-                // Construct the full output path.
-                std::filesystem::path szFullOutputPath = szFilePath / szFilenameWithExtension;
-
-                // Open writer.
-                bool bWriterOpened = m_vCameraWriters[nCamera - 1].open(szFullOutputPath.string(),
-                                                                        cv::VideoWriter::fourcc('H', '2', '6', '4'),
-                                                                        constants::RECORDER_FPS,
-                                                                        pBasicCamera->GetPropResolution());
-
-                // Check writer opened status.
-                if (!bWriterOpened)
-                {
-                    // Submit logger message.
-                    LOG_WARNING(logging::g_qSharedLogger,
-                                "RecordingHandler: Failed to open cv::VideoWriter for basic camera at path/index {}",
-                                pBasicCamera->GetCameraLocation());
-                }
+                LOG_WARNING(logging::g_qSharedLogger, "RecordingHandler: Camera {} went offline. Recording paused until it reconnects.", pBasicCamera->GetCameraLocation());
             }
+            // Pause the recorder. It resumes with a keyframe once the camera is recorded again.
+            m_vCameraRecorders[nCamera - 1]->SetCameraOffline();
         }
-        else
+    }
+}
+
+/******************************************************************************
+ * @brief This method is used internally by the class to open the camera group
+ *      recording. Every camera that has recording enabled and is in the group gets a
+ *      track, even if it isn't open yet, since tracks can't be added once the file is
+ *      started. If the group can't be opened, its cameras are recorded to their own
+ *      files instead. This is only tried once.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingHandler::OpenCameraGroup()
+{
+    // Create the group muxer.
+    m_pGroupMuxer = new FFmpegGroupRecordingMuxer();
+
+    // Build a track for each camera in the group.
+    std::vector<FFmpegGroupRecordingMuxer::TrackSettings> vTrackSettings;
+    std::vector<int> vTrackCameras;
+    for (int nCamera = 1; nCamera <= m_nTotalVideoFeeds; ++nCamera)
+    {
+        // Get pointer to camera.
+        BasicCam* pBasicCamera = m_vBasicCameras[nCamera - 1];
+        // Check if this camera is recorded and in the group.
+        if (pBasicCamera != nullptr && m_vRecordingEnabled[nCamera - 1] && this->GetCameraIsInRecordingGroup(nCamera))
         {
-            // Set recording toggle.
-            m_vRecordingToggles[nCamera - 1] = false;
+            // Get the encoder settings for this camera.
+            std::unique_lock<std::mutex> lkEncoderSettingsLock(m_muEncoderSettingsMutex);
+            vTrackSettings.push_back({pBasicCamera->GetCameraLocation(), pBasicCamera->GetPropResolution(), m_vEncoderSettings[nCamera - 1]});
+            lkEncoderSettingsLock.unlock();
+            vTrackCameras.push_back(nCamera);
         }
     }
+    // Check if there is anything to group.
+    if (vTrackSettings.empty())
+    {
+        return;
+    }
+
+    // Assemble filepath string.
+    std::filesystem::path szFilePath = constants::LOGGING_OUTPUT_PATH_ABSOLUTE;
+    szFilePath += logging::g_szProgramStartTimeString + "/cameras";
+    // Check if directory exists.
+    std::error_code errCode;
+    std::filesystem::create_directories(szFilePath, errCode);
+
+    // Move disk writes off of the encoding threads if enabled.
+    if (constants::RECORDER_ENABLE_ASYNC_WRITER)
+    {
+        m_pGroupMuxer->EnableAsyncWriter(constants::RECORDER_WRITE_BUFFER_SIZE, constants::RECORDER_WRITE_BUFFER_COUNT, constants::RECORDER_FSYNC_INTERVAL);
+    }
+    // Open the group recording.
+    if (!m_pGroupMuxer->Open((szFilePath / "group.mkv").string(), vTrackSettings))
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger, "RecordingHandler: Could not open the camera group recording. Recording each camera to its own file instead.");
+        return;
+    }
+
+    // Map each camera to its track.
+    for (size_t siTrack = 0; siTrack < vTrackCameras.size(); ++siTrack)
+    {
+        m_vGroupTracks[vTrackCameras[siTrack] - 1] = static_cast<int>(siTrack);
+    }
 }
 
 /******************************************************************************
- * @brief This method is used internally by the RecordingHandler to request and write
- *      frames to from the cameras stored in the member variable vectors.
+ * @brief Accessor for whether a camera is part of the camera group recording.
+ *
+ * @param nCamera - The camera, as a CameraHandler::BasicCamName value. Extra cameras are never in the group.
+ * @return true - The camera is recorded in the group.
+ * @return false - The camera is recorded to its own file.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool RecordingHandler::GetCameraIsInRecordingGroup(const int nCamera) const
+{
+    // Check which camera this is.
+    switch (static_cast<CameraHandler::BasicCamName>(nCamera))
+    {
+        case CameraHandler::BasicCamName::eDriveCamLeft: return constants::BASICCAM_DRIVECAMLEFT_RECORD_IN_GROUP;
+        case CameraHandler::BasicCamName::eDriveCamRight: return constants::BASICCAM_DRIVECAMRIGHT_RECORD_IN_GROUP;
+        case CameraHandler::BasicCamName::eGimbalCamLeft: return constants::BASICCAM_GIMBALCAMLEFT_RECORD_IN_GROUP;
+        case CameraHandler::BasicCamName::eGimbalCamRight: return constants::BASICCAM_GIMBALCAMRIGHT_RECORD_IN_GROUP;
+        case CameraHandler::BasicCamName::eBackCam: return constants::BASICCAM_BACKCAM_RECORD_IN_GROUP;
+        case CameraHandler::BasicCamName::eAuxCamera1: return constants::BASICCAM_AUXCAM1_RECORD_IN_GROUP;
+        case CameraHandler::BasicCamName::eAuxCamera2: return constants::BASICCAM_AUXCAM2_RECORD_IN_GROUP;
+        case CameraHandler::BasicCamName::eAuxCamera3: return constants::BASICCAM_AUXCAM3_RECORD_IN_GROUP;
+        case CameraHandler::BasicCamName::eAuxCamera4: return constants::BASICCAM_AUXCAM4_RECORD_IN_GROUP;
+        case CameraHandler::BasicCamName::eMicroscope: return constants::BASICCAM_MICROSCOPE_RECORD_IN_GROUP;
+        default: return false;
+    }
+}
+
+/******************************************************************************
+ * @brief This method is used internally by the RecordingHandler to schedule a frame
+ *      on the recorder of each camera that has recording enabled. It doesn't wait on
+ *      any frame copy or encode, that is done by each recorder's own thread.
  *
  * @author Eli Byrd (edbgkk@mst.edu)
  * @date 2024-11-04
  ******************************************************************************/
-void RecordingHandler::RequestAndWriteCameraFrames()
+void RecordingHandler::ScheduleCameraFrames()
 {
-    // Loop through total number of cameras and request frames.
+    // Loop through total number of cameras and schedule frames.
     for (int nIter = 0; nIter < m_nTotalVideoFeeds; ++nIter)
     {
         // Check if recording for the camera at this index is enabled.
-        if (m_vRecordingToggles[nIter])
+        if (m_vRecordingToggles[nIter] && m_vCameraRecorders[nIter] != nullptr)
         {
-            // Check if the camera at the current index is a BasicCam or ZEDCam.
-            if (m_vBasicCameras[nIter] != nullptr)
+            // Request a frame copy and queue it on the recorder. If the recorder has fallen behind, the frame is dropped.
+            if (!m_vCameraRecorders[nIter]->ScheduleFrame() && m_vCameraRecorders[nIter]->GetWriterIsOpen())
             {
-                // Request frame.
-                m_vFrameFutures[nIter] = m_vBasicCameras[nIter]->RequestFrameCopy(m_vFrames[nIter]);
+                // Submit logger message.
+                LOG_TRACE_L1(logging::g_qSharedLogger,
+                             "RecordingHandler: Recorder for camera {} is behind, dropped a frame. ({} total)",
+                             m_vBasicCameras[nIter]->GetCameraLocation(),
+                             m_vCameraRecorders[nIter]->GetDroppedFrames());
             }
         }
     }
+}
+
+/******************************************************************************
+ * @brief This method is used internally by the RecordingHandler to get the
+ *      recording files that are still being written, along with their frame indexes.
+ *
+ * @return std::unordered_set<std::string> - The normalized paths of the open files.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+std::unordered_set<std::string> RecordingHandler::GetOpenRecordingFiles()
+{
+    // Loop through camera recorders.
+    std::unordered_set<std::string> setOpenSegments;
+    for (CameraRecorder* pCameraRecorder : m_vCameraRecorders)
+    {
+        // Check if the recorder exists.
+        if (pCameraRecorder != nullptr)
+        {
+            std::string szSegmentPath = std::filesystem::path(pCameraRecorder->GetCurrentSegmentPath()).lexically_normal().string();
+            setOpenSegments.insert(szSegmentPath);
+            setOpenSegments.insert(szSegmentPath + frameindex::FRAMEINDEX_EXTENSION);
+        }
+    }
+    // The group recording stays open even while none of its cameras have a recorder.
+    if (m_pGroupMuxer != nullptr && m_pGroupMuxer->GetIsOpen())
+    {
+        std::string szGroupPath = std::filesystem::path(m_pGroupMuxer->GetOutputPath()).lexically_normal().string();
+        setOpenSegments.insert(szGroupPath);
+        setOpenSegments.insert(szGroupPath + frameindex::FRAMEINDEX_EXTENSION);
+    }
+
+    return setOpenSegments;
+}
+
+/******************************************************************************
+ * @brief This method is used internally by the RecordingHandler to start the
+ *      RecordingRetention and RecordingTranscoder threads the first time through, and
+ *      hand them the recording files that are still being written. Both walk the
+ *      recordings folder in their own background thread, so the only work done here
+ *      is listing the open files.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingHandler::UpdateRecordingMaintenance()
+{
+    // Check if there is anything to hand the open files to.
+    if (constants::RECORDER_DISK_BUDGET <= 0 && !constants::RECORDER_ENABLE_TRANSCODER)
+    {
+        return;
+    }
+
+    // Get the files that are still being written.
+    std::unordered_set<std::string> setOpenSegments = this->GetOpenRecordingFiles();
+
+    // Check if there is a disk budget.
+    if (constants::RECORDER_DISK_BUDGET > 0)
+    {
+        // Create and start the retention thread the first time through.
+        if (m_pRecordingRetention == nullptr)
+        {
+            m_pRecordingRetention = new RecordingRetention(constants::LOGGING_OUTPUT_PATH_ABSOLUTE, constants::RECORDER_DISK_BUDGET);
+            m_pRecordingRetention->SetThreadPriority(constants::RECORDER_PRIORITY, constants::RECORDER_CPU_AFFINITY);
+            m_pRecordingRetention->Start();
+        }
+        // Delete the oldest recording segments if needed.
+        m_pRecordingRetention->SetOpenSegments(setOpenSegments);
+    }
+
+    // Check if re-encoding is enabled.
+    if (!constants::RECORDER_ENABLE_TRANSCODER)
+    {
+        return;
+    }
 
-    // Loop through cameras and wait for frame requests to be fulfilled.
+    // Create and start the transcoder the first time through.
+    if (m_pRecordingTranscoder == nullptr)
+    {
+        m_pRecordingTranscoder = new RecordingTranscoder(constants::LOGGING_OUTPUT_PATH_ABSOLUTE,
+                                                         {constants::RECORDER_CODEC,
+                                                          constants::RECORDER_TRANSCODE_PRESET,
+                                                          constants::RECORDER_TRANSCODE_CRF,
+                                                          constants::RECORDER_TRANSCODE_BITRATE,
+                                                          1,
+                                                          constants::RECORDER_FPS,
+                                                          constants::RECORDER_GOP_SIZE});
+        m_pRecordingTranscoder->SetThreadPriority(constants::RECORDER_TRANSCODE_PRIORITY, constants::RECORDER_TRANSCODE_CPU_AFFINITY);
+        m_pRecordingTranscoder->SetOpenSegments(setOpenSegments);
+        m_pRecordingTranscoder->Start();
+        return;
+    }
+
+    // Update the files it must leave alone.
+    m_pRecordingTranscoder->SetOpenSegments(setOpenSegments);
+}
+
+/******************************************************************************
+ * @brief This method is used internally by the RecordingHandler to log how the
+ *      storage is keeping up with each camera recording, and how much each instant
+ *      replay buffer is holding.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingHandler::LogWriteStatistics()
+{
+    // Get the time since the statistics were last logged.
+    double dElapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_tmLastWriteStatisticsLog).count();
+
+    // Loop through camera recorders.
     for (int nIter = 0; nIter < m_nTotalVideoFeeds; ++nIter)
     {
-        // Check if recording for the camera at this index is enabled.
-        if (m_vRecordingToggles[nIter])
+        // Check if the camera is being recorded.
+        if (m_vCameraRecorders[nIter] == nullptr || !m_vCameraRecorders[nIter]->GetWriterIsOpen())
         {
-            // Check if the camera at the current index is a BasicCam or ZEDCam.
-            if (m_vBasicCameras[nIter] != nullptr)
-            {
-                // Wait for future to be fulfilled.
-                if (m_vFrameFutures[nIter].get() && !m_vFrames[nIter].empty())
-                {
-                    // Check if this is a grayscale or color image.
-                    if (m_vFrames[nIter].channels() == 1)
-                    {
-                        // Convert frame from 1 channel grayscale to 3 channel BGR.
-                        cv::cvtColor(m_vFrames[nIter], m_vFrames[nIter], cv::COLOR_GRAY2BGR);
-                    }
-                    // Check if this has an alpha channel.
-                    else if (m_vFrames[nIter].channels() == 4)
-                    {
-                        // Convert from from 4 channels to 3 channels.
-                        cv::cvtColor(m_vFrames[nIter], m_vFrames[nIter], cv::COLOR_BGRA2BGR);
-                    }
-
-                    // Write frame to OpenCV video writer.
-                    m_vCameraWriters[nIter].write(m_vFrames[nIter]);
-                }
-            }
+            continue;
         }
+
+        // Submit logger message.
+        AsyncFileWriter::WriteStatistics stStatistics = m_vCameraRecorders[nIter]->GetWriteStatistics();
+        LOG_DEBUG(logging::g_qSharedLogger,
+                  "RecordingHandler: Camera {} disk writes p50/p95/p99/max {:.1f}/{:.1f}/{:.1f}/{:.1f} ms, {} KB in flight, {} MB written, {} stalls.",
+                  m_vBasicCameras[nIter]->GetCameraLocation(),
+                  stStatistics.dP50LatencyMs,
+                  stStatistics.dP95LatencyMs,
+                  stStatistics.dP99LatencyMs,
+                  stStatistics.dMaxLatencyMs,
+                  stStatistics.unBytesInFlight / 1024,
+                  stStatistics.unBytesWritten / (1024 * 1024),
+                  stStatistics.unWriteStalls);
+        // Submit logger message.
+        LOG_DEBUG(logging::g_qSharedLogger,
+                  "RecordingHandler: Camera {} replay buffer holds {:.1f} s in {} KB.",
+                  m_vBasicCameras[nIter]->GetCameraLocation(),
+                  m_vCameraRecorders[nIter]->GetReplayBufferedSeconds(),
+                  m_vCameraRecorders[nIter]->GetReplayMemoryUsage() / 1024);
+        // Submit logger message.
+        LOG_DEBUG(logging::g_qSharedLogger,
+                  "RecordingHandler: Camera {} skipped {} duplicate frames and dropped {} frames.",
+                  m_vBasicCameras[nIter]->GetCameraLocation(),
+                  m_vCameraRecorders[nIter]->GetDuplicateFrames(),
+                  m_vCameraRecorders[nIter]->GetDroppedFrames());
+
+        // Work out how much of a core encoding used since the last log. A recorder that was replaced starts counting from zero.
+        std::chrono::nanoseconds tmEncodeCPUTime = m_vCameraRecorders[nIter]->GetEncodeCPUTime();
+        std::chrono::nanoseconds tmEncodeCPUDelta =
+            tmEncodeCPUTime >= m_vLastEncodeCPUTimes[nIter] ? tmEncodeCPUTime - m_vLastEncodeCPUTimes[nIter] : tmEncodeCPUTime;
+        m_vLastEncodeCPUTimes[nIter] = tmEncodeCPUTime;
+        // Submit logger message.
+        LOG_DEBUG(logging::g_qSharedLogger,
+                  "RecordingHandler: Camera {} encoding used {:.1f}% CPU.",
+                  m_vBasicCameras[nIter]->GetCameraLocation(),
+                  dElapsedSeconds > 0.0 ? 100.0 * std::chrono::duration<double>(tmEncodeCPUDelta).count() / dElapsedSeconds : 0.0);
     }
 }
 
@@ -261,6 +808,30 @@ void RecordingHandler::SetRecordingFPS(const int nRecordingFPS)
     this->SetMainThreadIPSLimit(nRecordingFPS);
 }
 
+/******************************************************************************
+ * @brief Mutator for the encoder settings of a camera recording. The settings are
+ *      used the next time a recorder is created for the camera, so they should be
+ *      set before the RecordingHandler is started.
+ *
+ * @param nCamera - The camera to set the encoder settings for, as a CameraHandler::BasicCamName value.
+ * @param stEncoderSettings - The codec, preset, rate control and thread settings to record the camera with.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingHandler::SetEncoderSettings(const int nCamera, const FFmpegRecordingMuxer::EncoderSettings& stEncoderSettings)
+{
+    // Acquire lock on encoder settings.
+    std::lock_guard<std::mutex> lkEncoderSettingsLock(m_muEncoderSettingsMutex);
+    // Check if the camera has a recording slot.
+    int nIndex = nCamera - 1;
+    if (nIndex >= 0 && nIndex < static_cast<int>(m_vEncoderSettings.size()))
+    {
+        // Update the settings for this camera.
+        m_vEncoderSettings[nIndex] = stEncoderSettings;
+    }
+}
+
 /******************************************************************************
  * @brief Accessor for the desired FPS for all camera recordings.
  *
@@ -274,3 +845,27 @@ int RecordingHandler::GetRecordingFPS() const
     // Return member variable value.
     return this->GetMainThreadMaxIPS();
 }
+
+/******************************************************************************
+ * @brief Accessor for the encoder settings of a camera recording.
+ *
+ * @param nCamera - The camera to get the encoder settings of, as a CameraHandler::BasicCamName value.
+ * @return FFmpegRecordingMuxer::EncoderSettings - A copy of the encoder settings for the camera.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+FFmpegRecordingMuxer::EncoderSettings RecordingHandler::GetEncoderSettings(const int nCamera)
+{
+    // Acquire lock on encoder settings.
+    std::lock_guard<std::mutex> lkEncoderSettingsLock(m_muEncoderSettingsMutex);
+    // Check if the camera has a recording slot.
+    int nIndex = nCamera - 1;
+    if (nIndex >= 0 && nIndex < static_cast<int>(m_vEncoderSettings.size()))
+    {
+        // Return a copy of the settings.
+        return m_vEncoderSettings[nIndex];
+    }
+
+    return {};
+}
@@ -12,9 +12,17 @@
 #define RECORDING_HANDLER_H
 
 #include "../vision/cameras/BasicCam.h"
+#include "../vision/recorders/CameraRecorder.h"
+#include "../vision/recorders/RecordingRetention.h"
+#include "../vision/recorders/RecordingTranscoder.h"
 
 /// \cond
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <opencv2/opencv.hpp>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 /// \endcond
@@ -25,6 +33,11 @@
  *      The recording of each camera can be disabled through constants and the framerate
  *      of the recording can be adjusted to save CPU-time and resources.
  *
+ *      Cameras opening and closing and recording being turned on and off are handled
+ *      as events. The cameras and the SETRECORDING command publish them, and the
+ *      recording thread only applies them when one is waiting, so the loop that
+ *      schedules frames never polls the cameras or touches the filesystem.
+ *
  * @author Eli Byrd (edbgkk@mst.edu)
  * @date 2024-11-04
  ******************************************************************************/
@@ -45,30 +58,65 @@ class RecordingHandler : public AutonomyThread<void>
         // Declare public class methods and variables.
         /////////////////////////////////////////
 
-        RecordingHandler(RecordingMode eRecordingMode);
+        RecordingHandler(RecordingMode eRecordingMode, const int nExtraVideoFeeds = 0);
         ~RecordingHandler();
+        void AddCamera(const int nCamera, BasicCam* pBasicCamera);
+        bool TriggerReplay(const int nCamera);
+        void StartCameraRecorders();
+        void StopCameraRecorders();
 
         /////////////////////////////////////////
         // Mutators.
         /////////////////////////////////////////
 
         void SetRecordingFPS(const int nRecordingFPS);
+        void SetEncoderSettings(const int nCamera, const FFmpegRecordingMuxer::EncoderSettings& stEncoderSettings);
+        void SetCameraRecording(const int nCamera, const bool bEnable);
 
         /////////////////////////////////////////
         // Accessors.
         /////////////////////////////////////////
 
         int GetRecordingFPS() const;
+        FFmpegRecordingMuxer::EncoderSettings GetEncoderSettings(const int nCamera);
 
     private:
+        /////////////////////////////////////////
+        // Define private enumerators and structs specific to this class.
+        /////////////////////////////////////////
+
+        // Enum used to tell what changed for a camera.
+        enum class RecordingEventType
+        {
+            eCameraOpened,        // The camera was opened or reopened.
+            eCameraClosed,        // The camera was closed after failing to read a frame.
+            eRecordingEnabled,    // Recording of the camera was turned on.
+            eRecordingDisabled    // Recording of the camera was turned off.
+        };
+
+        // Struct used to queue a change to a camera until the recording thread applies it.
+        struct RecordingEvent
+        {
+            public:
+                RecordingEventType eType;
+                int nCamera;
+        };
+
         /////////////////////////////////////////
         // Declare private methods.
         /////////////////////////////////////////
 
         void ThreadedContinuousCode() override;
         void PooledLinearCode() override;
-        void UpdateRecordableCameras();
-        void RequestAndWriteCameraFrames();
+        void PublishRecordingEvent(const RecordingEventType eType, const int nCamera);
+        void ProcessRecordingEvents();
+        void UpdateCameraRecorder(const int nCamera);
+        void OpenCameraGroup();
+        bool GetCameraIsInRecordingGroup(const int nCamera) const;
+        void ScheduleCameraFrames();
+        std::unordered_set<std::string> GetOpenRecordingFiles();
+        void UpdateRecordingMaintenance();
+        void LogWriteStatistics();
 
         /////////////////////////////////////////
         // Declare private class member variables.
@@ -77,10 +125,24 @@ class RecordingHandler : public AutonomyThread<void>
         int m_nTotalVideoFeeds;
         RecordingMode m_eRecordingMode;
         std::vector<BasicCam*> m_vBasicCameras;
-        std::vector<cv::VideoWriter> m_vCameraWriters;
+        std::vector<CameraRecorder*> m_vCameraRecorders;
+        FFmpegGroupRecordingMuxer* m_pGroupMuxer;
+        RecordingTranscoder* m_pRecordingTranscoder;
+        RecordingRetention* m_pRecordingRetention;
+        std::vector<int> m_vGroupTracks;
+        std::mutex m_muCameraRecordersMutex;
+        std::vector<FFmpegRecordingMuxer::EncoderSettings> m_vEncoderSettings;
+        std::mutex m_muEncoderSettingsMutex;
+        std::chrono::steady_clock::time_point m_tmLastRetentionCheck;
+        std::chrono::steady_clock::time_point m_tmLastWriteStatisticsLog;
+        std::vector<std::chrono::nanoseconds> m_vLastEncodeCPUTimes;
         std::vector<bool> m_vRecordingToggles;
-        std::vector<cv::Mat> m_vFrames;
+        std::vector<bool> m_vRecordingEnabled;
+        std::vector<bool> m_vCameraIsOpen;
+        std::vector<int> m_vRecordingTakes;
+        std::vector<RecordingEvent> m_vRecordingEvents;
+        std::mutex m_muRecordingEventsMutex;
+        std::atomic<bool> m_bRecordingEventsPending;
         std::vector<cv::cuda::GpuMat> m_vGPUFrames;
-        std::vector<std::future<bool>> m_vFrameFutures;
 };
 #endif
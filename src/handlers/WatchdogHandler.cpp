@@ -0,0 +1,254 @@
+/******************************************************************************
+ * @brief Implements the WatchdogHandler class.
+ *
+ * @file WatchdogHandler.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "WatchdogHandler.h"
+#include "../RoveSoCameraServerConstants.h"
+#include "../RoveSoCameraServerLogging.h"
+
+/// \cond
+#include <algorithm>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Construct a new Watchdog Handler:: Watchdog Handler object.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+WatchdogHandler::WatchdogHandler()
+{
+    // Initialize member variables.
+    m_dTotalRecoveryMilliseconds = 0.0;
+    // Set how often heartbeats are checked.
+    this->SetMainThreadIPSLimit(constants::WATCHDOG_FPS);
+}
+
+/******************************************************************************
+ * @brief Destroy the Watchdog Handler:: Watchdog Handler object.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+WatchdogHandler::~WatchdogHandler()
+{
+    // Signal and wait for watchdog thread to stop.
+    this->RequestStop();
+    this->Join();
+}
+
+/******************************************************************************
+ * @brief Start watching a thread. Should be called for each thread before the
+ *      handler is started.
+ *
+ * @param szName - The name of the thread, used in log messages.
+ * @param fnGetTimeSinceHeartbeat - Returns how long it has been since the thread last finished an iteration, or nothing if it isn't running.
+ * @param nStallTimeout - How long in milliseconds the thread can go without a heartbeat before it's stalled. Must be longer than one iteration.
+ * @param fnRecover - Called from the watchdog thread to recover the thread once it's stalled. Returns false if it couldn't.
+ *                  Empty if the thread should only be reported.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void WatchdogHandler::AddThread(const std::string& szName,
+                                const std::function<std::optional<std::chrono::steady_clock::duration>()>& fnGetTimeSinceHeartbeat,
+                                const int nStallTimeout,
+                                const std::function<bool()>& fnRecover)
+{
+    // Assemble the watched thread.
+    WatchedThread stThread;
+    stThread.szName                  = szName;
+    stThread.fnGetTimeSinceHeartbeat = fnGetTimeSinceHeartbeat;
+    stThread.tmStallTimeout          = std::chrono::milliseconds(nStallTimeout);
+    stThread.fnRecover               = fnRecover;
+
+    // Acquire lock on the watched threads.
+    std::lock_guard<std::mutex> lkWatchedThreadsLock(m_muWatchedThreadsMutex);
+    // Add the thread.
+    m_vWatchedThreads.emplace_back(std::move(stThread));
+}
+
+/******************************************************************************
+ * @brief The code inside this private method runs in a separate thread, but still
+ *      has access to this*. This method checks the heartbeat of every watched thread,
+ *      then runs the recoveries of the stalled ones. Recoveries are run after the watched
+ *      threads are unlocked, so a slow one can't block threads from being watched.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void WatchdogHandler::ThreadedContinuousCode()
+{
+    // Create instance variables.
+    std::vector<std::pair<std::string, std::function<bool()>>> vRecoveries;
+
+    // Acquire lock on the watched threads.
+    std::unique_lock<std::mutex> lkWatchedThreadsLock(m_muWatchedThreadsMutex);
+    // Check each thread.
+    for (WatchedThread& stThread : m_vWatchedThreads)
+    {
+        // Check if the thread needs to be recovered and can be.
+        if (this->CheckThread(stThread) && stThread.fnRecover)
+        {
+            vRecoveries.emplace_back(stThread.szName, stThread.fnRecover);
+        }
+    }
+    // Release lock on the watched threads.
+    lkWatchedThreadsLock.unlock();
+
+    // Recover the stalled threads.
+    for (const std::pair<std::string, std::function<bool()>>& stRecovery : vRecoveries)
+    {
+        this->RecoverThread(stRecovery.first, stRecovery.second);
+    }
+}
+
+/******************************************************************************
+ * @brief This method holds the code that is ran in the thread pool started by
+ *      the ThreadedLinearCode() method. It currently does nothing and is not
+ *      needed in the current implementation of the WatchdogHandler.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void WatchdogHandler::PooledLinearCode() {}
+
+/******************************************************************************
+ * @brief Check the heartbeat of a thread. A thread that has gone longer than its
+ *      stall timeout without one is reported and should be recovered. A stalled thread
+ *      should be recovered again every stall timeout until it has a heartbeat, and then
+ *      the time it took is recorded. Threads that aren't running are skipped.
+ *
+ * @param stThread - The thread to check.
+ * @return true - The thread is stalled and a recovery should be run now.
+ * @return false - The thread doesn't need a recovery right now.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool WatchdogHandler::CheckThread(WatchedThread& stThread)
+{
+    // Get the time of the thread's last heartbeat.
+    std::chrono::steady_clock::time_point tmCurrentTime                 = std::chrono::steady_clock::now();
+    std::optional<std::chrono::steady_clock::duration> tmSinceHeartbeat = stThread.fnGetTimeSinceHeartbeat();
+
+    // Check if the thread isn't running. It isn't expected to have heartbeats, and a stop doesn't count as a recovery.
+    if (!tmSinceHeartbeat.has_value())
+    {
+        // Drop the stall if there was one.
+        if (stThread.bStalled)
+        {
+            stThread.bStalled = false;
+            // Submit logger message.
+            LOG_INFO(logging::g_qSharedLogger, "WatchdogHandler: {} was stopped while stalled.", stThread.szName);
+        }
+        return false;
+    }
+    std::chrono::steady_clock::time_point tmLastHeartbeat = tmCurrentTime - *tmSinceHeartbeat;
+
+    // Check if the thread was running normally.
+    if (!stThread.bStalled)
+    {
+        // Check if the thread has gone too long without a heartbeat.
+        if (*tmSinceHeartbeat >= stThread.tmStallTimeout)
+        {
+            // Mark the thread as stalled.
+            stThread.bStalled        = true;
+            stThread.tmStallDetected = tmCurrentTime;
+            std::unique_lock<std::mutex> lkRecoveryStatisticsLock(m_muRecoveryStatisticsMutex);
+            ++m_stRecoveryStatistics.unStalls;
+            lkRecoveryStatisticsLock.unlock();
+
+            // Submit logger message.
+            LOG_WARNING(logging::g_qSharedLogger,
+                        "WatchdogHandler: {} has stalled! No heartbeat for {} ms.",
+                        stThread.szName,
+                        std::chrono::duration_cast<std::chrono::milliseconds>(*tmSinceHeartbeat).count());
+
+            // Try to get it running again. The attempt is recorded even without a recovery, so the thread is only reported once per timeout.
+            stThread.tmLastRecoveryAttempt = tmCurrentTime;
+            return true;
+        }
+    }
+    // Check if the thread has had a heartbeat since the stall was detected.
+    else if (tmLastHeartbeat > stThread.tmStallDetected)
+    {
+        // Mark the thread as running.
+        stThread.bStalled = false;
+
+        // Record how long the recovery took.
+        double dRecoveryMilliseconds = std::chrono::duration<double, std::milli>(tmLastHeartbeat - stThread.tmStallDetected).count();
+        std::unique_lock<std::mutex> lkRecoveryStatisticsLock(m_muRecoveryStatisticsMutex);
+        m_dTotalRecoveryMilliseconds += dRecoveryMilliseconds;
+        ++m_stRecoveryStatistics.unRecoveries;
+        m_stRecoveryStatistics.dLastRecoveryMilliseconds    = dRecoveryMilliseconds;
+        m_stRecoveryStatistics.dAverageRecoveryMilliseconds = m_dTotalRecoveryMilliseconds / m_stRecoveryStatistics.unRecoveries;
+        m_stRecoveryStatistics.dMaxRecoveryMilliseconds     = std::max(m_stRecoveryStatistics.dMaxRecoveryMilliseconds, dRecoveryMilliseconds);
+        lkRecoveryStatisticsLock.unlock();
+
+        // Submit logger message.
+        LOG_INFO(logging::g_qSharedLogger, "WatchdogHandler: {} has recovered {:.1f} ms after its stall was detected.", stThread.szName, dRecoveryMilliseconds);
+    }
+    // Check if the last recovery has had its full timeout to work.
+    else if (tmCurrentTime - stThread.tmLastRecoveryAttempt >= stThread.tmStallTimeout)
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger,
+                    "WatchdogHandler: {} is still stalled {} ms after it was detected!",
+                    stThread.szName,
+                    std::chrono::duration_cast<std::chrono::milliseconds>(tmCurrentTime - stThread.tmStallDetected).count());
+
+        // Try again.
+        stThread.tmLastRecoveryAttempt = tmCurrentTime;
+        return true;
+    }
+
+    return false;
+}
+
+/******************************************************************************
+ * @brief Run the recovery of a stalled thread. This must not be called with the
+ *      watched threads locked.
+ *
+ * @param szName - The name of the stalled thread.
+ * @param fnRecover - The recovery of the stalled thread.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void WatchdogHandler::RecoverThread(const std::string& szName, const std::function<bool()>& fnRecover)
+{
+    // Count the attempt.
+    std::unique_lock<std::mutex> lkRecoveryStatisticsLock(m_muRecoveryStatisticsMutex);
+    ++m_stRecoveryStatistics.unRecoveryAttempts;
+    lkRecoveryStatisticsLock.unlock();
+
+    // Recover the thread.
+    if (!fnRecover())
+    {
+        // Submit logger message.
+        LOG_ERROR(logging::g_qSharedLogger, "WatchdogHandler: Unable to recover {}!", szName);
+    }
+}
+
+/******************************************************************************
+ * @brief Accessor for the recovery statistics of every watched thread.
+ *
+ * @return RecoveryStatistics - The number of stalls and how long they took to recover from.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+WatchdogHandler::RecoveryStatistics WatchdogHandler::GetRecoveryStatistics()
+{
+    // Acquire lock on the statistics.
+    std::lock_guard<std::mutex> lkRecoveryStatisticsLock(m_muRecoveryStatisticsMutex);
+    return m_stRecoveryStatistics;
+}
@@ -0,0 +1,120 @@
+/******************************************************************************
+ * @brief Defines the WatchdogHandler class.
+ *
+ * @file WatchdogHandler.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef WATCHDOG_HANDLER_H
+#define WATCHDOG_HANDLER_H
+
+#include "../interfaces/AutonomyThread.hpp"
+
+/// \cond
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The WatchdogHandler class watches the heartbeats of the camera, stream,
+ *      and recording threads and catches any of them that stop finishing iterations.
+ *      Each thread is watched with its own stall timeout. When a thread goes longer
+ *      than that without a heartbeat, it is reported as stalled and its recovery is
+ *      run, like restarting a camera stuck in a driver read. If it still hasn't come
+ *      back after another timeout, the recovery is run again.
+ *
+ *      Threads without a recovery are only reported. Streams and recorders wait on
+ *      frame copies from a camera, so they come back on their own once the camera
+ *      they wait on is recovered.
+ *
+ *      The recovery time of each stall is measured from when it was detected to the
+ *      first heartbeat after it, and kept for the status readout. Threads that aren't
+ *      running are skipped, and a stall is dropped without counting a recovery if its
+ *      thread is stopped.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class WatchdogHandler : public AutonomyThread<void>
+{
+    public:
+        /////////////////////////////////////////
+        // Define public structs specific to this class.
+        /////////////////////////////////////////
+
+        // Struct used to report how the watched threads have recovered from stalls.
+        struct RecoveryStatistics
+        {
+            public:
+                unsigned int unStalls               = 0;      // The number of stalls detected.
+                unsigned int unRecoveries           = 0;      // The number of stalls that ended with the thread running again.
+                unsigned int unRecoveryAttempts     = 0;      // The number of times a recovery was run, including retries.
+                double dLastRecoveryMilliseconds    = 0.0;    // The time from detection to the next heartbeat of the last stall that ended.
+                double dAverageRecoveryMilliseconds = 0.0;    // The average time from detection to the next heartbeat.
+                double dMaxRecoveryMilliseconds     = 0.0;    // The longest time from detection to the next heartbeat.
+        };
+
+        /////////////////////////////////////////
+        // Declare public class methods and variables.
+        /////////////////////////////////////////
+
+        WatchdogHandler();
+        ~WatchdogHandler();
+        void AddThread(const std::string& szName,
+                       const std::function<std::optional<std::chrono::steady_clock::duration>()>& fnGetTimeSinceHeartbeat,
+                       const int nStallTimeout,
+                       const std::function<bool()>& fnRecover = nullptr);
+
+        /////////////////////////////////////////
+        // Accessors.
+        /////////////////////////////////////////
+
+        RecoveryStatistics GetRecoveryStatistics();
+
+    private:
+        /////////////////////////////////////////
+        // Define private structs specific to this class.
+        /////////////////////////////////////////
+
+        // Struct used to store a watched thread and the state of its current stall.
+        struct WatchedThread
+        {
+            public:
+                std::string szName;
+                std::function<std::optional<std::chrono::steady_clock::duration>()> fnGetTimeSinceHeartbeat;
+                std::chrono::milliseconds tmStallTimeout;
+                std::function<bool()> fnRecover;
+                bool bStalled = false;
+                std::chrono::steady_clock::time_point tmStallDetected;
+                std::chrono::steady_clock::time_point tmLastRecoveryAttempt;
+        };
+
+        /////////////////////////////////////////
+        // Declare private methods.
+        /////////////////////////////////////////
+
+        void ThreadedContinuousCode() override;
+        void PooledLinearCode() override;
+        bool CheckThread(WatchedThread& stThread);
+        void RecoverThread(const std::string& szName, const std::function<bool()>& fnRecover);
+
+        /////////////////////////////////////////
+        // Declare private class member variables.
+        /////////////////////////////////////////
+
+        std::vector<WatchedThread> m_vWatchedThreads;
+        std::mutex m_muWatchedThreadsMutex;
+        RecoveryStatistics m_stRecoveryStatistics;
+        double m_dTotalRecoveryMilliseconds;
+        std::mutex m_muRecoveryStatisticsMutex;
+};
+
+#endif    // WATCHDOG_HANDLER_H
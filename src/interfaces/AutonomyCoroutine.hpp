@@ -0,0 +1,575 @@
+/******************************************************************************
+ * @brief This interface defines a coroutine flavour of AutonomyThread. The main
+ *      loop of an inheritor is a C++20 coroutine that can co_await a frame, a timer,
+ *      or a socket, so many loops can share a few worker threads instead of each
+ *      holding one while it waits.
+ *
+ * @file AutonomyCoroutine.hpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef AUTONOMYCOROUTINE_H
+#define AUTONOMYCOROUTINE_H
+
+#include "../util/CoroutineReactor.hpp"
+#include "../util/IPS.hpp"
+#include "../util/ThreadScheduling.hpp"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The return type of coroutines run by AutonomyCoroutine. The coroutine
+ *      doesn't start until it is co_awaited, and the awaiting coroutine continues
+ *      right after it finishes.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class AutonomyTask
+{
+    public:
+        /******************************************************************************
+         * @brief The promise type the compiler uses to build AutonomyTask coroutines.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        class promise_type
+        {
+            public:
+                /******************************************************************************
+                 * @brief Awaited when the coroutine finishes. Continues whoever awaited it, or
+                 *      calls the finished callback if it was started on its own.
+                 *
+                 * @author agent (agent@local)
+                 * @date 2026-10-18
+                 ******************************************************************************/
+                class FinalAwaiter
+                {
+                    public:
+                        bool await_ready() const noexcept { return false; }
+                        std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> hCoroutine) noexcept
+                        {
+                            // Continue the awaiting coroutine on this thread.
+                            if (hCoroutine.promise().hContinuation)
+                            {
+                                return hCoroutine.promise().hContinuation;
+                            }
+
+                            // Take the callback out of the frame first, since the callback may let the frame be destroyed.
+                            std::function<void()> fnOnFinished = std::move(hCoroutine.promise().fnOnFinished);
+                            if (fnOnFinished)
+                            {
+                                fnOnFinished();
+                            }
+                            return std::noop_coroutine();
+                        }
+                        void await_resume() const noexcept {}
+                };
+
+                AutonomyTask get_return_object() { return AutonomyTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+                std::suspend_always initial_suspend() const noexcept { return {}; }
+                FinalAwaiter final_suspend() const noexcept { return {}; }
+                void return_void() const {}
+                void unhandled_exception() const { std::terminate(); }
+
+                // Declare public member variables.
+                std::coroutine_handle<> hContinuation;
+                std::function<void()> fnOnFinished;
+        };
+
+        /******************************************************************************
+         * @brief Construct a new Autonomy Task object.
+         *
+         * @param hCoroutine - The coroutine this task owns.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        explicit AutonomyTask(std::coroutine_handle<promise_type> hCoroutine = nullptr) : m_hCoroutine(hCoroutine) {}
+        AutonomyTask(AutonomyTask&& OtherTask) noexcept : m_hCoroutine(std::exchange(OtherTask.m_hCoroutine, nullptr)) {}
+        AutonomyTask& operator=(AutonomyTask&& OtherTask) noexcept
+        {
+            // Destroy our coroutine and take the other one.
+            if (this != &OtherTask)
+            {
+                this->Destroy();
+                m_hCoroutine = std::exchange(OtherTask.m_hCoroutine, nullptr);
+            }
+            return *this;
+        }
+        AutonomyTask(const AutonomyTask&)            = delete;
+        AutonomyTask& operator=(const AutonomyTask&) = delete;
+
+        /******************************************************************************
+         * @brief Destroy the Autonomy Task object and its coroutine. The coroutine must not
+         *      be running.
+         *
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        ~AutonomyTask() { this->Destroy(); }
+
+        /////////////////////////////////////////
+        // Awaitable interface.
+        /////////////////////////////////////////
+
+        bool await_ready() const noexcept { return !m_hCoroutine || m_hCoroutine.done(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> hAwaitingCoroutine) noexcept
+        {
+            // Run this task now and come back to the awaiting coroutine when it finishes.
+            m_hCoroutine.promise().hContinuation = hAwaitingCoroutine;
+            return m_hCoroutine;
+        }
+        void await_resume() const noexcept {}
+
+        /******************************************************************************
+         * @brief Accessor for the coroutine handle.
+         *
+         * @return std::coroutine_handle<promise_type> - The coroutine this task owns.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        std::coroutine_handle<promise_type> GetHandle() const { return m_hCoroutine; }
+
+    private:
+        // Declare private member variables.
+        std::coroutine_handle<promise_type> m_hCoroutine;
+
+        /******************************************************************************
+         * @brief Destroy the coroutine if there is one.
+         *
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void Destroy()
+        {
+            if (m_hCoroutine)
+            {
+                m_hCoroutine.destroy();
+                m_hCoroutine = nullptr;
+            }
+        }
+};
+
+/******************************************************************************
+ * @brief Interface class used to run a child class's main loop as a coroutine. It has
+ *      the same Start(), RequestStop(), and Join() lifecycle as AutonomyThread, but
+ *      ThreadedContinuousCode() is a coroutine that is resumed on the shared
+ *      WorkStealingExecutor and can co_await WaitForEvent(), WaitForTask(),
+ *      WaitUntil(), WaitFor(), WaitForReadable(), and WaitForWritable() without
+ *      holding a thread. Loops that spend most of their time waiting, like streamers
+ *      waiting on camera frames, can then share a few threads no matter how many of
+ *      them there are.
+ *
+ *      Code between awaits runs on an executor worker, so it should not block. Anything
+ *      that does should be awaited instead. The coroutine has no thread of its own, so
+ *      its priority class only decides how soon the executor picks it back up after a
+ *      wait, and it can't be pinned to CPUs.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class AutonomyCoroutine
+{
+    public:
+        /////////////////////////////////////////
+        // Define public enumerators specific to this class.
+        /////////////////////////////////////////
+
+        // Define an enum for storing this classes state.
+        enum class AutonomyThreadState
+        {
+            eStarting,
+            eRunning,
+            eStopping,
+            eStopped
+        };
+
+        /////////////////////////////////////////
+        // Declare and define public class methods.
+        /////////////////////////////////////////
+        /******************************************************************************
+         * @brief Construct a new Autonomy Coroutine object.
+         *
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        AutonomyCoroutine()
+        {
+            // Initialize member variables.
+            m_bStopThreads                     = false;
+            m_eThreadState                     = AutonomyThreadState::eStopped;
+            m_nMainThreadMaxIterationPerSecond = 0;
+            m_eThreadPriority                  = THREAD_PRIORITIES::eNormal;
+            m_bCoroutineFinished               = true;
+            m_tmLastHeartbeat                  = std::chrono::steady_clock::now();
+        }
+
+        /******************************************************************************
+         * @brief Destroy the Autonomy Coroutine object. Stops and joins the coroutine in
+         *      case the inheritor didn't, but since the coroutine calls back into the
+         *      inheritor, inheritors should stop and join it in their own destructor.
+         *
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        virtual ~AutonomyCoroutine()
+        {
+            // Stop and wait for the coroutine.
+            this->RequestStop();
+            this->Join();
+        }
+
+        /******************************************************************************
+         * @brief Starts the coroutine running ThreadedContinuousCode() in a loop. If it is
+         *      already running, it is stopped and joined first.
+         *
+         * @note This method will block until the thread state is eRunning.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void Start()
+        {
+            // Stop and wait for any coroutine that is still running.
+            this->RequestStop();
+            this->Join();
+
+            // Update thread state.
+            m_eThreadState = AutonomyThreadState::eStarting;
+            // Reset thread stop toggle.
+            m_bStopThreads = false;
+            // The coroutine hasn't had a chance to run yet, so it isn't late.
+            m_tmLastHeartbeat = std::chrono::steady_clock::now();
+
+            // Create the loop coroutine and mark it finished when it returns.
+            m_tkMainCoroutine = this->RunCoroutine();
+            std::unique_lock<std::mutex> lkStateLock(m_muThreadStateMutex);
+            m_bCoroutineFinished                                  = false;
+            m_tkMainCoroutine.GetHandle().promise().fnOnFinished = [this]()
+            {
+                // Notify the join method. Nothing in the frame is touched after this.
+                std::lock_guard<std::mutex> lkFinishedLock(m_muThreadStateMutex);
+                m_bCoroutineFinished = true;
+                m_cdThreadStateCondition.notify_all();
+            };
+            lkStateLock.unlock();
+
+            // Start the coroutine on the executor.
+            CoroutineReactor::GetSharedReactor().Resume(m_tkMainCoroutine.GetHandle(), m_eThreadPriority);
+
+            // Block until thread is started or currently stopping if thread start failed.
+            lkStateLock.lock();
+            m_cdThreadStateCondition.wait(lkStateLock,
+                                          [this]
+                                          {
+                                              return m_bCoroutineFinished || m_eThreadState == AutonomyThreadState::eRunning ||
+                                                     m_eThreadState == AutonomyThreadState::eStopping;
+                                          });
+        }
+
+        /******************************************************************************
+         * @brief Signals the coroutine to stop looping. DOES NOT JOIN. The coroutine
+         *      finishes the iteration it is on first, including anything it is awaiting.
+         *
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void RequestStop()
+        {
+            // Signal the coroutine to stop.
+            m_bStopThreads = true;
+            // Update thread state.
+            if (m_eThreadState != AutonomyThreadState::eStopped)
+            {
+                m_eThreadState = AutonomyThreadState::eStopping;
+            }
+        }
+
+        /******************************************************************************
+         * @brief Waits for the coroutine to finish. This method will block the calling
+         *      code until the coroutine has returned.
+         *
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void Join()
+        {
+            // Wait for the coroutine to return.
+            std::unique_lock<std::mutex> lkStateLock(m_muThreadStateMutex);
+            m_cdThreadStateCondition.wait(lkStateLock, [this] { return m_bCoroutineFinished; });
+            lkStateLock.unlock();
+
+            // Free the finished coroutine.
+            m_tkMainCoroutine = AutonomyTask();
+            // Update thread state.
+            m_eThreadState = AutonomyThreadState::eStopped;
+        }
+
+        /******************************************************************************
+         * @brief Check if the coroutine is finished and ready to be joined.
+         *
+         * @return true - The coroutine is finished and joinable.
+         * @return false - The coroutine is still running.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        bool Joinable()
+        {
+            // Check if the coroutine has returned.
+            std::lock_guard<std::mutex> lkStateLock(m_muThreadStateMutex);
+            return m_bCoroutineFinished;
+        }
+
+        /******************************************************************************
+         * @brief Accessor for the Threads State private member.
+         *
+         * @return AutonomyThreadState - The current state of the coroutine.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        AutonomyThreadState GetThreadState() const { return m_eThreadState; }
+
+        /******************************************************************************
+         * @brief Mutator for the Thread Priority private member. Takes effect the next time
+         *      the coroutine waits.
+         *
+         * @param ePriority - The priority class the coroutine is resumed under.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void SetThreadPriority(const THREAD_PRIORITIES ePriority) { m_eThreadPriority = ePriority; }
+
+        /******************************************************************************
+         * @brief Accessor for the Thread Priority private member.
+         *
+         * @return THREAD_PRIORITIES - The priority class the coroutine is resumed under.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        THREAD_PRIORITIES GetThreadPriority() const { return m_eThreadPriority; }
+
+        /******************************************************************************
+         * @brief Accessor for how long it has been since the coroutine last finished an
+         *      iteration. Time spent suspended on an await inside the iteration counts, so
+         *      a coroutine waiting on an event that is never set shows up here.
+         *
+         * @return std::optional<std::chrono::steady_clock::duration> - The time since the last iteration finished. Empty if the coroutine isn't running.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        std::optional<std::chrono::steady_clock::duration> GetTimeSinceHeartbeat() const
+        {
+            // A coroutine that is stopping or stopped isn't expected to iterate.
+            if (m_eThreadState == AutonomyThreadState::eStopping || m_eThreadState == AutonomyThreadState::eStopped)
+            {
+                return std::nullopt;
+            }
+
+            return std::chrono::steady_clock::now() - m_tmLastHeartbeat.load();
+        }
+
+        /******************************************************************************
+         * @brief Accessor for the Frame I P S private member.
+         *
+         * @return IPS& - The iteration per second counter for the ThreadedContinuousCode()
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        IPS& GetIPS() { return m_IPS; }
+
+    protected:
+        /////////////////////////////////////////
+        // Declare protected objects.
+        /////////////////////////////////////////
+        IPS m_IPS = IPS();
+
+        /////////////////////////////////////////
+        // Declare and define protected class methods.
+        /////////////////////////////////////////
+
+        /******************************************************************************
+         * @brief Mutator for the Main Thread Max I P S private member. Iterations are held
+         *      to fixed deadlines by awaiting a timer, so the wait doesn't hold a thread.
+         *
+         * @param nMaxIterationsPerSecond - The max iteration per second limit of the coroutine.
+         *
+         * @note - Set to zero to disable the max iteration per second limit.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void SetMainThreadIPSLimit(int nMaxIterationsPerSecond = 0)
+        {
+            // Assign member variable.
+            m_nMainThreadMaxIterationPerSecond = nMaxIterationsPerSecond;
+        }
+
+        /******************************************************************************
+         * @brief Accessor for the Main Thread Max I P S private member.
+         *
+         * @return int - The max iterations per second the coroutine can reach.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        int GetMainThreadMaxIPS() const
+        {
+            // Return member variable value.
+            return m_nMainThreadMaxIterationPerSecond;
+        }
+
+        /////////////////////////////////////////
+        // Awaitables for use in ThreadedContinuousCode().
+        /////////////////////////////////////////
+
+        CoroutineReactor::EventAwaiter WaitForEvent(CoroutineReactor::Event& stEvent)
+        {
+            return CoroutineReactor::GetSharedReactor().WaitForEvent(stEvent, m_eThreadPriority);
+        }
+        CoroutineReactor::TaskAwaiter WaitForTask(WorkStealingExecutor& Executor, WorkStealingExecutor::TaskGroup& stTaskGroup, std::function<void()> fnTask)
+        {
+            return CoroutineReactor::GetSharedReactor().WaitForTask(Executor, stTaskGroup, std::move(fnTask), m_eThreadPriority);
+        }
+        CoroutineReactor::TimerAwaiter WaitUntil(const std::chrono::steady_clock::time_point& tmDeadline)
+        {
+            return CoroutineReactor::GetSharedReactor().WaitUntil(tmDeadline, m_eThreadPriority);
+        }
+        CoroutineReactor::TimerAwaiter WaitFor(const std::chrono::steady_clock::duration& tmDuration)
+        {
+            return CoroutineReactor::GetSharedReactor().WaitFor(tmDuration, m_eThreadPriority);
+        }
+        CoroutineReactor::FileAwaiter WaitForReadable(const int nFileDescriptor)
+        {
+            return CoroutineReactor::GetSharedReactor().WaitForReadable(nFileDescriptor, m_eThreadPriority);
+        }
+        CoroutineReactor::FileAwaiter WaitForWritable(const int nFileDescriptor)
+        {
+            return CoroutineReactor::GetSharedReactor().WaitForWritable(nFileDescriptor, m_eThreadPriority);
+        }
+
+    private:
+        /////////////////////////////////////////
+        // Declare private class member variables.
+        /////////////////////////////////////////
+
+        AutonomyTask m_tkMainCoroutine;
+        std::atomic_bool m_bStopThreads;
+        std::atomic<AutonomyThreadState> m_eThreadState;
+        std::mutex m_muThreadStateMutex;
+        std::condition_variable m_cdThreadStateCondition;
+        bool m_bCoroutineFinished;
+        std::atomic_int m_nMainThreadMaxIterationPerSecond;
+        std::atomic<THREAD_PRIORITIES> m_eThreadPriority;
+        std::atomic<std::chrono::steady_clock::time_point> m_tmLastHeartbeat;
+
+        /////////////////////////////////////////
+        // Declare and/or define private methods.
+        /////////////////////////////////////////
+
+        // Declare interface class pure virtual functions. (These must be overriden by inheritor.)
+        virtual AutonomyTask ThreadedContinuousCode() = 0;    // This is where user's main continuously looping coroutine code will go.
+
+        /******************************************************************************
+         * @brief The coroutine that loops ThreadedContinuousCode() until stopped, waiting
+         *      for the next deadline between iterations if there is an IPS limit. Iterations
+         *      that run past a deadline skip ahead to the next one. Without a limit it yields
+         *      between iterations, so it can't hog an executor worker.
+         *
+         * @return AutonomyTask - The loop coroutine.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        AutonomyTask RunCoroutine()
+        {
+            // Declare instance variables. Iterations are scheduled from when the coroutine started.
+            std::chrono::steady_clock::time_point tmDeadline = std::chrono::steady_clock::now();
+            int nLastMaxIterationPerSecond                   = m_nMainThreadMaxIterationPerSecond;
+
+            // Loop until stop flag is set.
+            while (!m_bStopThreads)
+            {
+                // Run user code.
+                co_await this->ThreadedContinuousCode();
+                // Record that an iteration finished.
+                m_tmLastHeartbeat = std::chrono::steady_clock::now();
+
+                // Check if max IPS limit has been set.
+                int nMaxIterationPerSecond = m_nMainThreadMaxIterationPerSecond;
+                if (nMaxIterationPerSecond > 0)
+                {
+                    // Move on to the next deadline. A changed limit starts a new schedule.
+                    const std::chrono::nanoseconds tmPeriod(1000000000 / nMaxIterationPerSecond);
+                    std::chrono::steady_clock::time_point tmCurrentTime = std::chrono::steady_clock::now();
+                    if (nMaxIterationPerSecond != nLastMaxIterationPerSecond)
+                    {
+                        tmDeadline = tmCurrentTime;
+                    }
+                    tmDeadline += tmPeriod;
+
+                    // Skip any deadlines that have already passed.
+                    unsigned int unSkippedIterations = 0;
+                    if (tmCurrentTime >= tmDeadline)
+                    {
+                        unSkippedIterations = static_cast<unsigned int>((tmCurrentTime - tmDeadline) / tmPeriod + 1);
+                        tmDeadline += tmPeriod * unSkippedIterations;
+                    }
+
+                    // Wait for the deadline without holding a thread, then record how late it woke up.
+                    co_await this->WaitUntil(tmDeadline);
+                    const double dJitterMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tmDeadline).count();
+                    m_IPS.TickDeadline(dJitterMicroseconds, unSkippedIterations > 0, unSkippedIterations);
+                }
+                else
+                {
+                    // Let other coroutines run.
+                    co_await CoroutineReactor::GetSharedReactor().Yield(m_eThreadPriority);
+                }
+                nLastMaxIterationPerSecond = nMaxIterationPerSecond;
+
+                // Check if thread state needs to be updated.
+                if (m_eThreadState != AutonomyThreadState::eRunning && m_eThreadState != AutonomyThreadState::eStopping)
+                {
+                    // Update thread state to running.
+                    m_eThreadState = AutonomyThreadState::eRunning;
+                    // Notify waiting start method that thread is now running.
+                    std::lock_guard<std::mutex> lkStateLock(m_muThreadStateMutex);
+                    m_cdThreadStateCondition.notify_all();
+                }
+
+                // Call iteration per second tracking tick.
+                m_IPS.Tick();
+            }
+        }
+};
+
+#endif    // AUTONOMYCOROUTINE_H
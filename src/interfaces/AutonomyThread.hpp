@@ -15,12 +15,20 @@
 #define AUTONOMYTHREAD_H
 
 #include "../util/IPS.hpp"
+#include "../util/ThreadScheduling.hpp"
+#include "../util/WorkStealingExecutor.hpp"
 
 /// \cond
 #include "../../external/threadpool/include/BS_thread_pool.hpp"
 #include <atomic>
 #include <chrono>
+#include <algorithm>
 #include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <vector>
 
 /// \endcond
@@ -50,6 +58,13 @@ class AutonomyThread
             eStopped
         };
 
+        // Define an enum for what the main thread does after an iteration runs past its deadline.
+        enum class IPSOverrunPolicy
+        {
+            eCatchUp,    // Run the missed iterations right away to keep the average rate, up to m_nMaxCatchUpIterations behind.
+            eSkip        // Drop the missed iterations and carry on from the next deadline.
+        };
+
         /////////////////////////////////////////
         // Declare and define public class methods.
         /////////////////////////////////////////
@@ -66,6 +81,18 @@ class AutonomyThread
             m_bStopThreads                     = false;
             m_eThreadState                     = AutonomyThreadState::eStopped;
             m_nMainThreadMaxIterationPerSecond = 0;
+            m_eMainThreadOverrunPolicy         = IPSOverrunPolicy::eCatchUp;
+            m_nMainThreadSpinMicroseconds      = 0;
+            m_eThreadPriority                  = THREAD_PRIORITIES::eNormal;
+            m_unCPUAffinityMask                = 0;
+            m_bThreadSchedulingChanged         = false;
+            m_bThreadSchedulingApplied         = true;
+            m_pMainThreadGeneration            = std::make_shared<std::atomic_uint64_t>(0);
+            m_tmLastHeartbeat                  = std::chrono::steady_clock::now();
+
+            // Create the main thread.
+            m_vMainThreads.emplace_back(std::make_unique<BS::thread_pool>(1));
+            m_pMainThread = m_vMainThreads.back().get();
         }
 
         /******************************************************************************
@@ -86,14 +113,25 @@ class AutonomyThread
             m_eThreadState = AutonomyThreadState::eStopping;
 
             // Pause and clear pool queues.
-            m_thPool.pause();
-            m_thPool.purge();
-            m_thMainThread.pause();
-            m_thMainThread.purge();
+            WorkStealingExecutor::GetSharedExecutor().Purge(m_stPoolTasks);
+            m_pMainThread.load()->pause();
+            m_pMainThread.load()->purge();
 
             // Wait for all pools to finish.
-            m_thPool.wait();
-            m_thMainThread.wait();
+            WorkStealingExecutor::GetSharedExecutor().Wait(m_stPoolTasks);
+            m_pMainThread.load()->wait();
+
+            // Give any main thread that was replaced a moment to return from the call it was stuck in.
+            std::lock_guard<std::mutex> lkMainThreadLock(m_muMainThreadMutex);
+            for (std::unique_ptr<BS::thread_pool>& pMainThread : m_vMainThreads)
+            {
+                // Destroying the pool of a thread that is still stuck would block until it returns, so hand it off to be destroyed once it does.
+                // The stuck thread only uses the generation it holds a copy of after returning, so it never touches this object again.
+                if (!pMainThread->wait_for(std::chrono::milliseconds(m_nReplacedThreadWaitMilliseconds)))
+                {
+                    std::thread([pStuckThread = std::move(pMainThread)]() { pStuckThread->wait(); }).detach();
+                }
+            }
             // Update thread state.
             m_eThreadState = AutonomyThreadState::eStopped;
         }
@@ -122,10 +160,9 @@ class AutonomyThread
             m_eThreadState = AutonomyThreadState::eStopping;
 
             // Pause queuing of new tasks to the threads, then purge them.
-            m_thPool.pause();
-            m_thPool.purge();
-            m_thMainThread.pause();
-            m_thMainThread.purge();
+            WorkStealingExecutor::GetSharedExecutor().Purge(m_stPoolTasks);
+            m_pMainThread.load()->pause();
+            m_pMainThread.load()->purge();
 
             // Wait for loop, pool and main thread to join.
             this->Join();
@@ -136,13 +173,18 @@ class AutonomyThread
             m_vPoolReturns.clear();
             // Reset thread stop toggle.
             m_bStopThreads = false;
+            // The thread hasn't had a chance to run yet, so it isn't late.
+            m_tmLastHeartbeat = std::chrono::steady_clock::now();
 
             // Submit single task to pool queue and store resulting future. Still using pool, as it's scheduling is more efficient.
-            std::future<void> fuMainReturn = m_thMainThread.submit_task([this]() { this->RunThread(m_bStopThreads); });
+            std::unique_lock<std::mutex> lkMainThreadLock(m_muMainThreadMutex);
+            const uint64_t unGeneration    = *m_pMainThreadGeneration;
+            std::future<void> fuMainReturn = m_pMainThread.load()->submit_task([this, unGeneration, pGeneration = m_pMainThreadGeneration]()
+                                                                               { this->RunThread(m_bStopThreads, unGeneration, pGeneration); });
 
             // Unpause pool queues.
-            m_thPool.unpause();
-            m_thMainThread.unpause();
+            m_pMainThread.load()->unpause();
+            lkMainThreadLock.unlock();
 
             // Block until thread is started or currently stopping if thread start failed.
             std::unique_lock<std::mutex> lkStartLock(m_muThreadRunningConditionMutex);
@@ -180,9 +222,9 @@ class AutonomyThread
         void Join()
         {
             // Wait for pool to finish all tasks.
-            m_thPool.wait();
+            WorkStealingExecutor::GetSharedExecutor().Wait(m_stPoolTasks);
             // Wait for main thread to finish.
-            m_thMainThread.wait();
+            m_pMainThread.load()->wait();
 
             // Update thread state.
             m_eThreadState = AutonomyThreadState::eStopped;
@@ -200,7 +242,7 @@ class AutonomyThread
          ******************************************************************************/
         bool Joinable() const
         {    // Check current number of running and queued tasks.
-            return (m_thMainThread.get_tasks_total() <= 0 && m_thPool.get_tasks_total() <= 0);
+            return (m_pMainThread.load()->get_tasks_total() <= 0 && m_stPoolTasks.GetPendingTasks() <= 0);
         }
 
         /******************************************************************************
@@ -223,6 +265,121 @@ class AutonomyThread
          ******************************************************************************/
         IPS& GetIPS() { return m_IPS; }
 
+        /******************************************************************************
+         * @brief Mutator for the Thread Priority and CPU Affinity Mask private members. The
+         *      main thread is moved into the priority class and onto the CPUs before its next
+         *      iteration, and pool tasks queued from then on are taken by the executor in
+         *      priority order.
+         *
+         * @param ePriority - The priority class of the main thread and pools.
+         * @param unCPUAffinityMask - A bit for each CPU the main thread may run on, with bit 0
+         *      as CPU 0. Zero lets it run on any CPU. Pools run on the shared executor, so
+         *      they aren't pinned.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void SetThreadPriority(const THREAD_PRIORITIES ePriority, const uint64_t unCPUAffinityMask = 0)
+        {
+            // Assign member variables.
+            m_eThreadPriority   = ePriority;
+            m_unCPUAffinityMask = unCPUAffinityMask;
+            m_stPoolTasks.SetPriority(ePriority);
+            // Signal the main thread to apply them.
+            m_bThreadSchedulingChanged = true;
+        }
+
+        /******************************************************************************
+         * @brief Accessor for the Thread Priority private member.
+         *
+         * @return THREAD_PRIORITIES - The priority class of the main thread and pools.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        THREAD_PRIORITIES GetThreadPriority() const { return m_eThreadPriority; }
+
+        /******************************************************************************
+         * @brief Check if the main thread was given its priority class and CPUs. Moving a
+         *      thread ahead of others needs CAP_SYS_NICE or a matching rlimit, so this is
+         *      usually false when the program isn't allowed to.
+         *
+         * @return true - The main thread's scheduling matches its priority class and CPUs.
+         * @return false - The last attempt to apply them failed.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        bool GetThreadSchedulingApplied() const { return m_bThreadSchedulingApplied; }
+
+        /******************************************************************************
+         * @brief Accessor for how long it has been since the main thread last finished
+         *      an iteration. A thread that is waiting for its next IPS deadline is still
+         *      counted, so this is normally under one period. Much longer means the user
+         *      code is stuck.
+         *
+         * @return std::optional<std::chrono::steady_clock::duration> - The time since the last iteration finished. Empty if the thread isn't running.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        std::optional<std::chrono::steady_clock::duration> GetTimeSinceHeartbeat() const
+        {
+            // A thread that is stopping or stopped isn't expected to iterate.
+            if (m_eThreadState == AutonomyThreadState::eStopping || m_eThreadState == AutonomyThreadState::eStopped)
+            {
+                return std::nullopt;
+            }
+
+            return std::chrono::steady_clock::now() - m_tmLastHeartbeat.load();
+        }
+
+        /******************************************************************************
+         * @brief Gives up on a main thread that is stuck in a call that can't be interrupted,
+         *      like a read inside a driver, and starts a new one running ThreadedContinuousCode().
+         *      The stuck thread is left to return on its own and exits as soon as it does.
+         *      Until then it is still inside the user code, so the user code must check
+         *      GetMainThreadWasReplaced() after any call that can get stuck, and not touch
+         *      anything shared with the new thread once it was. Pools are shared, so they
+         *      keep running.
+         *
+         * @return true - A new main thread was started.
+         * @return false - The thread is stopping or stopped, so it was left alone.
+         *
+         * @note The stuck thread's pool is destroyed the next time a thread is replaced after it
+         *      has returned. If it still hasn't returned when this object is destroyed, it is
+         *      destroyed in the background once it does.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        bool ReplaceMainThread()
+        {
+            // Acquire lock on the main threads.
+            std::lock_guard<std::mutex> lkMainThreadLock(m_muMainThreadMutex);
+            // A thread that was asked to stop should be joined, not replaced.
+            if (m_bStopThreads || m_eThreadState == AutonomyThreadState::eStopped)
+            {
+                return false;
+            }
+
+            // Destroy the pools of threads that were replaced before and have since returned, so they don't pile up on a camera that keeps stalling.
+            std::erase_if(m_vMainThreads,
+                          [this](const std::unique_ptr<BS::thread_pool>& pMainThread)
+                          { return pMainThread.get() != m_pMainThread.load() && pMainThread->get_tasks_total() == 0; });
+
+            // Tell the stuck thread to exit when it returns, and start a new one in its place.
+            const uint64_t unGeneration = ++*m_pMainThreadGeneration;
+            m_vMainThreads.emplace_back(std::make_unique<BS::thread_pool>(1));
+            m_pMainThread = m_vMainThreads.back().get();
+            // The new thread starts out with the default scheduling, so move it into the priority class and onto the CPUs.
+            m_bThreadSchedulingChanged = true;
+            m_pMainThread.load()->detach_task([this, unGeneration, pGeneration = m_pMainThreadGeneration]()
+                                              { this->RunThread(m_bStopThreads, unGeneration, pGeneration); });
+
+            return true;
+        }
+
     protected:
         /////////////////////////////////////////
         // Declare protected objects.
@@ -235,9 +392,8 @@ class AutonomyThread
 
         /******************************************************************************
          * @brief When this method is called, it starts/adds tasks to a thread pool that runs nNumTasksToQueue
-         *      copies of the code within the PooledLinearCode() method using nNumThreads number of threads. This is meant to be
+         *      copies of the code within the PooledLinearCode() method. This is meant to be
          *      used as an internal utility of the child class to further improve parallelization.
-         *      Default value for nNumThreads is 2.
          *
          *      If this method is called directly after itself or RunDetachedPool(), it will just add more
          *      tasks to the queue. If the bForceStopCurrentThreads is enabled, it will signal
@@ -245,60 +401,44 @@ class AutonomyThread
          *      tasks that are still queued will be cleared. Old results will be destroyed. If you want
          *      to wait until they fully execute their code, then call the Join() method before this one.
          *
-         *      Once the pool is created it stays alive for as long as the program runs or until
-         *      a different threading method is called. So there's no overhead with starting and
-         *      stopping threads or queueing more tasks.
+         *      Tasks run on the WorkStealingExecutor shared by the whole program, which has one
+         *      thread per core, so there's no overhead with starting and stopping threads. The
+         *      tasks queued by this object are tracked as their own group, so JoinPool() and
+         *      ClearPoolQueue() only wait on and clear this object's tasks.
          *
          *      YOU MUST HANDLE MUTEX LOCKS AND ATOMICS. It is impossible for this class to handle
          *      locks as all possible solutions lead to a solution that only lets one thread run at
          *      a time, essentially canceling out the parallelism.
          *
          * @param nNumTasksToQueue - The number of tasks running PooledLinearCode() to queue.
-         * @param nNumThreads - The number of threads to run user code in.
          * @param bForceStopCurrentThreads - Clears the current tasks queue then signals and waits for existing
          *                                  tasks to stop before queueing more.
          *
          * @author ClayJay3 (claytonraycowen@gmail.com)
          * @date 2023-07-23
          ******************************************************************************/
-        void RunPool(const unsigned int nNumTasksToQueue, const unsigned int nNumThreads = 2, const bool bForceStopCurrentThreads = false)
+        void RunPool(const unsigned int nNumTasksToQueue, const bool bForceStopCurrentThreads = false)
         {
-            // Check if the pools need to be resized.
-            if (m_thPool.get_thread_count() != nNumThreads)
-            {
-                // Pause queuing of new tasks to the threads, then purge them.
-                m_thPool.pause();
-                m_thPool.purge();
-                // Wait for open threads to terminate, then resize the pool.
-                m_thPool.reset(nNumThreads);
-                // Unpause queue.
-                m_thPool.unpause();
-
-                // Clear results vector.
-                m_vPoolReturns.clear();
-            }
             // Check if the current pool tasks should be stopped before queueing more tasks.
-            else if (bForceStopCurrentThreads)
+            if (bForceStopCurrentThreads)
             {
-                // Pause queuing of new tasks to the threads, then purge them.
-                m_thPool.pause();
-                m_thPool.purge();
-                // Wait for threadpool to join.
-                m_thPool.wait();
-                // Unpause queue.
-                m_thPool.unpause();
+                // Purge queued tasks, then wait for running ones to finish.
+                WorkStealingExecutor::GetSharedExecutor().Purge(m_stPoolTasks);
+                WorkStealingExecutor::GetSharedExecutor().Wait(m_stPoolTasks);
             }
 
-            // Loop nNumThreads times and queue tasks.
+            // Loop nNumTasksToQueue times and queue tasks.
             for (unsigned int i = 0; i < nNumTasksToQueue; ++i)
             {
-                // Submit single task to pool queue.
-                m_vPoolReturns.emplace_back(m_thPool.submit_task(
+                // Submit single task to pool queue. The packaged task is shared, since the executor copies tasks.
+                std::shared_ptr<std::packaged_task<T()>> pTask = std::make_shared<std::packaged_task<T()>>(
                     [this]()
                     {
                         // Run user pool code without lock.
-                        this->PooledLinearCode();
-                    }));
+                        return this->PooledLinearCode();
+                    });
+                m_vPoolReturns.emplace_back(pTask->get_future());
+                WorkStealingExecutor::GetSharedExecutor().Submit(m_stPoolTasks, [pTask]() { (*pTask)(); });
             }
         }
 
@@ -317,55 +457,38 @@ class AutonomyThread
          *      Any number of tasks that are still queued will be cleared. Old results will be destroyed.
          *      If you want to wait until they fully execute their code, then call the Join() method before this one.
          *
-         *      Once the pool is created it stays alive for as long as the program runs or until
-         *      a different threading method is called. So there's no overhead with starting and
-         *      stopping threads or queueing more tasks.
+         *      Tasks run on the WorkStealingExecutor shared by the whole program, which has one
+         *      thread per core, so there's no overhead with starting and stopping threads. The
+         *      tasks queued by this object are tracked as their own group, so JoinPool() and
+         *      ClearPoolQueue() only wait on and clear this object's tasks.
          *
          *      YOU MUST HANDLE MUTEX LOCKS AND ATOMICS. It is impossible for this class to handle
          *      locks as all possible solutions lead to a solution that only lets one thread run at
          *      a time, essentially canceling out the parallelism.
          *
          * @param nNumTasksToQueue - The number of tasks running PooledLinearCode() to queue.
-         * @param nNumThreads - The number of threads to run user code in.
          * @param bForceStopCurrentThreads - Clears the current tasks queue then signals and waits for existing
          *                                  tasks to stop before queueing more.
          *
          * @author ClayJay3 (claytonraycowen@gmail.com)
          * @date 2023-07-23
          ******************************************************************************/
-        void RunDetachedPool(const unsigned int nNumTasksToQueue, const unsigned int nNumThreads = 2, const bool bForceStopCurrentThreads = false)
+        void RunDetachedPool(const unsigned int nNumTasksToQueue, const bool bForceStopCurrentThreads = false)
         {
-            // Check if the pools need to be resized.
-            if (m_thPool.get_thread_count() != nNumThreads)
-            {
-                // Pause queuing of new tasks to the threads, then purge them.
-                m_thPool.pause();
-                m_thPool.purge();
-                // Wait for open threads to terminate, then resize the pool.
-                m_thPool.reset(nNumThreads);
-                // Unpause queue.
-                m_thPool.unpause();
-
-                // Clear results vector.
-                m_vPoolReturns.clear();
-            }
             // Check if the current pool tasks should be stopped before queueing more tasks.
-            else if (bForceStopCurrentThreads)
+            if (bForceStopCurrentThreads)
             {
-                // Pause queuing of new tasks to the threads, then purge them.
-                m_thPool.pause();
-                m_thPool.purge();
-                // Wait for threadpool to join.
-                m_thPool.wait();
-                // Unpause queue.
-                m_thPool.unpause();
+                // Purge queued tasks, then wait for running ones to finish.
+                WorkStealingExecutor::GetSharedExecutor().Purge(m_stPoolTasks);
+                WorkStealingExecutor::GetSharedExecutor().Wait(m_stPoolTasks);
             }
 
-            // Loop nNumThreads times and queue tasks.
+            // Loop nNumTasksToQueue times and queue tasks.
             for (unsigned int i = 0; i < nNumTasksToQueue; ++i)
             {
                 // Push single task to pool queue. No return value no control.
-                m_thPool.detach_task(
+                WorkStealingExecutor::GetSharedExecutor().Submit(
+                    m_stPoolTasks,
                     [this]()
                     {
                         // Run user code without lock.
@@ -376,46 +499,130 @@ class AutonomyThread
 
         /******************************************************************************
          * @brief Given a ref-qualified looping function and an arbitrary number of iterations,
-         *      this method will divide up the loop and run each section in a thread pool.
-         *      This function must not return anything. This method will block until the
-         *      loop has completed.
+         *      this method will divide up the loop and run each section on the shared
+         *      WorkStealingExecutor. This function must not return anything. This method will
+         *      block until the loop has completed, and runs sections itself while it waits.
+         *
+         *      The first few iterations are run on the calling thread in growing blocks to
+         *      measure how long an iteration takes. Loops that are cheap enough are finished
+         *      right there without touching the executor. Otherwise the rest is split into
+         *      blocks that take at least m_nLoopBlockNanoseconds each, so the scheduling cost
+         *      stays small next to the work. Threads take large blocks while there is plenty
+         *      left and smaller ones toward the end, so they all finish at about the same time
+         *      even if some iterations cost more than others.
          *
-         *      To see an example of how to use this function, check out ArucoGenerateTags in
-         *      the threads example folder.
+         *      To see an example of how to use this function, check out how BasicCam serves
+         *      its frame copies in ThreadedContinuousCode().
          *
          *      YOU MUST HANDLE MUTEX LOCKS AND ATOMICS. It is impossible for this class to handle
          *      locks as all possible solutions lead to a solution that only lets one thread run at
          *      a time, essentially canceling out the parallelism.
          *
-         * @tparam N - Template argument for the nTotalIterations type.
+         * @tparam N - Template argument for the tTotalIterations type. Any signed or unsigned integer type.
          * @tparam F - Template argument for the given function reference.
-         * @param nNumThreads - The number of threads to use for the thread pool.
-         * @param nTotalIterations - The total iterations to loop for.
-         * @param tLoopFunction - Ref-qualified function to run.
-         *                       MUST ACCEPT TWO ARGS: const int a, const int b.
-         *                       a - loop start
-         *                       b - loop end
-         *
+         * @param nNumThreads - The most threads to run the loop on at once, including the calling thread.
+         * @param tTotalIterations - The total iterations to loop for.
+         * @param tLoopFunction - Ref-qualified function to run on each block of the loop.
+         *                       MUST ACCEPT TWO ARGS OF TYPE N: const N tStart, const N tEnd.
+         *                       tStart - The first iteration of the block.
+         *                       tEnd - One past the last iteration of the block.
+         * @param pCancelLoop - Optional flag that stops the loop early when set. Blocks that already
+         *                      started are finished, the rest are skipped.
+         * @return true - Every iteration was run.
+         * @return false - The loop was cancelled before it finished.
          *
          * @author ClayJay3 (claytonraycowen@gmail.com)
          * @date 2023-07-26
          ******************************************************************************/
         template<typename N, typename F>
-        void ParallelizeLoop(const int nNumThreads, const N tTotalIterations, F&& tLoopFunction)
+        bool ParallelizeLoop(const int nNumThreads, const N tTotalIterations, F&& tLoopFunction, const std::atomic_bool* pCancelLoop = nullptr)
         {
-            // Create new thread pool.
-            BS::thread_pool m_thLoopPool = BS::thread_pool(nNumThreads);
+            // Check if there is anything to loop over.
+            if (tTotalIterations <= 0)
+            {
+                return true;
+            }
+
+            // Run the start of the loop here in doubling blocks to measure how long an iteration takes.
+            N tStart     = 0;
+            N tProbeSize = 1;
+            std::chrono::nanoseconds tmProbeTime(0);
+            while (tStart < tTotalIterations && tmProbeTime.count() < m_nLoopProbeNanoseconds)
+            {
+                // Check if the loop was cancelled.
+                if (pCancelLoop != nullptr && *pCancelLoop)
+                {
+                    return false;
+                }
+
+                // Run and time the block.
+                const N tEnd                                       = tStart + std::min<N>(tProbeSize, tTotalIterations - tStart);
+                std::chrono::steady_clock::time_point tmBlockStart = std::chrono::steady_clock::now();
+                tLoopFunction(tStart, tEnd);
+                tmProbeTime += std::chrono::steady_clock::now() - tmBlockStart;
+                tStart = tEnd;
+                tProbeSize *= 2;
+            }
+            // Check if the whole loop was cheap enough to finish while measuring.
+            if (tStart >= tTotalIterations)
+            {
+                return true;
+            }
+
+            // Size the blocks so each one takes long enough to be worth handing to another thread.
+            const double dNanosecondsPerIteration = std::max(1.0, static_cast<double>(tmProbeTime.count()) / static_cast<double>(tStart));
+            const N tMinBlockSize                 = std::max<N>(1, static_cast<N>(m_nLoopBlockNanoseconds / dNanosecondsPerIteration));
+            // Only use as many threads as there are blocks to go around.
+            const N tRemainingBlocks = (tTotalIterations - tStart + tMinBlockSize - 1) / tMinBlockSize;
+            const int nMaxRunners    = std::min<int>(std::max(1, nNumThreads), WorkStealingExecutor::GetSharedExecutor().GetThreadCount() + 1);
+            const int nNumRunners    = static_cast<int>(std::min<N>(tRemainingBlocks, static_cast<N>(nMaxRunners)));
+
+            // Shared between every thread running the loop.
+            std::atomic<N> tNextIteration(tStart);
+            std::atomic_bool bLoopCancelled(false);
+            // Runs blocks until the loop is done or cancelled.
+            auto RunBlocks = [&tLoopFunction, &tNextIteration, &bLoopCancelled, tTotalIterations, tMinBlockSize, nNumRunners, pCancelLoop]()
+            {
+                while (true)
+                {
+                    // Check if the loop was cancelled.
+                    if (bLoopCancelled || (pCancelLoop != nullptr && *pCancelLoop))
+                    {
+                        bLoopCancelled = true;
+                        return;
+                    }
+
+                    // Claim the next block. Blocks are a share of what's left, but never smaller than the minimum.
+                    N tBlockStart = tNextIteration.load(std::memory_order_relaxed);
+                    N tBlockSize  = 0;
+                    do
+                    {
+                        if (tBlockStart >= tTotalIterations)
+                        {
+                            return;
+                        }
+                        tBlockSize = std::min<N>(tTotalIterations - tBlockStart,
+                                                 std::max<N>(tMinBlockSize, (tTotalIterations - tBlockStart) / static_cast<N>(2 * nNumRunners)));
+                    } while (!tNextIteration.compare_exchange_weak(tBlockStart, tBlockStart + tBlockSize, std::memory_order_relaxed));
+
+                    // Call loop function without lock.
+                    tLoopFunction(tBlockStart, tBlockStart + tBlockSize);
+                }
+            };
 
-            m_thLoopPool.detach_blocks(0,
-                                       tTotalIterations,
-                                       [&tLoopFunction](const int nStart, const int nEnd)
-                                       {
-                                           // Call loop function without lock.
-                                           tLoopFunction(nStart, nEnd);
-                                       });
+            // Start the other threads, then work on the loop here too. They run in this object's priority class.
+            WorkStealingExecutor::TaskGroup stLoopTasks;
+            stLoopTasks.SetPriority(m_eThreadPriority);
+            for (int nRunner = 1; nRunner < nNumRunners; ++nRunner)
+            {
+                WorkStealingExecutor::GetSharedExecutor().Submit(stLoopTasks, RunBlocks);
+            }
+            RunBlocks();
 
             // Wait for loop to finish.
-            m_thLoopPool.wait();
+            WorkStealingExecutor::GetSharedExecutor().Wait(stLoopTasks);
+
+            return !bLoopCancelled;
         }
 
         /******************************************************************************
@@ -426,7 +633,7 @@ class AutonomyThread
          * @author ClayJay3 (claytonraycowen@gmail.com)
          * @date 2023-09-09
          ******************************************************************************/
-        void ClearPoolQueue() { m_thPool.purge(); }
+        void ClearPoolQueue() { WorkStealingExecutor::GetSharedExecutor().Purge(m_stPoolTasks); }
 
         /******************************************************************************
          * @brief Waits for pool to finish executing tasks. This method will block
@@ -436,7 +643,7 @@ class AutonomyThread
          * @author ClayJay3 (claytonraycowen@gmail.com)
          * @date 2023-07-22
          ******************************************************************************/
-        void JoinPool() { m_thPool.wait(); }
+        void JoinPool() { WorkStealingExecutor::GetSharedExecutor().Wait(m_stPoolTasks); }
 
         /******************************************************************************
          * @brief Check if the internal pool threads are done executing code and the
@@ -451,7 +658,7 @@ class AutonomyThread
         bool PoolJoinable() const
         {
             // Check current number of running and queued tasks.
-            return (m_thPool.get_tasks_total() <= 0);
+            return (m_stPoolTasks.GetPendingTasks() <= 0);
         }
 
         /******************************************************************************
@@ -471,24 +678,57 @@ class AutonomyThread
         }
 
         /******************************************************************************
-         * @brief Accessor for the Pool Num Of Threads private member.
+         * @brief Mutator for the Main Thread Overrun Policy private member. Sets what the
+         *      main thread does when an iteration runs past the next deadline.
+         *
+         * @param eOverrunPolicy - Whether to catch up on or skip missed iterations.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void SetMainThreadOverrunPolicy(const IPSOverrunPolicy eOverrunPolicy)
+        {
+            // Assign member variable.
+            m_eMainThreadOverrunPolicy = eOverrunPolicy;
+        }
+
+        /******************************************************************************
+         * @brief Mutator for the Main Thread Spin Time private member. The main thread
+         *      sleeps until this long before each deadline, then spins the rest of the way,
+         *      which trades some CPU for much less wake up jitter.
+         *
+         * @param nSpinMicroseconds - How long to spin before each deadline.
+         *
+         * @note - Set to zero to only sleep.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void SetMainThreadSpinTime(const int nSpinMicroseconds = 0)
+        {
+            // Assign member variable.
+            m_nMainThreadSpinMicroseconds = nSpinMicroseconds;
+        }
+
+        /******************************************************************************
+         * @brief Accessor for the number of threads in the shared executor the pool runs on.
          *
          * @return int - The number of threads available to the pool.
          *
          * @author ClayJay3 (claytonraycowen@gmail.com)
          * @date 2023-09-09
          ******************************************************************************/
-        int GetPoolNumOfThreads() { return m_thPool.get_thread_count(); }
+        int GetPoolNumOfThreads() { return WorkStealingExecutor::GetSharedExecutor().GetThreadCount(); }
 
         /******************************************************************************
          * @brief Accessor for the Pool Queue Size private member.
          *
-         * @return int - The number of tasks queued for the pool.
+         * @return int - The number of tasks this object has queued on the pool.
          *
          * @author clayjay3 (claytonraycowen@gmail.com)
          * @date 2024-03-14
          ******************************************************************************/
-        int GetPoolQueueLength() { return m_thPool.get_tasks_queued(); }
+        int GetPoolQueueLength() { return m_stPoolTasks.GetQueuedTasks(); }
 
         /******************************************************************************
          * @brief Accessor for the Pool Results private member. The action of getting
@@ -534,19 +774,68 @@ class AutonomyThread
             return m_nMainThreadMaxIterationPerSecond;
         }
 
+        /******************************************************************************
+         * @brief Check if the calling thread was replaced by ReplaceMainThread(). Only
+         *      meaningful when called from ThreadedContinuousCode(). It only reads the
+         *      generation the calling thread holds, so it is safe to call after returning
+         *      from a stuck call even if this object was destroyed in the meantime.
+         *
+         * @return true - This thread was replaced and must return without touching anything the new thread uses.
+         * @return false - This is the current main thread.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        static bool GetMainThreadWasReplaced()
+        {
+            // Compare the generation this thread was started with to the current one.
+            return s_pCurrentMainThreadGeneration && s_unCurrentMainThreadGeneration != *s_pCurrentMainThreadGeneration;
+        }
+
+        /******************************************************************************
+         * @brief Record that the main thread is alive. This is done after every iteration,
+         *      but user code that waits on purpose for longer than an iteration normally
+         *      takes should also call it while waiting, so it isn't mistaken for stuck.
+         *
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void Heartbeat() { m_tmLastHeartbeat = std::chrono::steady_clock::now(); }
+
     private:
         /////////////////////////////////////////
         // Declare private class member variables.
         /////////////////////////////////////////
 
-        BS::thread_pool m_thMainThread = BS::thread_pool(1);
-        BS::thread_pool m_thPool       = BS::thread_pool(2);
+        std::vector<std::unique_ptr<BS::thread_pool>> m_vMainThreads;
+        std::atomic<BS::thread_pool*> m_pMainThread;
+        std::mutex m_muMainThreadMutex;
+        std::shared_ptr<std::atomic_uint64_t> m_pMainThreadGeneration;
+        std::atomic<std::chrono::steady_clock::time_point> m_tmLastHeartbeat;
+        WorkStealingExecutor::TaskGroup m_stPoolTasks;
         std::vector<std::future<T>> m_vPoolReturns;
         std::atomic_bool m_bStopThreads;
         std::atomic<AutonomyThreadState> m_eThreadState;
         std::mutex m_muThreadRunningConditionMutex;
         std::condition_variable m_cdThreadRunningCondition;
-        int m_nMainThreadMaxIterationPerSecond;
+        std::atomic_int m_nMainThreadMaxIterationPerSecond;
+        std::atomic<IPSOverrunPolicy> m_eMainThreadOverrunPolicy;
+        std::atomic_int m_nMainThreadSpinMicroseconds;
+        std::atomic<THREAD_PRIORITIES> m_eThreadPriority;
+        std::atomic<uint64_t> m_unCPUAffinityMask;
+        std::atomic_bool m_bThreadSchedulingChanged;
+        std::atomic_bool m_bThreadSchedulingApplied;
+
+        // Define class constants.
+        static constexpr long int m_nLoopProbeNanoseconds      = 20000;    // How long ParallelizeLoop() runs the start of a loop to measure iteration cost.
+        static constexpr long int m_nLoopBlockNanoseconds      = 50000;    // The shortest block of a loop ParallelizeLoop() hands to another thread.
+        static constexpr int m_nMaxCatchUpIterations           = 3;        // The most iterations the main thread will catch up on before skipping instead.
+        static constexpr int m_nReplacedThreadWaitMilliseconds = 100;      // How long the destructor waits for each replaced main thread to return.
+
+        // The generation of the main thread running on this thread, and the object's current generation. Each main thread only runs for one object.
+        static inline thread_local uint64_t s_unCurrentMainThreadGeneration                             = 0;
+        static inline thread_local std::shared_ptr<std::atomic_uint64_t> s_pCurrentMainThreadGeneration = nullptr;
 
         /////////////////////////////////////////
         // Declare and/or define private methods.
@@ -557,6 +846,10 @@ class AutonomyThread
         virtual T PooledLinearCode()          = 0;    // This is where user's offshoot, highly parallelizable code will go. Helpful for intensive short-lived tasks.
                                                       // Can be ran from inside the ThreadedContinuousCode() method.
 
+        // Declare interface class virtual functions. (These can be overriden by inheritor.)
+        virtual void ThreadedStopCode() {}    // This is where user code that cleans up after the last ThreadedContinuousCode() iteration will go.
+                                              // Ran once in the main thread when it's stopped, but not when it's replaced.
+
         // Declare and define private interface methods.
         /******************************************************************************
          * @brief This method is ran in a separate thread. It is a middleware between the
@@ -564,44 +857,52 @@ class AutonomyThread
          *      user code. This method is intentionally designed to not return anything.
          *
          * @param bStopThread - Atomic shared variable that signals the thread to stop iterating.
+         * @param unGeneration - The main thread generation this thread was started for. It exits once it's replaced.
+         * @param pGeneration - The object's current main thread generation. This thread keeps its own copy, so a stuck
+         *      call that returns after the object is destroyed can still find out it was replaced.
          *
          * @author ClayJay3 (claytonraycowen@gmail.com)
          * @date 2023-07-24
          ******************************************************************************/
-        void RunThread(std::atomic_bool& bStopThread)
+        void RunThread(std::atomic_bool& bStopThread, const uint64_t unGeneration, const std::shared_ptr<std::atomic_uint64_t> pGeneration)
         {
-            // Declare instance variables.
-            std::chrono::_V2::system_clock::time_point tmStartTime;
-
-            // Loop until stop flag is set.
-            while (!bStopThread)
+            // Declare instance variables. Iterations are scheduled from when the thread started.
+            std::chrono::steady_clock::time_point tmDeadline = std::chrono::steady_clock::now();
+            int nLastMaxIterationPerSecond                   = m_nMainThreadMaxIterationPerSecond;
+            // Remember which generation this thread is, so the user code can tell if it was replaced.
+            s_unCurrentMainThreadGeneration = unGeneration;
+            s_pCurrentMainThreadGeneration  = pGeneration;
+
+            // Loop until stop flag is set or this thread is replaced.
+            while (!bStopThread && unGeneration == *pGeneration)
             {
-                // Check if max IPS limit has been set.
-                if (m_nMainThreadMaxIterationPerSecond > 0)
+                // Move this thread into its priority class and onto its CPUs if they were changed.
+                if (m_bThreadSchedulingChanged.exchange(false))
                 {
-                    // Get start execution time.
-                    tmStartTime = std::chrono::high_resolution_clock::now();
+                    bool bPriorityApplied      = scheduling::SetCurrentThreadPriority(m_eThreadPriority);
+                    m_bThreadSchedulingApplied = scheduling::SetCurrentThreadAffinity(m_unCPUAffinityMask) && bPriorityApplied;
                 }
 
                 // Call method containing user code.
                 this->ThreadedContinuousCode();
 
+                // Check if this thread was replaced while it was stuck in the user code. Everything below belongs to the new thread, and this
+                // object may already be gone.
+                if (unGeneration != *pGeneration)
+                {
+                    return;
+                }
+                // Record that an iteration finished.
+                this->Heartbeat();
+
                 // Check if max IPS limit has been set.
-                if (m_nMainThreadMaxIterationPerSecond > 0)
+                int nMaxIterationPerSecond = m_nMainThreadMaxIterationPerSecond;
+                if (nMaxIterationPerSecond > 0)
                 {
-                    // Get end execution time.
-                    std::chrono::_V2::system_clock::time_point tmEndTime = std::chrono::high_resolution_clock::now();
-                    // Get execution time of user code.
-                    std::chrono::microseconds tmElapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(tmEndTime - tmStartTime);
-                    // Check if the elapsed time is slower than the max iterations per seconds.
-                    if (tmElapsedTime.count() < (1.0 / m_nMainThreadMaxIterationPerSecond) * 1000000)
-                    {
-                        // Calculate the time to wait to stay under IPS cap.
-                        int nSleepTime = ((1.0 / m_nMainThreadMaxIterationPerSecond) * 1000000) - tmElapsedTime.count();
-                        // Make this thread sleep for the remaining time.
-                        std::this_thread::sleep_for(std::chrono::microseconds(nSleepTime));
-                    }
+                    // Wait for the next iteration's deadline. A changed limit starts a new schedule.
+                    this->WaitForNextDeadline(tmDeadline, nMaxIterationPerSecond, nMaxIterationPerSecond != nLastMaxIterationPerSecond);
                 }
+                nLastMaxIterationPerSecond = nMaxIterationPerSecond;
 
                 // Check if thread state needs to be updated.
                 if (m_eThreadState != AutonomyThreadState::eRunning && m_eThreadState != AutonomyThreadState::eStopping)
@@ -616,9 +917,84 @@ class AutonomyThread
                 m_IPS.Tick();
             }
 
+            // Check if this thread was replaced rather than stopped. A replaced thread leaves everything to the new one, and this object may already be gone.
+            if (unGeneration != *pGeneration)
+            {
+                return;
+            }
+
+            // Call method containing user cleanup code.
+            this->ThreadedStopCode();
+
             // Notify waiting start method that thread is now stopping.
             m_cdThreadRunningCondition.notify_all();
         }
+
+        /******************************************************************************
+         * @brief Sleeps until the next iteration's deadline. Deadlines are fixed points on
+         *      a monotonic clock one period apart, not a period after the last iteration
+         *      finished, so wake up lateness doesn't add up and the average rate stays at
+         *      the limit. If an iteration runs past the next deadline, the missed iterations
+         *      are either run right away or dropped depending on the overrun policy. The
+         *      wake up lateness and overruns are recorded in the IPS counter.
+         *
+         * @param tmDeadline - The deadline of the iteration that just ran. Moved to the next one.
+         * @param nMaxIterationPerSecond - The iteration per second limit.
+         * @param bRestartSchedule - Start a new schedule from now, for when the limit was just set or changed.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void WaitForNextDeadline(std::chrono::steady_clock::time_point& tmDeadline, const int nMaxIterationPerSecond, const bool bRestartSchedule)
+        {
+            // Get the time between iterations and the current time.
+            const std::chrono::nanoseconds tmPeriod(1000000000 / nMaxIterationPerSecond);
+            std::chrono::steady_clock::time_point tmCurrentTime = std::chrono::steady_clock::now();
+            // Check if the schedule should start over from now.
+            if (bRestartSchedule)
+            {
+                tmDeadline = tmCurrentTime;
+            }
+            // Move on to the next deadline.
+            tmDeadline += tmPeriod;
+
+            // Check if the iteration ran past the next deadline.
+            unsigned int unSkippedIterations = 0;
+            if (tmCurrentTime >= tmDeadline)
+            {
+                // Count how many deadlines have already passed.
+                const long int nMissedIterations = (tmCurrentTime - tmDeadline) / tmPeriod + 1;
+                // Catch up by running the next iteration right away, unless it's too far behind to be worth it.
+                if (m_eMainThreadOverrunPolicy == IPSOverrunPolicy::eCatchUp && nMissedIterations <= m_nMaxCatchUpIterations)
+                {
+                    m_IPS.TickDeadline(0.0, true, 0);
+                    return;
+                }
+
+                // Drop the missed iterations and line back up with the schedule.
+                tmDeadline += tmPeriod * nMissedIterations;
+                unSkippedIterations = static_cast<unsigned int>(nMissedIterations);
+            }
+
+            // Sleep until shortly before the deadline, then spin the rest of the way if asked to.
+            const std::chrono::microseconds tmSpinTime(m_nMainThreadSpinMicroseconds);
+            if (tmSpinTime.count() > 0)
+            {
+                std::this_thread::sleep_until(tmDeadline - tmSpinTime);
+                while (std::chrono::steady_clock::now() < tmDeadline)
+                {
+                    std::this_thread::yield();
+                }
+            }
+            else
+            {
+                std::this_thread::sleep_until(tmDeadline);
+            }
+
+            // Record how late this thread woke up.
+            const double dJitterMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tmDeadline).count();
+            m_IPS.TickDeadline(dJitterMicroseconds, unSkippedIterations > 0, unSkippedIterations);
+        }
 };
 
 #endif    // AUTONOMYTHREAD_H
@@ -11,6 +11,10 @@
 #include "./RoveSoCameraServerGlobals.h"
 #include "./RoveSoCameraServerLogging.h"
 #include "./RoveSoCameraServerNetworking.h"
+#include "./util/WorkStealingExecutor.hpp"
+#include "../tools/blackbox/BlackBoxRecovery.h"
+#include "../tools/encodebench/EncodeBenchmark.h"
+#include "../tools/frameindex/ClipExtraction.h"
 #include <fstream>
 
 // Create a boolean used to handle a SIGINT and exit gracefully.
@@ -47,16 +51,67 @@ void SignalHandler(int nSignal)
     }
 }
 
+/******************************************************************************
+ * @brief Registers the callback for an Autonomy command, looked up by name in the
+ *      RoveComm manifest. A command that is missing from the manifest is skipped
+ *      with a warning, so the server still starts with an older manifest.
+ *
+ * @tparam T - The data type of the command's packets.
+ * @param szCommandName - The name of the command in the manifest.
+ * @param fnCallback - The callback to run when the command is received.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+template<typename T>
+void AddCommandCallback(const std::string& szCommandName, const std::function<void(const rovecomm::RoveCommPacket<T>&, const sockaddr_in&)>& fnCallback)
+{
+    // Look up the command in the manifest.
+    auto itCommand = manifest::Autonomy::COMMANDS.find(szCommandName);
+    // Check if the manifest has the command.
+    if (itCommand == manifest::Autonomy::COMMANDS.end())
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger, "RoveComm manifest has no {} command. It will be ignored until the manifest is updated.", szCommandName);
+        return;
+    }
+
+    // Register the callback.
+    network::g_pRoveCommUDPNode->AddUDPCallback<T>(fnCallback, itCommand->second.DATA_ID);
+}
+
 /******************************************************************************
  * @brief Autonomy main function.
  *
+ * @param argc - The number of command line arguments.
+ * @param argv - The command line arguments. Run with --recover-blackbox <ring file> <output file> [seconds]
+ *      to recover video from a black box ring file instead of starting the server, or with
+ *      --extract-clip <recording> <output file> <start time> <seconds> to cut a clip out of a recording
+ *      using its frame index, or with --benchmark-encode <output directory> [width] [height] [frames] to measure
+ *      the CPU cost of recording one camera with cv::VideoWriter and with the libav muxer.
  * @return int - Exit status number.
  *
  * @author Eli Byrd (edbgkk@mst.edu)
  * @date 2024-11-04
  ******************************************************************************/
-int main()
+int main(int argc, char* argv[])
 {
+    // Check if this is an offline black box recovery instead of a normal run.
+    if (argc >= 4 && std::string(argv[1]) == "--recover-blackbox")
+    {
+        return tools::RecoverBlackBox(argv[2], argv[3], argc >= 5 ? std::atoi(argv[4]) : 0);
+    }
+    // Check if this is an offline clip extraction instead of a normal run.
+    if (argc >= 6 && std::string(argv[1]) == "--extract-clip")
+    {
+        return tools::ExtractClip(argv[2], argv[3], std::atof(argv[4]), std::atof(argv[5]));
+    }
+    // Check if this is an offline encode benchmark instead of a normal run.
+    if (argc >= 3 && std::string(argv[1]) == "--benchmark-encode")
+    {
+        return tools::BenchmarkEncode(argv[2], argc >= 4 ? std::atoi(argv[3]) : 1280, argc >= 5 ? std::atoi(argv[4]) : 720, argc >= 6 ? std::atoi(argv[5]) : 300);
+    }
+
     // Print Software Header
     std::ifstream fHeaderText("../data/ASCII/v25.txt");
     std::string szHeaderText;
@@ -72,6 +127,8 @@ int main()
 
     // Initialize Loggers
     logging::InitializeLoggers(constants::LOGGING_OUTPUT_PATH_ABSOLUTE);
+    // Log exceptions thrown by shared executor tasks that nobody is waiting on.
+    WorkStealingExecutor::GetSharedExecutor().SetExceptionHandler(logging::LogTaskException);
 
     // Setup signal interrupt handler.
     struct sigaction stSigBreak;
@@ -112,6 +169,10 @@ int main()
     network::g_pRoveCommUDPNode->AddUDPCallback<uint8_t>(logging::SetLoggingLevelsCallback, manifest::Autonomy::COMMANDS.find("SETLOGGINGLEVELS")->second.DATA_ID);
     // Initialize handlers.
     globals::g_pCameraHandler = new CameraHandler();
+    // Initialize callbacks that need the handlers. These commands are newer than some manifests, so they are skipped if they are missing.
+    AddCommandCallback("SETSTREAMROI", globals::SetStreamRegionOfInterestCallback);
+    AddCommandCallback("TRIGGERREPLAY", globals::TriggerReplayCallback);
+    AddCommandCallback("SETRECORDING", globals::SetRecordingCallback);
 
     // Start camera handlers.
     globals::g_pCameraHandler->StartCameras();
@@ -119,6 +180,8 @@ int main()
     globals::g_pCameraHandler->StartRecording();
     // Enable Streaming on Handlers.
     globals::g_pCameraHandler->StartStreaming();
+    // Watch the cameras, streams, and recorder for stalls.
+    globals::g_pCameraHandler->StartWatchdog();
 
     /////////////////////////////////////////
     // Declare local variables used in main loop.
@@ -146,9 +209,14 @@ int main()
     FFmpegUDPCameraStreamer* pAuxCamera3Stream     = globals::g_pCameraHandler->GetFFmpegUDPCameraStreamer(CameraHandler::BasicCamName::eAuxCamera3);
     FFmpegUDPCameraStreamer* pAuxCamera4Stream     = globals::g_pCameraHandler->GetFFmpegUDPCameraStreamer(CameraHandler::BasicCamName::eAuxCamera4);
     FFmpegUDPCameraStreamer* pMicroscopeStream     = globals::g_pCameraHandler->GetFFmpegUDPCameraStreamer(CameraHandler::BasicCamName::eMicroscope);
+    // Get the extra synthetic cameras and their streams.
+    const std::vector<BasicCam*>& vExtraSyntheticCams                      = globals::g_pCameraHandler->GetExtraSyntheticCams();
+    const std::vector<FFmpegUDPCameraStreamer*>& vExtraSyntheticCamStreams = globals::g_pCameraHandler->GetExtraSyntheticCamStreams();
 
     // Initialize the frame rate counter.
     IPS IterPerSecond = IPS();
+    // Get the watchdog pointer.
+    WatchdogHandler* pWatchdogHandler = globals::g_pCameraHandler->GetWatchdogHandler();
 
     /*
         This while loop is the main periodic loop for the RoveSoCameraServer program.
@@ -172,6 +240,10 @@ int main()
         szMainInfo += "AuxCamera3 FPS: " + std::to_string(pAuxCamera3->GetIPS().GetExactIPS()) + "\n";
         szMainInfo += "AuxCamera4 FPS: " + std::to_string(pAuxCamera4->GetIPS().GetExactIPS()) + "\n";
         szMainInfo += "Microscope FPS: " + std::to_string(pMicroscope->GetIPS().GetExactIPS()) + "\n";
+        for (BasicCam* pSyntheticCam : vExtraSyntheticCams)
+        {
+            szMainInfo += "SyntheticCam" + pSyntheticCam->GetCameraLocation() + " FPS: " + std::to_string(pSyntheticCam->GetIPS().GetExactIPS()) + "\n";
+        }
         szMainInfo += "\n--------[ Streaming FPS ]--------\n";
         szMainInfo += "DriveCamLeft Stream FPS: " + std::to_string(pDriveCamLeftStream->GetIPS().GetExactIPS()) + "\n";
         szMainInfo += "DriveCamRight Stream FPS: " + std::to_string(pDriveCamRightStream->GetIPS().GetExactIPS()) + "\n";
@@ -183,9 +255,23 @@ int main()
         szMainInfo += "AuxCamera3 Stream FPS: " + std::to_string(pAuxCamera3Stream->GetIPS().GetExactIPS()) + "\n";
         szMainInfo += "AuxCamera4 Stream FPS: " + std::to_string(pAuxCamera4Stream->GetIPS().GetExactIPS()) + "\n";
         szMainInfo += "Microscope Stream FPS: " + std::to_string(pMicroscopeStream->GetIPS().GetExactIPS()) + "\n";
+        for (size_t siIter = 0; siIter < vExtraSyntheticCamStreams.size(); ++siIter)
+        {
+            szMainInfo += "SyntheticCam" + vExtraSyntheticCams[siIter]->GetCameraLocation() +
+                          " Stream FPS: " + std::to_string(vExtraSyntheticCamStreams[siIter]->GetIPS().GetExactIPS()) + "\n";
+        }
         szMainInfo += "\n--------[ RoveComm FPS ]--------\n";
         szMainInfo += "RoveCommUDP FPS: " + std::to_string(network::g_pRoveCommTCPNode->GetIPS().GetExactIPS()) + "\n";
         szMainInfo += "RoveCommTCP FPS: " + std::to_string(network::g_pRoveCommTCPNode->GetIPS().GetExactIPS()) + "\n";
+        // Get the stalls the watchdog has caught and how long they took to recover from.
+        WatchdogHandler::RecoveryStatistics stRecoveryStatistics = pWatchdogHandler->GetRecoveryStatistics();
+        szMainInfo += "\n--------[ Watchdog ]--------\n";
+        szMainInfo += "Stalls: " + std::to_string(stRecoveryStatistics.unStalls) + "\n";
+        szMainInfo += "Recoveries: " + std::to_string(stRecoveryStatistics.unRecoveries) + "\n";
+        szMainInfo += "Recovery Attempts: " + std::to_string(stRecoveryStatistics.unRecoveryAttempts) + "\n";
+        szMainInfo += "Last Recovery ms: " + std::to_string(stRecoveryStatistics.dLastRecoveryMilliseconds) + "\n";
+        szMainInfo += "Average Recovery ms: " + std::to_string(stRecoveryStatistics.dAverageRecoveryMilliseconds) + "\n";
+        szMainInfo += "Max Recovery ms: " + std::to_string(stRecoveryStatistics.dMaxRecoveryMilliseconds) + "\n";
 
         // Submit logger message.
         LOG_DEBUG(logging::g_qSharedLogger, "{}", szMainInfo);
@@ -0,0 +1,585 @@
+/******************************************************************************
+ * @brief Define and implement the CoroutineReactor class.
+ *
+ * @file CoroutineReactor.hpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef COROUTINEREACTOR_HPP
+#define COROUTINEREACTOR_HPP
+
+#include "WorkStealingExecutor.hpp"
+
+/// \cond
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This util class lets coroutines wait on timers, sockets, events, and
+ *      other tasks without holding a thread while they wait. A single reactor thread
+ *      watches everything that is being waited on, and once a wait is over the
+ *      coroutine is resumed on the shared WorkStealingExecutor. This way any number of
+ *      coroutines run on the executor's few worker threads.
+ *
+ *      Timers and file descriptors are woken up by the kernel, and events by whoever
+ *      sets them, so nothing is ever polled. Work that hands back a future should set
+ *      an Event once the value is ready, and the coroutine waits on the event instead.
+ *
+ *      Work that blocks or takes a long time can be handed to another executor with
+ *      WaitForTask(), so it doesn't hold up the shared executor's workers.
+ *
+ *      The awaitables hold on to what they are waiting on by reference, so it must
+ *      live in the coroutine frame until the wait is over. Each wait carries the
+ *      priority class the coroutine is resumed under, so critical coroutines are
+ *      picked up by the executor ahead of background ones.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class CoroutineReactor
+{
+    public:
+        /******************************************************************************
+         * @brief Awaitable that resumes the coroutine at a point in time.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        class TimerAwaiter
+        {
+            public:
+                TimerAwaiter(CoroutineReactor& Reactor, const std::chrono::steady_clock::time_point& tmDeadline, const THREAD_PRIORITIES ePriority) :
+                    m_Reactor(Reactor),
+                    m_tmDeadline(tmDeadline),
+                    m_ePriority(ePriority)
+                {}
+                bool await_ready() const { return std::chrono::steady_clock::now() >= m_tmDeadline; }
+                void await_suspend(std::coroutine_handle<> hCoroutine) { m_Reactor.AddTimer(m_tmDeadline, {hCoroutine, m_ePriority}); }
+                void await_resume() const {}
+
+            private:
+                CoroutineReactor& m_Reactor;
+                std::chrono::steady_clock::time_point m_tmDeadline;
+                THREAD_PRIORITIES m_ePriority;
+        };
+
+        /******************************************************************************
+         * @brief A flag that a coroutine can wait on without it being polled. Setting it
+         *      from any thread resumes the coroutine waiting on it. Only one coroutine can
+         *      wait on an event at a time, and once set it stays set.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        class Event
+        {
+            public:
+                Event() : m_bIsSet(false), m_pReactor(nullptr), m_ePriority(THREAD_PRIORITIES::eNormal) {}
+
+                // The waiting coroutine is tracked by address, so events can't be copied or moved.
+                Event(const Event&)            = delete;
+                Event& operator=(const Event&) = delete;
+
+                /******************************************************************************
+                 * @brief Set the event and resume the coroutine waiting on it, if there is one.
+                 *      Setting it again does nothing.
+                 *
+                 *
+                 * @author agent (agent@local)
+                 * @date 2026-10-18
+                 ******************************************************************************/
+                void Set()
+                {
+                    // Mark the event set and take the waiting coroutine.
+                    std::unique_lock<std::mutex> lkEventLock(m_muEventMutex);
+                    if (m_bIsSet)
+                    {
+                        return;
+                    }
+                    m_bIsSet                           = true;
+                    std::coroutine_handle<> hCoroutine = m_hCoroutine;
+                    CoroutineReactor* pReactor         = m_pReactor;
+                    THREAD_PRIORITIES ePriority        = m_ePriority;
+                    lkEventLock.unlock();
+
+                    // Resume it. The event may be destroyed as soon as the coroutine runs, so it isn't touched after this.
+                    if (hCoroutine)
+                    {
+                        pReactor->Resume(hCoroutine, ePriority);
+                    }
+                }
+
+                /******************************************************************************
+                 * @brief Accessor for whether the event has been set.
+                 *
+                 * @return true - The event is set.
+                 * @return false - The event is not set yet.
+                 *
+                 * @author agent (agent@local)
+                 * @date 2026-10-18
+                 ******************************************************************************/
+                bool IsSet()
+                {
+                    // Acquire lock on the event.
+                    std::lock_guard<std::mutex> lkEventLock(m_muEventMutex);
+                    return m_bIsSet;
+                }
+
+                /******************************************************************************
+                 * @brief Register a coroutine to be resumed when the event is set. Used by
+                 *      EventAwaiter.
+                 *
+                 * @param Reactor - The reactor to resume the coroutine with.
+                 * @param hCoroutine - The coroutine to resume.
+                 * @param ePriority - The priority class to resume the coroutine under.
+                 * @return true - The coroutine is waiting.
+                 * @return false - The event was already set, so the coroutine should just continue.
+                 *
+                 * @author agent (agent@local)
+                 * @date 2026-10-18
+                 ******************************************************************************/
+                bool AddWaiter(CoroutineReactor& Reactor, std::coroutine_handle<> hCoroutine, const THREAD_PRIORITIES ePriority)
+                {
+                    // Acquire lock on the event.
+                    std::lock_guard<std::mutex> lkEventLock(m_muEventMutex);
+                    if (m_bIsSet)
+                    {
+                        return false;
+                    }
+                    m_hCoroutine = hCoroutine;
+                    m_pReactor   = &Reactor;
+                    m_ePriority  = ePriority;
+                    return true;
+                }
+
+            private:
+                std::mutex m_muEventMutex;
+                bool m_bIsSet;
+                std::coroutine_handle<> m_hCoroutine;
+                CoroutineReactor* m_pReactor;
+                THREAD_PRIORITIES m_ePriority;
+        };
+
+        /******************************************************************************
+         * @brief Awaitable that resumes the coroutine once an event is set.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        class EventAwaiter
+        {
+            public:
+                EventAwaiter(CoroutineReactor& Reactor, Event& stEvent, const THREAD_PRIORITIES ePriority) :
+                    m_Reactor(Reactor),
+                    m_stEvent(stEvent),
+                    m_ePriority(ePriority)
+                {}
+                bool await_ready() const { return m_stEvent.IsSet(); }
+                bool await_suspend(std::coroutine_handle<> hCoroutine) { return m_stEvent.AddWaiter(m_Reactor, hCoroutine, m_ePriority); }
+                void await_resume() const {}
+
+            private:
+                CoroutineReactor& m_Reactor;
+                Event& m_stEvent;
+                THREAD_PRIORITIES m_ePriority;
+        };
+
+        /******************************************************************************
+         * @brief Awaitable that runs a task on another executor, then resumes the
+         *      coroutine. An exception thrown by the task is rethrown in the coroutine.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        class TaskAwaiter
+        {
+            public:
+                TaskAwaiter(CoroutineReactor& Reactor,
+                            WorkStealingExecutor& Executor,
+                            WorkStealingExecutor::TaskGroup& stTaskGroup,
+                            std::function<void()> fnTask,
+                            const THREAD_PRIORITIES ePriority) :
+                    m_Reactor(Reactor),
+                    m_Executor(Executor),
+                    m_stTaskGroup(stTaskGroup),
+                    m_fnTask(std::move(fnTask)),
+                    m_ePriority(ePriority)
+                {}
+                bool await_ready() const { return false; }
+                void await_suspend(std::coroutine_handle<> hCoroutine)
+                {
+                    // This awaiter lives in the coroutine frame, so it stays valid until the coroutine is resumed.
+                    m_Executor.Submit(m_stTaskGroup,
+                                      [this, hCoroutine]()
+                                      {
+                                          // Run the task and keep any exception for the coroutine.
+                                          try
+                                          {
+                                              m_fnTask();
+                                          }
+                                          catch (...)
+                                          {
+                                              m_pException = std::current_exception();
+                                          }
+                                          m_Reactor.Resume(hCoroutine, m_ePriority);
+                                      });
+                }
+                void await_resume()
+                {
+                    // Pass on the task's exception.
+                    if (m_pException)
+                    {
+                        std::rethrow_exception(m_pException);
+                    }
+                }
+
+            private:
+                CoroutineReactor& m_Reactor;
+                WorkStealingExecutor& m_Executor;
+                WorkStealingExecutor::TaskGroup& m_stTaskGroup;
+                std::function<void()> m_fnTask;
+                THREAD_PRIORITIES m_ePriority;
+                std::exception_ptr m_pException;
+        };
+
+        /******************************************************************************
+         * @brief Awaitable that resumes the coroutine once a file descriptor is ready.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        class FileAwaiter
+        {
+            public:
+                FileAwaiter(CoroutineReactor& Reactor, const int nFileDescriptor, const short sEvents, const THREAD_PRIORITIES ePriority) :
+                    m_Reactor(Reactor),
+                    m_nFileDescriptor(nFileDescriptor),
+                    m_sEvents(sEvents),
+                    m_ePriority(ePriority)
+                {}
+                bool await_ready() const { return false; }
+                void await_suspend(std::coroutine_handle<> hCoroutine) { m_Reactor.AddFileWait(m_nFileDescriptor, m_sEvents, {hCoroutine, m_ePriority}); }
+                void await_resume() const {}
+
+            private:
+                CoroutineReactor& m_Reactor;
+                int m_nFileDescriptor;
+                short m_sEvents;
+                THREAD_PRIORITIES m_ePriority;
+        };
+
+        /******************************************************************************
+         * @brief Awaitable that lets other coroutines and tasks run before continuing.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        class YieldAwaiter
+        {
+            public:
+                YieldAwaiter(CoroutineReactor& Reactor, const THREAD_PRIORITIES ePriority) : m_Reactor(Reactor), m_ePriority(ePriority) {}
+                bool await_ready() const { return false; }
+                void await_suspend(std::coroutine_handle<> hCoroutine) { m_Reactor.Resume(hCoroutine, m_ePriority, true); }
+                void await_resume() const {}
+
+            private:
+                CoroutineReactor& m_Reactor;
+                THREAD_PRIORITIES m_ePriority;
+        };
+
+        /******************************************************************************
+         * @brief Accessor for the reactor shared by the whole program. It is created the
+         *      first time it is asked for.
+         *
+         * @return CoroutineReactor& - The shared reactor.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        static CoroutineReactor& GetSharedReactor()
+        {
+            // Make sure the executor outlives the reactor, since the reactor resumes coroutines on it.
+            WorkStealingExecutor::GetSharedExecutor();
+            // Create the reactor on first use.
+            static CoroutineReactor s_SharedReactor;
+            return s_SharedReactor;
+        }
+
+        /******************************************************************************
+         * @brief Construct a new Coroutine Reactor object and start its thread.
+         *
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        CoroutineReactor()
+        {
+            // Initialize member variables.
+            m_bStopReactor    = false;
+            m_nWakeDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            for (int nPriority = 0; nPriority < NUM_THREAD_PRIORITIES; ++nPriority)
+            {
+                m_aResumeTasks[nPriority].SetPriority(static_cast<THREAD_PRIORITIES>(nPriority));
+            }
+            m_thReactorThread = std::thread([this]() { this->RunReactor(); });
+        }
+
+        /******************************************************************************
+         * @brief Destroy the Coroutine Reactor object. Coroutines still waiting are never
+         *      resumed.
+         *
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        ~CoroutineReactor()
+        {
+            // Stop the reactor thread.
+            m_bStopReactor = true;
+            this->Wake();
+            m_thReactorThread.join();
+
+            // Wait for coroutines that were already resumed.
+            for (WorkStealingExecutor::TaskGroup& stResumeTasks : m_aResumeTasks)
+            {
+                WorkStealingExecutor::GetSharedExecutor().Wait(stResumeTasks);
+            }
+            close(m_nWakeDescriptor);
+        }
+
+        // The reactor thread holds a pointer to the reactor, so it can't be copied or moved.
+        CoroutineReactor(const CoroutineReactor&)            = delete;
+        CoroutineReactor& operator=(const CoroutineReactor&) = delete;
+
+        /////////////////////////////////////////
+        // Awaitables.
+        /////////////////////////////////////////
+
+        TimerAwaiter WaitUntil(const std::chrono::steady_clock::time_point& tmDeadline, const THREAD_PRIORITIES ePriority = THREAD_PRIORITIES::eNormal)
+        {
+            return TimerAwaiter(*this, tmDeadline, ePriority);
+        }
+        TimerAwaiter WaitFor(const std::chrono::steady_clock::duration& tmDuration, const THREAD_PRIORITIES ePriority = THREAD_PRIORITIES::eNormal)
+        {
+            return TimerAwaiter(*this, std::chrono::steady_clock::now() + tmDuration, ePriority);
+        }
+        EventAwaiter WaitForEvent(Event& stEvent, const THREAD_PRIORITIES ePriority = THREAD_PRIORITIES::eNormal)
+        {
+            return EventAwaiter(*this, stEvent, ePriority);
+        }
+        TaskAwaiter WaitForTask(WorkStealingExecutor& Executor,
+                                WorkStealingExecutor::TaskGroup& stTaskGroup,
+                                std::function<void()> fnTask,
+                                const THREAD_PRIORITIES ePriority = THREAD_PRIORITIES::eNormal)
+        {
+            return TaskAwaiter(*this, Executor, stTaskGroup, std::move(fnTask), ePriority);
+        }
+        FileAwaiter WaitForReadable(const int nFileDescriptor, const THREAD_PRIORITIES ePriority = THREAD_PRIORITIES::eNormal)
+        {
+            return FileAwaiter(*this, nFileDescriptor, POLLIN, ePriority);
+        }
+        FileAwaiter WaitForWritable(const int nFileDescriptor, const THREAD_PRIORITIES ePriority = THREAD_PRIORITIES::eNormal)
+        {
+            return FileAwaiter(*this, nFileDescriptor, POLLOUT, ePriority);
+        }
+        YieldAwaiter Yield(const THREAD_PRIORITIES ePriority = THREAD_PRIORITIES::eNormal) { return YieldAwaiter(*this, ePriority); }
+
+        /******************************************************************************
+         * @brief Resume a coroutine on the shared executor.
+         *
+         * @param hCoroutine - The coroutine to resume.
+         * @param ePriority - The priority class to queue the coroutine under.
+         * @param bRunLast - Whether to let everything already queued run first.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void Resume(std::coroutine_handle<> hCoroutine, const THREAD_PRIORITIES ePriority = THREAD_PRIORITIES::eNormal, const bool bRunLast = false)
+        {
+            // Queue the coroutine to continue on a worker.
+            WorkStealingExecutor::GetSharedExecutor().Submit(m_aResumeTasks[static_cast<int>(ePriority)], [hCoroutine]() { hCoroutine.resume(); }, bRunLast);
+        }
+
+    private:
+        // A suspended coroutine and the priority class it is resumed under.
+        struct SuspendedCoroutine
+        {
+            public:
+                std::coroutine_handle<> hCoroutine;
+                THREAD_PRIORITIES ePriority;
+        };
+
+        // A coroutine waiting on a file descriptor.
+        struct FileWait
+        {
+            public:
+                int nFileDescriptor;
+                short sEvents;
+                SuspendedCoroutine stCoroutine;
+        };
+
+        // Declare private member variables.
+        std::thread m_thReactorThread;
+        std::atomic_bool m_bStopReactor;
+        int m_nWakeDescriptor;
+        std::mutex m_muWaitsMutex;
+        std::multimap<std::chrono::steady_clock::time_point, SuspendedCoroutine> m_mTimers;
+        std::vector<FileWait> m_vFileWaits;
+        std::array<WorkStealingExecutor::TaskGroup, NUM_THREAD_PRIORITIES> m_aResumeTasks;
+
+        /******************************************************************************
+         * @brief Add a coroutine waiting on a timer.
+         *
+         * @param tmDeadline - When to resume the coroutine.
+         * @param stCoroutine - The coroutine and its priority class.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void AddTimer(const std::chrono::steady_clock::time_point& tmDeadline, const SuspendedCoroutine& stCoroutine)
+        {
+            // Add the timer.
+            std::unique_lock<std::mutex> lkWaitsLock(m_muWaitsMutex);
+            bool bIsEarliest = m_mTimers.empty() || tmDeadline < m_mTimers.begin()->first;
+            m_mTimers.emplace(tmDeadline, stCoroutine);
+            lkWaitsLock.unlock();
+
+            // Wake the reactor if it is sleeping past this deadline.
+            if (bIsEarliest)
+            {
+                this->Wake();
+            }
+        }
+
+        /******************************************************************************
+         * @brief Add a coroutine waiting on a file descriptor.
+         *
+         * @param nFileDescriptor - The file descriptor.
+         * @param sEvents - The poll events to wait for.
+         * @param stCoroutine - The coroutine and its priority class.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void AddFileWait(const int nFileDescriptor, const short sEvents, const SuspendedCoroutine& stCoroutine)
+        {
+            // Add the wait, then wake the reactor so it starts watching the descriptor.
+            {
+                std::lock_guard<std::mutex> lkWaitsLock(m_muWaitsMutex);
+                m_vFileWaits.push_back({nFileDescriptor, sEvents, stCoroutine});
+            }
+            this->Wake();
+        }
+
+        /******************************************************************************
+         * @brief Interrupt the reactor thread's wait so it picks up new waits.
+         *
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void Wake()
+        {
+            // Bump the event counter.
+            uint64_t unValue                  = 1;
+            [[maybe_unused]] ssize_t nWritten = write(m_nWakeDescriptor, &unValue, sizeof(unValue));
+        }
+
+        /******************************************************************************
+         * @brief The loop the reactor thread runs. Sleeps in ppoll() until a descriptor is
+         *      ready, the next timer is due, or it's woken up for a new wait, then
+         *      resumes every coroutine whose wait is over.
+         *
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void RunReactor()
+        {
+            // Declare instance variables.
+            std::vector<pollfd> vPollDescriptors;
+            std::vector<FileWait> vFileWaits;
+            std::vector<SuspendedCoroutine> vReadyCoroutines;
+
+            // Loop until stopped.
+            while (!m_bStopReactor)
+            {
+                // Work out how long to sleep and what to watch.
+                std::unique_lock<std::mutex> lkWaitsLock(m_muWaitsMutex);
+                std::chrono::nanoseconds tmTimeout(-1);
+                if (!m_mTimers.empty())
+                {
+                    tmTimeout = std::max(std::chrono::nanoseconds(0), m_mTimers.begin()->first - std::chrono::steady_clock::now());
+                }
+                vFileWaits = m_vFileWaits;
+                lkWaitsLock.unlock();
+
+                // Watch the wake descriptor and every descriptor being waited on.
+                vPollDescriptors.assign(1, {m_nWakeDescriptor, POLLIN, 0});
+                for (const FileWait& stFileWait : vFileWaits)
+                {
+                    vPollDescriptors.push_back({stFileWait.nFileDescriptor, stFileWait.sEvents, 0});
+                }
+                timespec stTimeout = {static_cast<time_t>(tmTimeout.count() / 1000000000), static_cast<long>(tmTimeout.count() % 1000000000)};
+                ppoll(vPollDescriptors.data(), vPollDescriptors.size(), tmTimeout.count() < 0 ? nullptr : &stTimeout, nullptr);
+
+                // Clear the wake counter.
+                uint64_t unValue;
+                [[maybe_unused]] ssize_t nRead = read(m_nWakeDescriptor, &unValue, sizeof(unValue));
+
+                // Collect every coroutine whose wait is over.
+                vReadyCoroutines.clear();
+                lkWaitsLock.lock();
+                // Timers that are due.
+                std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now();
+                while (!m_mTimers.empty() && m_mTimers.begin()->first <= tmNow)
+                {
+                    vReadyCoroutines.push_back(m_mTimers.begin()->second);
+                    m_mTimers.erase(m_mTimers.begin());
+                }
+                // Descriptors that are ready, or closed or broken so the coroutine can find out.
+                for (size_t siIter = 1; siIter < vPollDescriptors.size(); ++siIter)
+                {
+                    if (vPollDescriptors[siIter].revents != 0)
+                    {
+                        std::coroutine_handle<> hCoroutine         = vFileWaits[siIter - 1].stCoroutine.hCoroutine;
+                        std::vector<FileWait>::iterator itFileWait = std::find_if(m_vFileWaits.begin(),
+                                                                                  m_vFileWaits.end(),
+                                                                                  [hCoroutine](const FileWait& stFileWait)
+                                                                                  { return stFileWait.stCoroutine.hCoroutine == hCoroutine; });
+                        if (itFileWait != m_vFileWaits.end())
+                        {
+                            vReadyCoroutines.push_back(itFileWait->stCoroutine);
+                            m_vFileWaits.erase(itFileWait);
+                        }
+                    }
+                }
+                lkWaitsLock.unlock();
+
+                // Resume them on the executor.
+                for (const SuspendedCoroutine& stCoroutine : vReadyCoroutines)
+                {
+                    this->Resume(stCoroutine.hCoroutine, stCoroutine.ePriority);
+                }
+            }
+        }
+};
+
+#endif    // COROUTINEREACTOR_HPP
@@ -20,7 +20,9 @@
 
 /******************************************************************************
  * @brief This util class provides an easy way to keep track of iterations per second for
- *      any body of code.
+ *      any body of code. Loops that are held to a rate also record how late each
+ *      iteration woke up compared to its deadline (jitter), and how often they ran past
+ *      a deadline.
  *
  *
  * @author ClayJay3 (claytonraycowen@gmail.com)
@@ -36,6 +38,11 @@ class IPS
         double m_d1PercentLow;
         std::deque<double> m_dqIPSHistory;
         std::chrono::high_resolution_clock::time_point m_tLastUpdateTime;
+        double m_dCurrentJitter;
+        double m_dHighestJitter;
+        std::deque<double> m_dqJitterHistory;
+        unsigned long int m_unOverruns;
+        unsigned long int m_unSkippedIterations;
 
         // Define class constants.
         const long unsigned int m_nMaxMetricsHistorySize = 100;
@@ -87,10 +94,14 @@ class IPS
         IPS()
         {
             // Initialize member variables and objects.
-            m_dCurrentIPS  = 0.0;
-            m_dHighestIPS  = 0.0;
-            m_dLowestIPS   = 9999999;
-            m_d1PercentLow = 0.0;
+            m_dCurrentIPS         = 0.0;
+            m_dHighestIPS         = 0.0;
+            m_dLowestIPS          = 9999999;
+            m_d1PercentLow        = 0.0;
+            m_dCurrentJitter      = 0.0;
+            m_dHighestJitter      = 0.0;
+            m_unOverruns          = 0;
+            m_unSkippedIterations = 0;
         }
 
         /******************************************************************************
@@ -117,11 +128,16 @@ class IPS
         IPS& operator=(const IPS& OtherIPS)
         {
             // Copy values from other IPS object.
-            m_dCurrentIPS  = OtherIPS.m_dCurrentIPS;
-            m_dHighestIPS  = OtherIPS.m_dHighestIPS;
-            m_dLowestIPS   = OtherIPS.m_dLowestIPS;
-            m_d1PercentLow = OtherIPS.m_d1PercentLow;
-            m_dqIPSHistory = OtherIPS.m_dqIPSHistory;
+            m_dCurrentIPS         = OtherIPS.m_dCurrentIPS;
+            m_dHighestIPS         = OtherIPS.m_dHighestIPS;
+            m_dLowestIPS          = OtherIPS.m_dLowestIPS;
+            m_d1PercentLow        = OtherIPS.m_d1PercentLow;
+            m_dqIPSHistory        = OtherIPS.m_dqIPSHistory;
+            m_dCurrentJitter      = OtherIPS.m_dCurrentJitter;
+            m_dHighestJitter      = OtherIPS.m_dHighestJitter;
+            m_dqJitterHistory     = OtherIPS.m_dqJitterHistory;
+            m_unOverruns          = OtherIPS.m_unOverruns;
+            m_unSkippedIterations = OtherIPS.m_unSkippedIterations;
 
             // Return this object.
             return *this;
@@ -151,6 +167,34 @@ class IPS
             m_tLastUpdateTime = tCurrentTime;
         }
 
+        /******************************************************************************
+         * @brief This method is used by rate limited loops to record how an iteration
+         *      lined up with its deadline.
+         *
+         * @param dJitterMicroseconds - How late the iteration woke up after its deadline.
+         * @param bOverrun - Whether the iteration ran past the next deadline.
+         * @param unSkippedIterations - How many iterations were dropped to get back on schedule.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void TickDeadline(const double dJitterMicroseconds, const bool bOverrun, const unsigned int unSkippedIterations)
+        {
+            // Update jitter stats.
+            m_dCurrentJitter = dJitterMicroseconds;
+            m_dHighestJitter = std::max(m_dHighestJitter, dJitterMicroseconds);
+            m_dqJitterHistory.emplace_back(dJitterMicroseconds);
+            // Throw out oldest element in deque if size is over given number.
+            if (m_dqJitterHistory.size() > m_nMaxMetricsHistorySize)
+            {
+                m_dqJitterHistory.pop_front();
+            }
+
+            // Count missed deadlines.
+            m_unOverruns += bOverrun ? 1 : 0;
+            m_unSkippedIterations += unSkippedIterations;
+        }
+
         /******************************************************************************
          * @brief Accessor for the Current I P S private member. This method will return the
          *      immediate IPS since the last Tick() call. If called in a loop, this number will
@@ -240,6 +284,91 @@ class IPS
             return m_d1PercentLow;
         }
 
+        /******************************************************************************
+         * @brief Accessor for the Current Jitter private member.
+         *
+         * @return double - How late the last iteration woke up after its deadline, in microseconds.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        double GetExactJitter() const
+        {
+            // Return the last jitter.
+            return m_dCurrentJitter;
+        }
+
+        /******************************************************************************
+         * @brief Calculates the average jitter.
+         *
+         * @return double - The average wake up lateness according to the metrics window, in microseconds.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        double GetAverageJitter() const
+        {
+            // Check if there is any history.
+            if (m_dqJitterHistory.empty())
+            {
+                // Return zero jitter average.
+                return 0.0;
+            }
+
+            // Loop through jitter history and calculate average.
+            double dSum = 0.0;
+            for (const double dVal : m_dqJitterHistory)
+            {
+                // Add jitter to total sum.
+                dSum += dVal;
+            }
+
+            // Return calculated average.
+            return dSum / static_cast<double>(m_dqJitterHistory.size());
+        }
+
+        /******************************************************************************
+         * @brief Accessor for the Highest Jitter private member.
+         *
+         * @return double - The highest recorded jitter over this objects lifespan, in microseconds.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        double GetHighestJitter() const
+        {
+            // Return the highest jitter.
+            return m_dHighestJitter;
+        }
+
+        /******************************************************************************
+         * @brief Accessor for the Overruns private member.
+         *
+         * @return unsigned long int - The number of iterations that ran past the next deadline.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        unsigned long int GetOverrunCount() const
+        {
+            // Return the number of overruns.
+            return m_unOverruns;
+        }
+
+        /******************************************************************************
+         * @brief Accessor for the Skipped Iterations private member.
+         *
+         * @return unsigned long int - The number of iterations dropped to get back on schedule after overruns.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        unsigned long int GetSkippedIterations() const
+        {
+            // Return the number of skipped iterations.
+            return m_unSkippedIterations;
+        }
+
         /******************************************************************************
          * @brief Resets all metrics and frame time history.
          *
@@ -250,12 +379,17 @@ class IPS
         void Reset()
         {
             // Reset member variable.
-            m_dCurrentIPS  = 0.0;
-            m_dHighestIPS  = 0.0;
-            m_dLowestIPS   = 9999999;
-            m_d1PercentLow = 0.0;
-            // Reset deque.
+            m_dCurrentIPS         = 0.0;
+            m_dHighestIPS         = 0.0;
+            m_dLowestIPS          = 9999999;
+            m_d1PercentLow        = 0.0;
+            m_dCurrentJitter      = 0.0;
+            m_dHighestJitter      = 0.0;
+            m_unOverruns          = 0;
+            m_unSkippedIterations = 0;
+            // Reset deques.
             m_dqIPSHistory.clear();
+            m_dqJitterHistory.clear();
         }
 };
 
@@ -0,0 +1,155 @@
+/******************************************************************************
+ * @brief Defines the thread priority classes and the functions that apply them
+ *      and CPU affinity masks to threads.
+ *
+ * @file ThreadScheduling.hpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef THREADSCHEDULING_HPP
+#define THREADSCHEDULING_HPP
+
+/// \cond
+#include <cstdint>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/// \endcond
+
+///////////////////////////////////////////////////////////////////////////////
+//// Define Enums
+///////////////////////////////////////////////////////////////////////////////
+
+// Declare global/file-scope enumerator. The order is the order work is picked up in, most important first.
+enum class THREAD_PRIORITIES
+{
+    eCritical,     // Must keep its rate under load, like drive camera capture and streaming. Preempts everything else.
+    eNormal,       // The default. Shares the CPU evenly.
+    eBackground    // Only needs what's left over, like recording and logging. Slows down first when the CPU is saturated.
+};
+
+// The number of priority classes.
+constexpr int NUM_THREAD_PRIORITIES = 3;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/******************************************************************************
+ * @brief Namespace containing functions that move the calling thread into a
+ *      priority class or onto a set of CPUs.
+ *
+ *      Critical threads are given the round robin realtime policy, so they always
+ *      run ahead of normal threads. That needs CAP_SYS_NICE or an RLIMIT_RTPRIO, so
+ *      without it they are given a raised nice value instead. Background threads
+ *      are given the batch policy and a lowered nice value. On Linux the nice value
+ *      of a thread id only applies to that thread, and threads inherit both from the
+ *      thread that created them.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+namespace scheduling
+{
+    // Define namespace constants.
+    constexpr int CRITICAL_REALTIME_PRIORITY = 10;     // The realtime priority of critical threads. Kept low so kernel threads and interrupts still come first.
+    constexpr int CRITICAL_NICE_VALUE        = -10;    // The nice value of critical threads if the realtime policy isn't allowed.
+    constexpr int BACKGROUND_NICE_VALUE      = 10;     // The nice value of background threads.
+
+    /******************************************************************************
+     * @brief Set the nice value of the calling thread only.
+     *
+     * @param nNiceValue - The nice value, from -20 to 19. Lower runs first.
+     * @return true - The nice value was set.
+     * @return false - The nice value could not be set. Lowering it needs CAP_SYS_NICE or an RLIMIT_NICE.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    inline bool SetCurrentThreadNiceValue(const int nNiceValue)
+    {
+        // On Linux the nice value of a thread id only applies to that thread.
+        return setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), nNiceValue) == 0;
+    }
+
+    /******************************************************************************
+     * @brief Move the calling thread into a priority class.
+     *
+     * @param ePriority - The priority class.
+     * @return true - The thread is now scheduled for the class.
+     * @return false - The thread couldn't be given the class's scheduling, and is left
+     *      as close to it as it was allowed to get.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    inline bool SetCurrentThreadPriority(const THREAD_PRIORITIES ePriority)
+    {
+        // Declare instance variables.
+        sched_param stSchedulingParameters = {};
+
+        switch (ePriority)
+        {
+            case THREAD_PRIORITIES::eCritical:
+            {
+                // Try the realtime policy.
+                stSchedulingParameters.sched_priority = CRITICAL_REALTIME_PRIORITY;
+                if (pthread_setschedparam(pthread_self(), SCHED_RR, &stSchedulingParameters) == 0)
+                {
+                    return true;
+                }
+                // Fall back to a raised nice value.
+                stSchedulingParameters.sched_priority = 0;
+                pthread_setschedparam(pthread_self(), SCHED_OTHER, &stSchedulingParameters);
+                return SetCurrentThreadNiceValue(CRITICAL_NICE_VALUE);
+            }
+            case THREAD_PRIORITIES::eNormal:
+            {
+                // Return to the default policy and nice value.
+                bool bPolicySet = pthread_setschedparam(pthread_self(), SCHED_OTHER, &stSchedulingParameters) == 0;
+                return SetCurrentThreadNiceValue(0) && bPolicySet;
+            }
+            case THREAD_PRIORITIES::eBackground:
+            {
+                // The batch policy also tells the scheduler this thread doesn't need to wake up quickly.
+                bool bPolicySet = pthread_setschedparam(pthread_self(), SCHED_BATCH, &stSchedulingParameters) == 0;
+                return SetCurrentThreadNiceValue(BACKGROUND_NICE_VALUE) && bPolicySet;
+            }
+            default: return false;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Restrict the calling thread to a set of CPUs.
+     *
+     * @param unCPUAffinityMask - A bit for each CPU the thread may run on, with bit 0 as CPU 0.
+     *      Zero lets the thread run on any CPU.
+     * @return true - The affinity was set.
+     * @return false - The affinity could not be set, likely because none of the CPUs
+     *      in the mask exist or are allowed for this process.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    inline bool SetCurrentThreadAffinity(const uint64_t unCPUAffinityMask)
+    {
+        // Build the CPU set. The kernel drops CPUs that don't exist, so an empty mask can just allow all of them.
+        cpu_set_t stCPUSet;
+        CPU_ZERO(&stCPUSet);
+        for (int nCPU = 0; nCPU < CPU_SETSIZE; ++nCPU)
+        {
+            if (unCPUAffinityMask == 0 || (nCPU < 64 && (unCPUAffinityMask >> nCPU) & 1))
+            {
+                CPU_SET(nCPU, &stCPUSet);
+            }
+        }
+
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &stCPUSet) == 0;
+    }
+}    // namespace scheduling
+
+#endif    // THREADSCHEDULING_HPP
@@ -0,0 +1,613 @@
+/******************************************************************************
+ * @brief Define and implement the WorkStealingExecutor class.
+ *
+ * @file WorkStealingExecutor.hpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef WORKSTEALINGEXECUTOR_HPP
+#define WORKSTEALINGEXECUTOR_HPP
+
+#include "./ThreadScheduling.hpp"
+
+/// \cond
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This util class runs short tasks for the whole program on one set of
+ *      worker threads, sized to the number of cores. Each worker has its own queue,
+ *      and a worker that runs out of tasks steals from the others, so work spreads
+ *      across the cores without a thread per object.
+ *
+ *      Tasks are submitted as part of a TaskGroup, which tracks how many of them are
+ *      still queued or running. Waiting on a group runs its queued tasks on the
+ *      waiting thread, then blocks until the rest finish, so waiting from inside a
+ *      task can't deadlock the workers. A group can also have its queued tasks
+ *      cleared without touching anyone else's.
+ *
+ *      Each group has a priority class. Workers always take a queued task of a higher
+ *      class before a lower one, from any queue, so under load critical work runs
+ *      first and background work waits.
+ *
+ *      An exception thrown by a task never reaches the worker. It is handed to the
+ *      future of a task submitted with SubmitWithFuture(), or to the exception handler
+ *      otherwise. The logging header includes this one, so the executor can't log on
+ *      its own. Whoever owns an executor sets logging::LogTaskException() as its handler.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class WorkStealingExecutor
+{
+    public:
+        /******************************************************************************
+         * @brief A set of tasks that can be waited on or cleared together. Must not be
+         *      destroyed while any of its tasks are queued or running, so wait on it or
+         *      purge and wait on it first.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        class TaskGroup
+        {
+            public:
+                /******************************************************************************
+                 * @brief Construct a new Task Group object.
+                 *
+                 *
+                 * @author agent (agent@local)
+                 * @date 2026-10-18
+                 ******************************************************************************/
+                TaskGroup()
+                {
+                    // Initialize member variables.
+                    m_nPendingTasks = 0;
+                    m_nQueuedTasks  = 0;
+                    m_ePriority     = THREAD_PRIORITIES::eNormal;
+                }
+
+                // Groups are tracked by address, so they can't be copied or moved.
+                TaskGroup(const TaskGroup&)            = delete;
+                TaskGroup& operator=(const TaskGroup&) = delete;
+
+                /******************************************************************************
+                 * @brief Accessor for the number of tasks in this group that are queued or running.
+                 *
+                 * @return int - The number of unfinished tasks.
+                 *
+                 * @author agent (agent@local)
+                 * @date 2026-10-18
+                 ******************************************************************************/
+                int GetPendingTasks() const { return m_nPendingTasks; }
+
+                /******************************************************************************
+                 * @brief Accessor for the number of tasks in this group waiting for a thread.
+                 *
+                 * @return int - The number of queued tasks.
+                 *
+                 * @author agent (agent@local)
+                 * @date 2026-10-18
+                 ******************************************************************************/
+                int GetQueuedTasks() const { return m_nQueuedTasks; }
+
+                /******************************************************************************
+                 * @brief Mutator for the Priority private member. Only applies to tasks submitted
+                 *      after it is set.
+                 *
+                 * @param ePriority - The priority class of the group's tasks.
+                 *
+                 * @author agent (agent@local)
+                 * @date 2026-10-18
+                 ******************************************************************************/
+                void SetPriority(const THREAD_PRIORITIES ePriority) { m_ePriority = ePriority; }
+
+                /******************************************************************************
+                 * @brief Accessor for the Priority private member.
+                 *
+                 * @return THREAD_PRIORITIES - The priority class of the group's tasks.
+                 *
+                 * @author agent (agent@local)
+                 * @date 2026-10-18
+                 ******************************************************************************/
+                THREAD_PRIORITIES GetPriority() const { return m_ePriority; }
+
+            private:
+                // The executor updates the counts.
+                friend class WorkStealingExecutor;
+
+                // Declare private member variables.
+                std::atomic<int> m_nPendingTasks;
+                std::atomic<int> m_nQueuedTasks;
+                std::atomic<THREAD_PRIORITIES> m_ePriority;
+                std::mutex m_muFinishedMutex;
+                std::condition_variable m_cdFinishedCondition;
+        };
+
+        /******************************************************************************
+         * @brief Accessor for the executor shared by the whole program. It is created the
+         *      first time it is asked for, with one worker per core.
+         *
+         * @return WorkStealingExecutor& - The shared executor.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        static WorkStealingExecutor& GetSharedExecutor()
+        {
+            // Create the executor on first use.
+            static WorkStealingExecutor s_SharedExecutor(std::max(1u, std::thread::hardware_concurrency()));
+            return s_SharedExecutor;
+        }
+
+        /******************************************************************************
+         * @brief Construct a new Work Stealing Executor object and start its workers.
+         *
+         * @param nNumThreads - The number of worker threads.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        explicit WorkStealingExecutor(const unsigned int nNumThreads)
+        {
+            // Initialize member variables.
+            m_bStopWorkers = false;
+            m_nQueuedTasks = 0;
+            m_unNextQueue  = 0;
+            for (std::atomic<int>& nPriorityQueuedTasks : m_anPriorityQueuedTasks)
+            {
+                nPriorityQueuedTasks = 0;
+            }
+
+            // Create a queue for each worker before any of them start stealing.
+            for (unsigned int unIter = 0; unIter < std::max(1u, nNumThreads); ++unIter)
+            {
+                m_vWorkerQueues.emplace_back(std::make_unique<WorkerQueue>());
+            }
+            // Start the workers.
+            for (size_t siIter = 0; siIter < m_vWorkerQueues.size(); ++siIter)
+            {
+                m_vWorkers.emplace_back([this, siIter]() { this->RunWorker(siIter); });
+            }
+        }
+
+        /******************************************************************************
+         * @brief Destroy the Work Stealing Executor object. Tasks that are still queued
+         *      are run before the workers exit.
+         *
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        ~WorkStealingExecutor()
+        {
+            // Signal workers to stop once the queues are empty.
+            {
+                std::lock_guard<std::mutex> lkSleepLock(m_muSleepMutex);
+                m_bStopWorkers = true;
+            }
+            m_cdSleepCondition.notify_all();
+
+            // Wait for workers to exit.
+            for (std::thread& thWorker : m_vWorkers)
+            {
+                thWorker.join();
+            }
+        }
+
+        // The workers hold a pointer to the executor, so it can't be copied or moved.
+        WorkStealingExecutor(const WorkStealingExecutor&)            = delete;
+        WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+        /******************************************************************************
+         * @brief Queue a task to run on the workers. Tasks submitted from a worker go on
+         *      that worker's own queue, others are spread across the queues.
+         *
+         * @param stTaskGroup - The group the task belongs to.
+         * @param fnTask - The task to run.
+         * @param bRunLast - Whether the task should run after everything already queued
+         *      instead of next. Workers run their own newest task first, so a task that
+         *      wants to give way to the others has to go on the far end.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void Submit(TaskGroup& stTaskGroup, std::function<void()> fnTask, const bool bRunLast = false)
+        {
+            // Queue the task without a future.
+            this->Enqueue(stTaskGroup, {std::move(fnTask), &stTaskGroup, stTaskGroup.m_ePriority, nullptr}, bRunLast);
+        }
+
+        /******************************************************************************
+         * @brief Queue a task to run on the workers, and get a future for it. The future
+         *      is ready once the task returns, and holds the exception if it threw. If the
+         *      task is purged before it runs, the future holds a broken promise error. The
+         *      future is ready just before the task is marked finished, so the group still
+         *      has to be waited on before it is destroyed.
+         *
+         * @param stTaskGroup - The group the task belongs to.
+         * @param fnTask - The task to run.
+         * @param bRunLast - Whether the task should run after everything already queued
+         *      instead of next.
+         * @return std::future<void> - The future for the task.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        std::future<void> SubmitWithFuture(TaskGroup& stTaskGroup, std::function<void()> fnTask, const bool bRunLast = false)
+        {
+            // Queue the task with a promise for its result.
+            std::shared_ptr<std::promise<void>> pPromise = std::make_shared<std::promise<void>>();
+            std::future<void> fuTask                     = pPromise->get_future();
+            this->Enqueue(stTaskGroup, {std::move(fnTask), &stTaskGroup, stTaskGroup.m_ePriority, std::move(pPromise)}, bRunLast);
+            return fuTask;
+        }
+
+        /******************************************************************************
+         * @brief Wait for every task in a group to finish. The group's queued tasks are
+         *      run on the calling thread, then it blocks until the ones already running on
+         *      workers are done.
+         *
+         * @param stTaskGroup - The group to wait on.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void Wait(TaskGroup& stTaskGroup)
+        {
+            // Help with the group's queued tasks instead of just blocking.
+            Task stTask;
+            while (stTaskGroup.m_nQueuedTasks > 0 && this->TakeGroupTask(stTaskGroup, stTask))
+            {
+                this->RunTask(stTask);
+            }
+
+            // Wait for the tasks running on other threads. Always taking the lock means the last task is done with the group.
+            std::unique_lock<std::mutex> lkFinishedLock(stTaskGroup.m_muFinishedMutex);
+            stTaskGroup.m_cdFinishedCondition.wait(lkFinishedLock, [&stTaskGroup]() { return stTaskGroup.m_nPendingTasks <= 0; });
+        }
+
+        /******************************************************************************
+         * @brief Remove a group's tasks that haven't started yet. Tasks that are already
+         *      running keep running.
+         *
+         * @param stTaskGroup - The group to clear.
+         * @return int - The number of tasks removed.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        int Purge(TaskGroup& stTaskGroup)
+        {
+            // Remove the group's tasks from every queue. The group's priority may have changed, so check every class.
+            int nRemovedTasks = 0;
+            for (std::unique_ptr<WorkerQueue>& pWorkerQueue : m_vWorkerQueues)
+            {
+                std::lock_guard<std::mutex> lkQueueLock(pWorkerQueue->muQueueMutex);
+                for (int nPriority = 0; nPriority < NUM_THREAD_PRIORITIES; ++nPriority)
+                {
+                    std::deque<Task>& dqTasks = pWorkerQueue->adqTasks[nPriority];
+                    size_t siQueueSize        = dqTasks.size();
+                    dqTasks.erase(std::remove_if(dqTasks.begin(), dqTasks.end(), [&stTaskGroup](const Task& stTask) { return stTask.pTaskGroup == &stTaskGroup; }),
+                                  dqTasks.end());
+                    int nRemovedPriorityTasks = static_cast<int>(siQueueSize - dqTasks.size());
+                    m_anPriorityQueuedTasks[nPriority] -= nRemovedPriorityTasks;
+                    nRemovedTasks += nRemovedPriorityTasks;
+                }
+            }
+
+            // Uncount the removed tasks and wake anyone waiting if that was all of them.
+            if (nRemovedTasks > 0)
+            {
+                m_nQueuedTasks -= nRemovedTasks;
+                stTaskGroup.m_nQueuedTasks -= nRemovedTasks;
+                std::lock_guard<std::mutex> lkFinishedLock(stTaskGroup.m_muFinishedMutex);
+                if ((stTaskGroup.m_nPendingTasks -= nRemovedTasks) <= 0)
+                {
+                    stTaskGroup.m_cdFinishedCondition.notify_all();
+                }
+            }
+
+            return nRemovedTasks;
+        }
+
+        /******************************************************************************
+         * @brief Accessor for the number of worker threads.
+         *
+         * @return unsigned int - The number of workers.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        unsigned int GetThreadCount() const { return static_cast<unsigned int>(m_vWorkers.size()); }
+
+        /******************************************************************************
+         * @brief Mutator for the Exception Handler private member. It is called on the
+         *      thread that ran the task, with the exception of any task that has no future
+         *      to hold it. Without a handler those exceptions are dropped.
+         *
+         * @param fnExceptionHandler - The function to report exceptions to. Must not throw.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void SetExceptionHandler(std::function<void(std::exception_ptr)> fnExceptionHandler)
+        {
+            // Swap in the new handler.
+            std::lock_guard<std::mutex> lkExceptionHandlerLock(m_muExceptionHandlerMutex);
+            m_fnExceptionHandler = std::move(fnExceptionHandler);
+        }
+
+    private:
+        // A queued task, the group it belongs to, the priority class it was queued under, and where its result goes.
+        struct Task
+        {
+            public:
+                std::function<void()> fnTask;
+                TaskGroup* pTaskGroup       = nullptr;
+                THREAD_PRIORITIES ePriority = THREAD_PRIORITIES::eNormal;
+                std::shared_ptr<std::promise<void>> pPromise;    // Only set for tasks submitted with SubmitWithFuture().
+        };
+
+        // The tasks waiting on one worker, a queue per priority class. The worker takes from the back, thieves take from the front.
+        struct WorkerQueue
+        {
+            public:
+                std::mutex muQueueMutex;
+                std::array<std::deque<Task>, NUM_THREAD_PRIORITIES> adqTasks;
+        };
+
+        // Declare private member variables.
+        std::vector<std::unique_ptr<WorkerQueue>> m_vWorkerQueues;
+        std::vector<std::thread> m_vWorkers;
+        std::atomic<bool> m_bStopWorkers;
+        std::atomic<int> m_nQueuedTasks;
+        std::array<std::atomic<int>, NUM_THREAD_PRIORITIES> m_anPriorityQueuedTasks;
+        std::atomic<unsigned int> m_unNextQueue;
+        std::mutex m_muSleepMutex;
+        std::condition_variable m_cdSleepCondition;
+        std::mutex m_muExceptionHandlerMutex;
+        std::function<void(std::exception_ptr)> m_fnExceptionHandler;
+
+        // The executor and queue of the worker running on this thread, if it is one.
+        static inline thread_local WorkStealingExecutor* s_pCurrentExecutor = nullptr;
+        static inline thread_local size_t s_siCurrentWorker                 = 0;
+
+        /******************************************************************************
+         * @brief Put a task on a queue. Tasks submitted from a worker go on that worker's
+         *      own queue, others are spread across the queues.
+         *
+         * @param stTaskGroup - The group the task belongs to.
+         * @param stTask - The task to queue.
+         * @param bRunLast - Whether the task should run after everything already queued
+         *      instead of next.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void Enqueue(TaskGroup& stTaskGroup, Task&& stTask, const bool bRunLast)
+        {
+            // Count the task before it can be run.
+            ++stTaskGroup.m_nPendingTasks;
+            ++stTaskGroup.m_nQueuedTasks;
+
+            // Pick a queue. A worker keeps its own tasks, since their data is likely still in its cache.
+            size_t siQueue              = (s_pCurrentExecutor == this) ? s_siCurrentWorker : m_unNextQueue++ % m_vWorkerQueues.size();
+            THREAD_PRIORITIES ePriority = stTask.ePriority;
+            ++m_anPriorityQueuedTasks[static_cast<int>(ePriority)];
+            {
+                std::lock_guard<std::mutex> lkQueueLock(m_vWorkerQueues[siQueue]->muQueueMutex);
+                std::deque<Task>& dqTasks = m_vWorkerQueues[siQueue]->adqTasks[static_cast<int>(ePriority)];
+                if (bRunLast)
+                {
+                    dqTasks.push_front(std::move(stTask));
+                }
+                else
+                {
+                    dqTasks.push_back(std::move(stTask));
+                }
+            }
+            // Wake a sleeping worker. The lock makes sure a worker about to sleep sees the new task.
+            ++m_nQueuedTasks;
+            {
+                std::lock_guard<std::mutex> lkSleepLock(m_muSleepMutex);
+            }
+            m_cdSleepCondition.notify_one();
+        }
+
+        /******************************************************************************
+         * @brief The loop each worker runs. Takes tasks from its own queue first, then
+         *      steals from the others, and sleeps when there is nothing to do.
+         *
+         * @param siWorker - The index of this worker's queue.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void RunWorker(const size_t siWorker)
+        {
+            // Mark this thread as a worker.
+            s_pCurrentExecutor = this;
+            s_siCurrentWorker  = siWorker;
+
+            // Loop until stopped and out of tasks.
+            Task stTask;
+            while (true)
+            {
+                // Run the next task if there is one.
+                if (this->TakeTask(siWorker, stTask))
+                {
+                    this->RunTask(stTask);
+                    continue;
+                }
+
+                // Sleep until there is a task or the executor is stopping.
+                std::unique_lock<std::mutex> lkSleepLock(m_muSleepMutex);
+                m_cdSleepCondition.wait(lkSleepLock, [this]() { return m_bStopWorkers || m_nQueuedTasks > 0; });
+                if (m_bStopWorkers && m_nQueuedTasks <= 0)
+                {
+                    return;
+                }
+            }
+        }
+
+        /******************************************************************************
+         * @brief Take the next task for a worker, from the back of its own queue or the
+         *      front of another worker's. Every queue is checked for a task of one priority
+         *      class before moving on to the next class down.
+         *
+         * @param siWorker - The index of the worker's queue.
+         * @param stTask - Set to the task taken.
+         * @return true - A task was taken.
+         * @return false - Every queue is empty.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        bool TakeTask(const size_t siWorker, Task& stTask)
+        {
+            // Check each priority class in order, skipping ones with nothing queued.
+            for (int nPriority = 0; nPriority < NUM_THREAD_PRIORITIES; ++nPriority)
+            {
+                if (m_anPriorityQueuedTasks[nPriority] <= 0)
+                {
+                    continue;
+                }
+
+                // Check the queues, starting with this worker's own.
+                for (size_t siIter = 0; siIter < m_vWorkerQueues.size(); ++siIter)
+                {
+                    WorkerQueue& stWorkerQueue = *m_vWorkerQueues[(siWorker + siIter) % m_vWorkerQueues.size()];
+                    std::lock_guard<std::mutex> lkQueueLock(stWorkerQueue.muQueueMutex);
+                    std::deque<Task>& dqTasks = stWorkerQueue.adqTasks[nPriority];
+                    if (!dqTasks.empty())
+                    {
+                        // Take the newest task from our own queue, and the oldest from anyone else's.
+                        if (siIter == 0)
+                        {
+                            stTask = std::move(dqTasks.back());
+                            dqTasks.pop_back();
+                        }
+                        else
+                        {
+                            stTask = std::move(dqTasks.front());
+                            dqTasks.pop_front();
+                        }
+                        --m_nQueuedTasks;
+                        --m_anPriorityQueuedTasks[nPriority];
+                        --stTask.pTaskGroup->m_nQueuedTasks;
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        /******************************************************************************
+         * @brief Take the oldest queued task belonging to a group, from any queue.
+         *
+         * @param stTaskGroup - The group to take a task from.
+         * @param stTask - Set to the task taken.
+         * @return true - A task was taken.
+         * @return false - None of the group's tasks are queued.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        bool TakeGroupTask(TaskGroup& stTaskGroup, Task& stTask)
+        {
+            // Look through each queue for one of the group's tasks. The group's priority may have changed, so check every class.
+            for (std::unique_ptr<WorkerQueue>& pWorkerQueue : m_vWorkerQueues)
+            {
+                std::lock_guard<std::mutex> lkQueueLock(pWorkerQueue->muQueueMutex);
+                for (int nPriority = 0; nPriority < NUM_THREAD_PRIORITIES; ++nPriority)
+                {
+                    std::deque<Task>& dqTasks         = pWorkerQueue->adqTasks[nPriority];
+                    std::deque<Task>::iterator itTask = std::find_if(dqTasks.begin(),
+                                                                     dqTasks.end(),
+                                                                     [&stTaskGroup](const Task& stQueuedTask) { return stQueuedTask.pTaskGroup == &stTaskGroup; });
+                    if (itTask != dqTasks.end())
+                    {
+                        stTask = std::move(*itTask);
+                        dqTasks.erase(itTask);
+                        --m_nQueuedTasks;
+                        --m_anPriorityQueuedTasks[nPriority];
+                        --stTaskGroup.m_nQueuedTasks;
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        /******************************************************************************
+         * @brief Run a task and mark it finished in its group. An exception thrown by
+         *      the task is stored in its future if it has one, and given to the exception
+         *      handler otherwise, so it can't take down the worker or leave the group
+         *      waiting forever.
+         *
+         * @param stTask - The task to run. Its function and promise are released afterwards.
+         *
+         * @author agent (agent@local)
+         * @date 2026-10-18
+         ******************************************************************************/
+        void RunTask(Task& stTask)
+        {
+            // Run the task.
+            try
+            {
+                stTask.fnTask();
+                if (stTask.pPromise)
+                {
+                    stTask.pPromise->set_value();
+                }
+            }
+            catch (...)
+            {
+                // Hand the exception to the future, or to the handler if nobody is waiting for the result.
+                if (stTask.pPromise)
+                {
+                    stTask.pPromise->set_exception(std::current_exception());
+                }
+                else
+                {
+                    std::unique_lock<std::mutex> lkExceptionHandlerLock(m_muExceptionHandlerMutex);
+                    std::function<void(std::exception_ptr)> fnExceptionHandler = m_fnExceptionHandler;
+                    lkExceptionHandlerLock.unlock();
+                    if (fnExceptionHandler)
+                    {
+                        fnExceptionHandler(std::current_exception());
+                    }
+                }
+            }
+            // Let go of anything it captured.
+            stTask.fnTask = nullptr;
+            stTask.pPromise.reset();
+
+            // Mark it finished. This is done under the group's lock, so a waiter can't destroy the group while it is still being used here.
+            std::lock_guard<std::mutex> lkFinishedLock(stTask.pTaskGroup->m_muFinishedMutex);
+            if (--stTask.pTaskGroup->m_nPendingTasks <= 0)
+            {
+                stTask.pTaskGroup->m_cdFinishedCondition.notify_all();
+            }
+        }
+};
+
+#endif    // WORKSTEALINGEXECUTOR_HPP
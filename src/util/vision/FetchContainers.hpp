@@ -15,6 +15,8 @@
 #define FETCH_CONTAINERS_HPP
 
 /// \cond
+#include <chrono>
+#include <functional>
 #include <future>
 #include <opencv2/opencv.hpp>
 
@@ -40,6 +42,7 @@ enum class PIXEL_FORMATS
     eYUV,
     eYUYV,
     eYUVJ,
+    eYUV420,
     eHSV,
     eHSL,
     eSRGB,
@@ -47,6 +50,14 @@ enum class PIXEL_FORMATS
     eUNKNOWN
 };
 
+// Declare global/file-scope enumerator.
+enum class SYNTHETIC_PATTERNS
+{
+    eStatic,      // Color bars that never change. Cheapest to generate and to encode.
+    eGradient,    // Color bars sliding sideways. Every frame changes, but predictably, like a camera panning.
+    eNoise        // Color bars with random noise on top. The noise level sets how hard the frames are to encode.
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /******************************************************************************
@@ -59,6 +70,22 @@ enum class PIXEL_FORMATS
  ******************************************************************************/
 namespace containers
 {
+    /******************************************************************************
+     * @brief This struct is used to return information about a copied camera frame
+     *      alongside the frame itself.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    struct FrameMetadata
+    {
+        public:
+            // Declare and define public struct member variables.
+            uint64_t unFrameSequence = 0;                           // Increments every time the camera reads a new frame.
+            std::chrono::system_clock::time_point tmCaptureTime;    // When the camera read the frame.
+            bool bCameraIsOnline = false;                           // Whether the frame came from the camera. False means the camera is disconnected and the frame is black filler.
+    };
+
     /******************************************************************************
      * @brief This struct is used to carry references to camera frames for scheduling and copying.
      *      It is constructed so that a reference to a frame is passed into the container and the pointer
@@ -83,7 +110,11 @@ namespace containers
             // Declare and define public struct member variables.
             T* pFrame;
             PIXEL_FORMATS eFrameType;
+            cv::Size cvFrameSize;
+            cv::Rect2d cvRegionOfInterest;
+            FrameMetadata* pFrameMetadata;
             std::shared_ptr<std::promise<bool>> pCopiedFrameStatus;
+            std::function<void()> fnCopiedFrameCallback;
 
             /******************************************************************************
              * @brief Construct a new Frame Fetch Container object.
@@ -91,11 +122,30 @@ namespace containers
              * @param tFrame - A reference to the frame object to store.
              * @param eFrameType - The image or measure type to store in the frame. This
              *                  is used to determine what is copied to the given frame object.
+             * @param cvFrameSize - The size the copied frame should be scaled to. An empty
+             *                  size means the native resolution of the camera.
+             * @param cvRegionOfInterest - The normalized (0 to 1) region of the camera image to
+             *                  copy. An empty region means the whole image.
+             * @param pFrameMetadata - Where to store information about the copied frame. May be nullptr.
+             * @param fnCopiedFrameCallback - Called right after the future is ready, from whichever thread
+             *                  made it ready. May be empty.
              *
              * @author ClayJay3 (claytonraycowen@gmail.com)
              * @date 2023-09-09
              ******************************************************************************/
-            FrameFetchContainer(T& tFrame, PIXEL_FORMATS eFrameType) : pFrame(&tFrame), eFrameType(eFrameType), pCopiedFrameStatus(std::make_shared<std::promise<bool>>())
+            FrameFetchContainer(T& tFrame,
+                                PIXEL_FORMATS eFrameType,
+                                cv::Size cvFrameSize                         = cv::Size(),
+                                cv::Rect2d cvRegionOfInterest                = cv::Rect2d(),
+                                FrameMetadata* pFrameMetadata                = nullptr,
+                                std::function<void()> fnCopiedFrameCallback = nullptr) :
+                pFrame(&tFrame),
+                eFrameType(eFrameType),
+                cvFrameSize(cvFrameSize),
+                cvRegionOfInterest(cvRegionOfInterest),
+                pFrameMetadata(pFrameMetadata),
+                pCopiedFrameStatus(std::make_shared<std::promise<bool>>()),
+                fnCopiedFrameCallback(std::move(fnCopiedFrameCallback))
             {}
 
             /******************************************************************************
@@ -107,7 +157,13 @@ namespace containers
              * @date 2023-09-26
              ******************************************************************************/
             FrameFetchContainer(const FrameFetchContainer& stOtherFrameContainer) :
-                pFrame(stOtherFrameContainer.pFrame), eFrameType(stOtherFrameContainer.eFrameType), pCopiedFrameStatus(stOtherFrameContainer.pCopiedFrameStatus)
+                pFrame(stOtherFrameContainer.pFrame),
+                eFrameType(stOtherFrameContainer.eFrameType),
+                cvFrameSize(stOtherFrameContainer.cvFrameSize),
+                cvRegionOfInterest(stOtherFrameContainer.cvRegionOfInterest),
+                pFrameMetadata(stOtherFrameContainer.pFrameMetadata),
+                pCopiedFrameStatus(stOtherFrameContainer.pCopiedFrameStatus),
+                fnCopiedFrameCallback(stOtherFrameContainer.fnCopiedFrameCallback)
             {}
 
             /******************************************************************************
@@ -125,14 +181,37 @@ namespace containers
                 if (this != &stOtherFrameContainer)
                 {
                     // Copy struct attributes.
-                    this->pFrame             = stOtherFrameContainer.pFrame;
-                    this->eFrameType         = stOtherFrameContainer.eFrameType;
-                    this->pCopiedFrameStatus = stOtherFrameContainer.pCopiedFrameStatus;
+                    this->pFrame                = stOtherFrameContainer.pFrame;
+                    this->eFrameType            = stOtherFrameContainer.eFrameType;
+                    this->cvFrameSize           = stOtherFrameContainer.cvFrameSize;
+                    this->cvRegionOfInterest    = stOtherFrameContainer.cvRegionOfInterest;
+                    this->pFrameMetadata        = stOtherFrameContainer.pFrameMetadata;
+                    this->pCopiedFrameStatus    = stOtherFrameContainer.pCopiedFrameStatus;
+                    this->fnCopiedFrameCallback = stOtherFrameContainer.fnCopiedFrameCallback;
                 }
 
                 // Return pointer to this object which now contains the copied values.
                 return *this;
             }
+
+            /******************************************************************************
+             * @brief Makes the future ready with whether the frame was copied, then calls
+             *      the copied frame callback if there is one.
+             *
+             * @param bFrameCopied - Whether the frame was copied.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-18
+             ******************************************************************************/
+            void SetCopiedFrameStatus(const bool bFrameCopied)
+            {
+                // Fulfill the promise, then let the requester know.
+                pCopiedFrameStatus->set_value(bFrameCopied);
+                if (fnCopiedFrameCallback)
+                {
+                    fnCopiedFrameCallback();
+                }
+            }
     };
 
     /******************************************************************************
@@ -0,0 +1,950 @@
+/******************************************************************************
+ * @brief Defines and implements a library of pixel format conversion kernels.
+ *      Every (source, destination) pair of PIXEL_FORMATS is resolved at compile
+ *      time to its own kernel through template specialization. A runtime
+ *      dispatch table is built on top of the kernels for code that only knows
+ *      the formats at runtime. Kernels can also crop, rotate, flip, and scale
+ *      in the same pass as the conversion.
+ *
+ * @file PixelConversions.hpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef PIXEL_CONVERSIONS_HPP
+#define PIXEL_CONVERSIONS_HPP
+
+#include "./FetchContainers.hpp"
+
+/// \cond
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <opencv2/opencv.hpp>
+#include <utility>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Namespace containing pixel format traits, conversion kernels, and the
+ *      functions used to run them over whole images.
+ *
+ *      Kernels are written as tight per-row loops over restrict pointers with
+ *      compile-time channel counts so the compiler can vectorize them, and
+ *      images are split into row stripes that run in parallel.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+namespace conversions
+{
+    /******************************************************************************
+     * @brief Intermediate pixel representation that every supported format can be
+     *      loaded into and stored from.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    struct BGRAPixel
+    {
+        public:
+            uint8_t unB;
+            uint8_t unG;
+            uint8_t unR;
+            uint8_t unA;
+    };
+
+    /******************************************************************************
+     * @brief Clamps an integer into the range of an 8 bit channel.
+     *
+     * @param nValue - The value to clamp.
+     * @return uint8_t - The clamped value.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    inline uint8_t SaturateChannel(const int nValue)
+    {
+        // Clamp to [0, 255].
+        return static_cast<uint8_t>(std::clamp(nValue, 0, 255));
+    }
+
+    /******************************************************************************
+     * @brief Computes BT.601 luma with 8 bit fixed-point weights.
+     *
+     * @param stPixel - The pixel to compute luma for.
+     * @return int - The luma value in [0, 255].
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    inline int ComputeLuma(const BGRAPixel& stPixel)
+    {
+        // 0.114, 0.587, 0.299 scaled by 256.
+        return (29 * stPixel.unB + 150 * stPixel.unG + 77 * stPixel.unR + 128) >> 8;
+    }
+
+    /******************************************************************************
+     * @brief Trait describing the memory layout of a pixel format. The primary
+     *      template marks a format as unsupported. Each supported format has a
+     *      specialization that knows its channel count and how to load and store
+     *      a single pixel.
+     *
+     * @tparam ePixelFormat - The pixel format this trait describes.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<PIXEL_FORMATS ePixelFormat>
+    struct PixelLayout
+    {
+        public:
+            static constexpr bool bSupported = false;
+            static constexpr int nChannels   = 0;
+    };
+
+    /******************************************************************************
+     * @brief Base layout for a packed 8 bit format whose channels are a permutation
+     *      of B, G, R and optionally A. PixelLayout specializations for those formats
+     *      inherit from this with their channel offsets.
+     *
+     * @tparam nNumChannels - The number of channels per pixel.
+     * @tparam nBlueIndex - The offset of the blue channel.
+     * @tparam nGreenIndex - The offset of the green channel.
+     * @tparam nRedIndex - The offset of the red channel.
+     * @tparam nAlphaIndex - The offset of the alpha channel, or -1 if there is none.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<int nNumChannels, int nBlueIndex, int nGreenIndex, int nRedIndex, int nAlphaIndex>
+    struct PackedLayout
+    {
+        public:
+            static constexpr bool bSupported = true;
+            static constexpr int nChannels   = nNumChannels;
+
+            static inline void Load(const uint8_t* pPixel, BGRAPixel& stPixel)
+            {
+                // Copy color channels.
+                stPixel.unB = pPixel[nBlueIndex];
+                stPixel.unG = pPixel[nGreenIndex];
+                stPixel.unR = pPixel[nRedIndex];
+                // Formats without alpha are fully opaque.
+                if constexpr (nAlphaIndex >= 0)
+                {
+                    stPixel.unA = pPixel[nAlphaIndex];
+                }
+                else
+                {
+                    stPixel.unA = 255;
+                }
+            }
+
+            static inline void Store(uint8_t* pPixel, const BGRAPixel& stPixel)
+            {
+                // Copy color channels.
+                pPixel[nBlueIndex]  = stPixel.unB;
+                pPixel[nGreenIndex] = stPixel.unG;
+                pPixel[nRedIndex]   = stPixel.unR;
+                // Only store alpha if the format has it.
+                if constexpr (nAlphaIndex >= 0)
+                {
+                    pPixel[nAlphaIndex] = stPixel.unA;
+                }
+            }
+    };
+
+    // Packed color formats.
+    template<>
+    struct PixelLayout<PIXEL_FORMATS::eBGR> : PackedLayout<3, 0, 1, 2, -1>
+    {};
+
+    template<>
+    struct PixelLayout<PIXEL_FORMATS::eRGB> : PackedLayout<3, 2, 1, 0, -1>
+    {};
+
+    template<>
+    struct PixelLayout<PIXEL_FORMATS::eBGRA> : PackedLayout<4, 0, 1, 2, 3>
+    {};
+
+    template<>
+    struct PixelLayout<PIXEL_FORMATS::eRGBA> : PackedLayout<4, 2, 1, 0, 3>
+    {};
+
+    template<>
+    struct PixelLayout<PIXEL_FORMATS::eARGB> : PackedLayout<4, 3, 2, 1, 0>
+    {};
+
+    template<>
+    struct PixelLayout<PIXEL_FORMATS::eABGR> : PackedLayout<4, 1, 2, 3, 0>
+    {};
+
+    /******************************************************************************
+     * @brief PixelLayout for single channel 8 bit grayscale. Loading replicates the
+     *      gray value into every color channel, storing computes BT.601 luma.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<>
+    struct PixelLayout<PIXEL_FORMATS::eGrayscale>
+    {
+        public:
+            static constexpr bool bSupported = true;
+            static constexpr int nChannels   = 1;
+
+            static inline void Load(const uint8_t* pPixel, BGRAPixel& stPixel)
+            {
+                // Replicate gray into every channel.
+                stPixel.unB = pPixel[0];
+                stPixel.unG = pPixel[0];
+                stPixel.unR = pPixel[0];
+                stPixel.unA = 255;
+            }
+
+            static inline void Store(uint8_t* pPixel, const BGRAPixel& stPixel)
+            {
+                // Store luma.
+                pPixel[0] = static_cast<uint8_t>(ComputeLuma(stPixel));
+            }
+    };
+
+    /******************************************************************************
+     * @brief PixelLayout for packed 4:4:4 full range BT.601 YUV, the same layout
+     *      produced by cv::COLOR_BGR2YUV. Coefficients are 8 bit fixed-point.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<>
+    struct PixelLayout<PIXEL_FORMATS::eYUV>
+    {
+        public:
+            static constexpr bool bSupported = true;
+            static constexpr int nChannels   = 3;
+
+            static inline void Load(const uint8_t* pPixel, BGRAPixel& stPixel)
+            {
+                // Center chroma.
+                const int nY = pPixel[0];
+                const int nU = pPixel[1] - 128;
+                const int nV = pPixel[2] - 128;
+                // Inverse transform. 2.032, 0.395, 0.581, 1.140 scaled by 256.
+                stPixel.unB = SaturateChannel(nY + ((520 * nU + 128) >> 8));
+                stPixel.unG = SaturateChannel(nY - ((101 * nU + 149 * nV + 128) >> 8));
+                stPixel.unR = SaturateChannel(nY + ((292 * nV + 128) >> 8));
+                stPixel.unA = 255;
+            }
+
+            static inline void Store(uint8_t* pPixel, const BGRAPixel& stPixel)
+            {
+                // Forward transform. 0.492 and 0.877 scaled by 256.
+                const int nY = ComputeLuma(stPixel);
+                pPixel[0]    = static_cast<uint8_t>(nY);
+                pPixel[1]    = SaturateChannel((((stPixel.unB - nY) * 126 + 128) >> 8) + 128);
+                pPixel[2]    = SaturateChannel((((stPixel.unR - nY) * 224 + 128) >> 8) + 128);
+            }
+    };
+
+    /******************************************************************************
+     * @brief Conversion kernel for a (source, destination) pixel format pair. Each
+     *      pair instantiates its own kernel with the channel counts and layout known
+     *      at compile time, so the per-row loop is fully inlined and vectorizable.
+     *
+     * @tparam eSourceFormat - The pixel format of the input rows.
+     * @tparam eDestFormat - The pixel format of the output rows.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<PIXEL_FORMATS eSourceFormat, PIXEL_FORMATS eDestFormat>
+    struct ConversionKernel
+    {
+        public:
+            using SourceLayout = PixelLayout<eSourceFormat>;
+            using DestLayout   = PixelLayout<eDestFormat>;
+
+            static constexpr bool bSupported = SourceLayout::bSupported && DestLayout::bSupported;
+
+            /******************************************************************************
+             * @brief Converts a single pixel.
+             *
+             * @param pSource - Pointer to the source pixel.
+             * @param pDest - Pointer to the destination pixel.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-18
+             ******************************************************************************/
+            static inline void ConvertPixel(const uint8_t* pSource, uint8_t* pDest)
+            {
+                // Load into the intermediate representation and store in the destination layout.
+                BGRAPixel stPixel;
+                SourceLayout::Load(pSource, stPixel);
+                DestLayout::Store(pDest, stPixel);
+            }
+
+            /******************************************************************************
+             * @brief Converts a row of pixels. Source and destination must not overlap.
+             *
+             * @param pSource - Pointer to the first source pixel of the row.
+             * @param pDest - Pointer to the first destination pixel of the row.
+             * @param nWidth - The number of pixels in the row.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-18
+             ******************************************************************************/
+            static inline void ConvertRow(const uint8_t* __restrict pSource, uint8_t* __restrict pDest, const int nWidth)
+            {
+                // Loop through every pixel in the row.
+                for (int nX = 0; nX < nWidth; ++nX)
+                {
+                    // Convert pixel.
+                    ConvertPixel(pSource + nX * SourceLayout::nChannels, pDest + nX * DestLayout::nChannels);
+                }
+            }
+    };
+
+    /******************************************************************************
+     * @brief Conversion kernel specialization for a format converted to itself. Rows
+     *      are copied straight through.
+     *
+     * @tparam ePixelFormat - The pixel format of the input and output rows.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<PIXEL_FORMATS ePixelFormat>
+    struct ConversionKernel<ePixelFormat, ePixelFormat>
+    {
+        public:
+            using SourceLayout = PixelLayout<ePixelFormat>;
+            using DestLayout   = PixelLayout<ePixelFormat>;
+
+            static constexpr bool bSupported = SourceLayout::bSupported;
+
+            static inline void ConvertPixel(const uint8_t* pSource, uint8_t* pDest)
+            {
+                // Copy pixel.
+                std::memcpy(pDest, pSource, SourceLayout::nChannels);
+            }
+
+            static inline void ConvertRow(const uint8_t* __restrict pSource, uint8_t* __restrict pDest, const int nWidth)
+            {
+                // Copy row.
+                std::memcpy(pDest, pSource, static_cast<size_t>(nWidth) * SourceLayout::nChannels);
+            }
+    };
+
+    /******************************************************************************
+     * @brief Converts an image from one pixel format to another. The format pair is
+     *      resolved at compile time, an unsupported pair fails the build. The image
+     *      is split into row stripes that are converted in parallel.
+     *
+     * @tparam eSourceFormat - The pixel format of cvSource.
+     * @tparam eDestFormat - The pixel format to convert to.
+     * @param cvSource - The image to convert. Must be 8 bit with the channel count of eSourceFormat.
+     * @param cvDest - The image to store the result in. Will be (re)allocated if needed. May alias cvSource.
+     * @return true - The image was converted.
+     * @return false - The source image doesn't match the source format.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<PIXEL_FORMATS eSourceFormat, PIXEL_FORMATS eDestFormat>
+    bool Convert(const cv::Mat& cvSource, cv::Mat& cvDest)
+    {
+        // Define kernel for this format pair.
+        using Kernel = ConversionKernel<eSourceFormat, eDestFormat>;
+        static_assert(PixelLayout<eSourceFormat>::bSupported, "conversions::Convert: source pixel format has no conversion kernel.");
+        static_assert(PixelLayout<eDestFormat>::bSupported, "conversions::Convert: destination pixel format has no conversion kernel.");
+
+        // Check the source image layout.
+        if (cvSource.empty() || cvSource.type() != CV_8UC(Kernel::SourceLayout::nChannels))
+        {
+            return false;
+        }
+
+        // If source and destination alias, keep the source data alive and separate from the output.
+        cv::Mat cvInput = cvSource.data == cvDest.data ? cvSource.clone() : cvSource;
+        // Allocate output.
+        cvDest.create(cvInput.size(), CV_8UC(Kernel::DestLayout::nChannels));
+
+        // Convert rows in parallel stripes.
+        const int nWidth = cvInput.cols;
+        cv::parallel_for_(cv::Range(0, cvInput.rows),
+                          [&cvInput, &cvDest, nWidth](const cv::Range& cvRows)
+                          {
+                              // Loop through rows in this stripe.
+                              for (int nY = cvRows.start; nY < cvRows.end; ++nY)
+                              {
+                                  // Convert row.
+                                  Kernel::ConvertRow(cvInput.ptr<uint8_t>(nY), cvDest.ptr<uint8_t>(nY), nWidth);
+                              }
+                          });
+
+        return true;
+    }
+
+    /////////////////////////////////////////
+    // Geometric transforms.
+    /////////////////////////////////////////
+
+    /******************************************************************************
+     * @brief Describes the orientation and crop correction for a camera. The crop is
+     *      applied to the raw frame first, then the cropped image is rotated clockwise,
+     *      then flipped. All of it is folded into the same pass that converts and scales
+     *      the frame, so no extra full frame copies are made.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    struct FrameTransform
+    {
+        public:
+            // Declare and define public struct member variables.
+            int nRotation        = 0;             // Clockwise rotation in degrees. Must be 0, 90, 180, or 270.
+            bool bFlipHorizontal = false;         // Mirror the image left to right after rotating.
+            bool bFlipVertical   = false;         // Mirror the image top to bottom after rotating.
+            cv::Rect cvCrop      = cv::Rect();    // Region of the raw frame to keep. Empty keeps the whole frame.
+
+            /******************************************************************************
+             * @brief Checks if this transform changes the image at all.
+             *
+             * @return true - The transform does nothing.
+             * @return false - The transform rotates, flips, or crops the image.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-18
+             ******************************************************************************/
+            bool IsIdentity() const { return nRotation % 360 == 0 && !bFlipHorizontal && !bFlipVertical && cvCrop.empty(); }
+
+            /******************************************************************************
+             * @brief Gets the crop rectangle clamped to the bounds of a frame.
+             *
+             * @param cvFrameSize - The size of the raw frame.
+             * @return cv::Rect - The crop region inside the frame.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-18
+             ******************************************************************************/
+            cv::Rect GetCropRegion(const cv::Size& cvFrameSize) const
+            {
+                // Full frame region.
+                cv::Rect cvFrameRegion(0, 0, cvFrameSize.width, cvFrameSize.height);
+                // Empty crops keep the whole frame, otherwise clip the crop to the frame.
+                cv::Rect cvRegion = cvCrop.empty() ? cvFrameRegion : (cvCrop & cvFrameRegion);
+                // Fall back to the whole frame if the crop was completely outside of it.
+                return cvRegion.empty() ? cvFrameRegion : cvRegion;
+            }
+
+            /******************************************************************************
+             * @brief Gets the size of a frame after cropping and rotating, before any scaling.
+             *
+             * @param cvFrameSize - The size of the raw frame.
+             * @return cv::Size - The size of the transformed frame.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-18
+             ******************************************************************************/
+            cv::Size GetOutputSize(const cv::Size& cvFrameSize) const
+            {
+                // Get crop region.
+                cv::Rect cvRegion = this->GetCropRegion(cvFrameSize);
+                // Quarter turns swap width and height.
+                return this->IsQuarterTurn() ? cv::Size(cvRegion.height, cvRegion.width) : cvRegion.size();
+            }
+
+            /******************************************************************************
+             * @brief Checks if the rotation is 90 or 270 degrees.
+             *
+             * @return true - The rotation swaps image axes.
+             * @return false - The rotation keeps image axes.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-18
+             ******************************************************************************/
+            bool IsQuarterTurn() const { return ((nRotation % 360 + 360) % 360) / 90 % 2 == 1; }
+
+            /******************************************************************************
+             * @brief Narrows this transform down to a region of its output image. The region
+             *      is given in normalized coordinates of the rotated and flipped image (what the
+             *      operator actually sees), and is mapped back onto the raw frame so the result
+             *      is still a single crop, rotate, and flip.
+             *
+             * @param cvRegionOfInterest - The normalized (0 to 1) region of the output image to keep.
+             * @param cvFrameSize - The size of the raw frame.
+             * @return FrameTransform - A transform with the same orientation and a smaller crop.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-18
+             ******************************************************************************/
+            FrameTransform GetRegionOfInterestTransform(const cv::Rect2d& cvRegionOfInterest, const cv::Size& cvFrameSize) const
+            {
+                // Clip the region to the image.
+                cv::Rect2d cvRegion = cvRegionOfInterest & cv::Rect2d(0.0, 0.0, 1.0, 1.0);
+                // Nothing to narrow down to.
+                if (cvRegion.empty())
+                {
+                    return *this;
+                }
+
+                // Undo the flips. They were applied last, so they are undone first.
+                if (bFlipHorizontal)
+                {
+                    cvRegion.x = 1.0 - cvRegion.x - cvRegion.width;
+                }
+                if (bFlipVertical)
+                {
+                    cvRegion.y = 1.0 - cvRegion.y - cvRegion.height;
+                }
+
+                // Undo the clockwise rotation.
+                cv::Rect2d cvSourceRegion = cvRegion;
+                switch (((nRotation % 360 + 360) % 360) / 90)
+                {
+                    case 1: cvSourceRegion = cv::Rect2d(cvRegion.y, 1.0 - cvRegion.x - cvRegion.width, cvRegion.height, cvRegion.width); break;
+                    case 2: cvSourceRegion = cv::Rect2d(1.0 - cvRegion.x - cvRegion.width, 1.0 - cvRegion.y - cvRegion.height, cvRegion.width, cvRegion.height); break;
+                    case 3: cvSourceRegion = cv::Rect2d(1.0 - cvRegion.y - cvRegion.height, cvRegion.x, cvRegion.height, cvRegion.width); break;
+                    default: break;
+                }
+
+                // Scale into the current crop region of the raw frame.
+                cv::Rect cvCropRegion = this->GetCropRegion(cvFrameSize);
+                int nLeft             = cvCropRegion.x + static_cast<int>(cvSourceRegion.x * cvCropRegion.width);
+                int nTop              = cvCropRegion.y + static_cast<int>(cvSourceRegion.y * cvCropRegion.height);
+                int nRight            = cvCropRegion.x + static_cast<int>(std::ceil((cvSourceRegion.x + cvSourceRegion.width) * cvCropRegion.width));
+                int nBottom           = cvCropRegion.y + static_cast<int>(std::ceil((cvSourceRegion.y + cvSourceRegion.height) * cvCropRegion.height));
+
+                // Build the narrowed transform. Always keep at least one pixel.
+                FrameTransform stRegionTransform = *this;
+                stRegionTransform.cvCrop         = cv::Rect(nLeft, nTop, std::max(nRight - nLeft, 1), std::max(nBottom - nTop, 1)) & cvCropRegion;
+                return stRegionTransform;
+            }
+
+            /******************************************************************************
+             * @brief Equality operator for FrameTransform.
+             *
+             * @param stOther - The transform to compare against.
+             * @return true - The transforms are the same.
+             * @return false - The transforms are different.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-18
+             ******************************************************************************/
+            bool operator==(const FrameTransform& stOther) const
+            {
+                return nRotation == stOther.nRotation && bFlipHorizontal == stOther.bFlipHorizontal && bFlipVertical == stOther.bFlipVertical &&
+                       cvCrop == stOther.cvCrop;
+            }
+    };
+
+    /******************************************************************************
+     * @brief Precomputed sampling positions for one axis of the output image. Each
+     *      entry holds the byte offsets of the two source samples that bracket the
+     *      output pixel and the 8 bit fixed-point weight of the second one.
+     *
+     *      Quarter turns, flips, and crops only ever map an output axis onto a single
+     *      source axis, so every output pixel offset is the sum of one row term and
+     *      one column term. That keeps the per-pixel work to two table lookups.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    struct AxisSamples
+    {
+        public:
+            std::vector<size_t> vOffset0;
+            std::vector<size_t> vOffset1;
+            std::vector<int> vWeight;
+
+            /******************************************************************************
+             * @brief Fills the sampling table for one output axis.
+             *
+             * @param nOutputLength - The number of output pixels along this axis.
+             * @param nSourceLength - The number of source pixels along the source axis it maps to.
+             * @param nSourceStart - The first source pixel along that axis (crop origin).
+             * @param bReverse - Whether the axis runs backwards through the source.
+             * @param szByteStride - Bytes between neighbouring source pixels along that axis.
+             * @param bNearest - Use nearest neighbour sampling instead of bilinear.
+             *
+             * @author agent (agent@local)
+             * @date 2026-10-18
+             ******************************************************************************/
+            void Compute(const int nOutputLength, const int nSourceLength, const int nSourceStart, const bool bReverse, const size_t szByteStride, const bool bNearest)
+            {
+                // Allocate tables.
+                vOffset0.resize(nOutputLength);
+                vOffset1.resize(nOutputLength);
+                vWeight.resize(nOutputLength);
+
+                // Scale between output and source pixel centers.
+                const double dScale = static_cast<double>(nSourceLength) / static_cast<double>(nOutputLength);
+                for (int nI = 0; nI < nOutputLength; ++nI)
+                {
+                    // Map output pixel center into source space.
+                    double dPosition = (nI + 0.5) * dScale - 0.5;
+                    dPosition        = std::clamp(dPosition, 0.0, static_cast<double>(nSourceLength - 1));
+                    // Walk the source axis backwards if needed.
+                    if (bReverse)
+                    {
+                        dPosition = (nSourceLength - 1) - dPosition;
+                    }
+
+                    // Split into integer sample and fixed-point weight.
+                    int nIndex0 = bNearest ? static_cast<int>(dPosition + 0.5) : static_cast<int>(dPosition);
+                    int nIndex1 = std::min(nIndex0 + 1, nSourceLength - 1);
+                    int nWeight = bNearest ? 0 : static_cast<int>((dPosition - nIndex0) * 256.0 + 0.5);
+
+                    // Store byte offsets.
+                    vOffset0[nI] = static_cast<size_t>(nSourceStart + nIndex0) * szByteStride;
+                    vOffset1[nI] = static_cast<size_t>(nSourceStart + nIndex1) * szByteStride;
+                    vWeight[nI]  = nWeight;
+                }
+            }
+    };
+
+    /******************************************************************************
+     * @brief Crops, rotates, flips, scales, and converts an image in a single pass.
+     *      The format pair is resolved at compile time, an unsupported pair fails the
+     *      build. Output rows are computed in parallel stripes.
+     *
+     *      Bilinear sampling only reads the four source pixels around each output pixel,
+     *      so shrinking an axis to less than half its size would skip source pixels and
+     *      alias. In that case the crop region is area averaged down with cv::resize()
+     *      first, then rotated, flipped, and converted at 1:1.
+     *
+     * @tparam eSourceFormat - The pixel format of cvSource.
+     * @tparam eDestFormat - The pixel format to convert to.
+     * @param cvSource - The raw image. Must be 8 bit with the channel count of eSourceFormat.
+     * @param cvDest - The image to store the result in. Must not alias cvSource.
+     * @param stTransform - The crop, rotation, and flip to apply.
+     * @param cvOutputSize - The size to scale the transformed image to. Empty keeps the transformed size.
+     * @param nInterpolation - cv::INTER_NEAREST for nearest neighbour, anything else for bilinear (area averaged below half size).
+     * @return true - The image was converted.
+     * @return false - The source image doesn't match the source format.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<PIXEL_FORMATS eSourceFormat, PIXEL_FORMATS eDestFormat>
+    bool ConvertTransformed(const cv::Mat& cvSource, cv::Mat& cvDest, const FrameTransform& stTransform, const cv::Size& cvOutputSize, const int nInterpolation)
+    {
+        // Define kernel for this format pair.
+        using Kernel = ConversionKernel<eSourceFormat, eDestFormat>;
+        static_assert(PixelLayout<eSourceFormat>::bSupported, "conversions::ConvertTransformed: source pixel format has no conversion kernel.");
+        static_assert(PixelLayout<eDestFormat>::bSupported, "conversions::ConvertTransformed: destination pixel format has no conversion kernel.");
+        constexpr int nSourceChannels = Kernel::SourceLayout::nChannels;
+        constexpr int nDestChannels   = Kernel::DestLayout::nChannels;
+
+        // Check the source image layout.
+        if (cvSource.empty() || cvSource.type() != CV_8UC(nSourceChannels) || cvSource.data == cvDest.data)
+        {
+            return false;
+        }
+
+        // Determine crop region and output size.
+        const cv::Rect cvRegion = stTransform.GetCropRegion(cvSource.size());
+        const cv::Size cvSize   = cvOutputSize.empty() ? stTransform.GetOutputSize(cvSource.size()) : cvOutputSize;
+        const bool bNearest     = nInterpolation == cv::INTER_NEAREST;
+        const size_t szPixel    = nSourceChannels;
+        const size_t szRow      = cvSource.step;
+
+        // Check if an axis shrinks by more than half.
+        const cv::Size cvTransformedSize = stTransform.GetOutputSize(cvSource.size());
+        if (!bNearest && (cvSize.width * 2 < cvTransformedSize.width || cvSize.height * 2 < cvTransformedSize.height))
+        {
+            // Area average the crop region down to the output size, before it's rotated.
+            cv::Mat cvScaledSource;
+            cv::resize(cvSource(cvRegion), cvScaledSource, stTransform.IsQuarterTurn() ? cv::Size(cvSize.height, cvSize.width) : cvSize, 0.0, 0.0, cv::INTER_AREA);
+            // The crop is already applied, only rotate, flip, and convert what's left.
+            FrameTransform stScaledTransform = stTransform;
+            stScaledTransform.cvCrop         = cv::Rect();
+            return ConvertTransformed<eSourceFormat, eDestFormat>(cvScaledSource, cvDest, stScaledTransform, cvSize, nInterpolation);
+        }
+
+        // Work out which source axis each output axis walks along, and in which direction.
+        //  0:   x -> +cols, y -> +rows
+        //  90:  x -> -rows, y -> +cols
+        //  180: x -> -cols, y -> -rows
+        //  270: x -> +rows, y -> -cols
+        const int nQuarterTurns = ((stTransform.nRotation % 360 + 360) % 360) / 90;
+        const bool bSwapAxes    = nQuarterTurns % 2 == 1;
+        bool bReverseX          = nQuarterTurns == 1 || nQuarterTurns == 2;
+        bool bReverseY          = nQuarterTurns == 2 || nQuarterTurns == 3;
+        // Flips are applied after rotating, so they just reverse the output axis.
+        bReverseX ^= stTransform.bFlipHorizontal;
+        bReverseY ^= stTransform.bFlipVertical;
+
+        // Precompute sample tables for both output axes.
+        AxisSamples stColumns;
+        AxisSamples stRows;
+        if (!bSwapAxes)
+        {
+            stColumns.Compute(cvSize.width, cvRegion.width, cvRegion.x, bReverseX, szPixel, bNearest);
+            stRows.Compute(cvSize.height, cvRegion.height, cvRegion.y, bReverseY, szRow, bNearest);
+        }
+        else
+        {
+            stColumns.Compute(cvSize.width, cvRegion.height, cvRegion.y, bReverseX, szRow, bNearest);
+            stRows.Compute(cvSize.height, cvRegion.width, cvRegion.x, bReverseY, szPixel, bNearest);
+        }
+
+        // Allocate output.
+        cvDest.create(cvSize, CV_8UC(nDestChannels));
+
+        // Sample, interpolate, and convert rows in parallel stripes.
+        const uint8_t* pSourceBase = cvSource.ptr<uint8_t>(0);
+        cv::parallel_for_(cv::Range(0, cvSize.height),
+                          [&](const cv::Range& cvRange)
+                          {
+                              // Loop through output rows in this stripe.
+                              for (int nY = cvRange.start; nY < cvRange.end; ++nY)
+                              {
+                                  // Get row terms.
+                                  const uint8_t* pRow0 = pSourceBase + stRows.vOffset0[nY];
+                                  const uint8_t* pRow1 = pSourceBase + stRows.vOffset1[nY];
+                                  const int nWeightY   = stRows.vWeight[nY];
+                                  uint8_t* pDest       = cvDest.ptr<uint8_t>(nY);
+
+                                  // Loop through output pixels in this row.
+                                  for (int nX = 0; nX < cvSize.width; ++nX)
+                                  {
+                                      // Get column terms.
+                                      const size_t szColumn0 = stColumns.vOffset0[nX];
+                                      const size_t szColumn1 = stColumns.vOffset1[nX];
+                                      const int nWeightX     = stColumns.vWeight[nX];
+
+                                      // Interpolate every channel of the source pixel.
+                                      uint8_t aSample[nSourceChannels];
+                                      for (int nC = 0; nC < nSourceChannels; ++nC)
+                                      {
+                                          const int nTop    = pRow0[szColumn0 + nC] * (256 - nWeightX) + pRow0[szColumn1 + nC] * nWeightX;
+                                          const int nBottom = pRow1[szColumn0 + nC] * (256 - nWeightX) + pRow1[szColumn1 + nC] * nWeightX;
+                                          aSample[nC]       = static_cast<uint8_t>((nTop * (256 - nWeightY) + nBottom * nWeightY + 32768) >> 16);
+                                      }
+
+                                      // Convert the sample straight into the output.
+                                      Kernel::ConvertPixel(aSample, pDest + nX * nDestChannels);
+                                  }
+                              }
+                          });
+
+        return true;
+    }
+
+    /////////////////////////////////////////
+    // Runtime dispatch.
+    /////////////////////////////////////////
+
+    // Function pointer types stored in the dispatch tables.
+    using ConversionFunction = bool (*)(const cv::Mat&, cv::Mat&);
+    using TransformFunction  = bool (*)(const cv::Mat&, cv::Mat&, const FrameTransform&, const cv::Size&, const int);
+    // Number of entries in the PIXEL_FORMATS enum.
+    constexpr size_t NUM_PIXEL_FORMATS = static_cast<size_t>(PIXEL_FORMATS::eUNKNOWN) + 1;
+
+    /******************************************************************************
+     * @brief Gets the kernel function for a format pair, or nullptr if the pair is
+     *      unsupported. Only supported pairs are instantiated.
+     *
+     * @tparam nSourceFormat - Index of the source pixel format.
+     * @tparam nDestFormat - Index of the destination pixel format.
+     * @return ConversionFunction - The kernel function or nullptr.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<size_t nSourceFormat, size_t nDestFormat>
+    constexpr ConversionFunction GetConversionFunction()
+    {
+        // Check if this pair has a kernel.
+        if constexpr (ConversionKernel<static_cast<PIXEL_FORMATS>(nSourceFormat), static_cast<PIXEL_FORMATS>(nDestFormat)>::bSupported)
+        {
+            return &Convert<static_cast<PIXEL_FORMATS>(nSourceFormat), static_cast<PIXEL_FORMATS>(nDestFormat)>;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Gets the fused transform kernel function for a format pair, or nullptr
+     *      if the pair is unsupported. Only supported pairs are instantiated.
+     *
+     * @tparam nSourceFormat - Index of the source pixel format.
+     * @tparam nDestFormat - Index of the destination pixel format.
+     * @return TransformFunction - The kernel function or nullptr.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<size_t nSourceFormat, size_t nDestFormat>
+    constexpr TransformFunction GetTransformFunction()
+    {
+        // Check if this pair has a kernel.
+        if constexpr (ConversionKernel<static_cast<PIXEL_FORMATS>(nSourceFormat), static_cast<PIXEL_FORMATS>(nDestFormat)>::bSupported)
+        {
+            return &ConvertTransformed<static_cast<PIXEL_FORMATS>(nSourceFormat), static_cast<PIXEL_FORMATS>(nDestFormat)>;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Builds the flattened [source][destination] dispatch table at compile time.
+     *
+     * @tparam nIndices - Flattened indices of every format pair.
+     * @return std::array<ConversionFunction, NUM_PIXEL_FORMATS * NUM_PIXEL_FORMATS> - The table.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<size_t... nIndices>
+    constexpr std::array<ConversionFunction, NUM_PIXEL_FORMATS * NUM_PIXEL_FORMATS> BuildConversionTable(std::index_sequence<nIndices...>)
+    {
+        return {GetConversionFunction<nIndices / NUM_PIXEL_FORMATS, nIndices % NUM_PIXEL_FORMATS>()...};
+    }
+
+    /******************************************************************************
+     * @brief Builds the flattened [source][destination] fused transform dispatch table
+     *      at compile time.
+     *
+     * @tparam nIndices - Flattened indices of every format pair.
+     * @return std::array<TransformFunction, NUM_PIXEL_FORMATS * NUM_PIXEL_FORMATS> - The table.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<size_t... nIndices>
+    constexpr std::array<TransformFunction, NUM_PIXEL_FORMATS * NUM_PIXEL_FORMATS> BuildTransformTable(std::index_sequence<nIndices...>)
+    {
+        return {GetTransformFunction<nIndices / NUM_PIXEL_FORMATS, nIndices % NUM_PIXEL_FORMATS>()...};
+    }
+
+    /******************************************************************************
+     * @brief Builds the per-format channel count table at compile time.
+     *
+     * @tparam nIndices - Index of every format.
+     * @return std::array<int, NUM_PIXEL_FORMATS> - The table. Zero for unsupported formats.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    template<size_t... nIndices>
+    constexpr std::array<int, NUM_PIXEL_FORMATS> BuildChannelTable(std::index_sequence<nIndices...>)
+    {
+        return {PixelLayout<static_cast<PIXEL_FORMATS>(nIndices)>::nChannels...};
+    }
+
+    // Compile time dispatch tables.
+    inline constexpr std::array<ConversionFunction, NUM_PIXEL_FORMATS * NUM_PIXEL_FORMATS> CONVERSION_TABLE =
+        BuildConversionTable(std::make_index_sequence<NUM_PIXEL_FORMATS * NUM_PIXEL_FORMATS>{});
+    inline constexpr std::array<TransformFunction, NUM_PIXEL_FORMATS * NUM_PIXEL_FORMATS> TRANSFORM_TABLE =
+        BuildTransformTable(std::make_index_sequence<NUM_PIXEL_FORMATS * NUM_PIXEL_FORMATS>{});
+    inline constexpr std::array<int, NUM_PIXEL_FORMATS> CHANNEL_TABLE = BuildChannelTable(std::make_index_sequence<NUM_PIXEL_FORMATS>{});
+
+    /******************************************************************************
+     * @brief Gets the number of 8 bit channels a pixel format is stored with.
+     *
+     * @param ePixelFormat - The pixel format.
+     * @return int - The channel count, or zero if the format has no conversion kernels.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    inline int GetChannelCount(const PIXEL_FORMATS ePixelFormat)
+    {
+        return CHANNEL_TABLE[static_cast<size_t>(ePixelFormat)];
+    }
+
+    /******************************************************************************
+     * @brief Checks if a conversion kernel exists for a format pair.
+     *
+     * @param eSourceFormat - The source pixel format.
+     * @param eDestFormat - The destination pixel format.
+     * @return true - The conversion is supported.
+     * @return false - The conversion is not supported.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    inline bool IsSupported(const PIXEL_FORMATS eSourceFormat, const PIXEL_FORMATS eDestFormat)
+    {
+        return CONVERSION_TABLE[static_cast<size_t>(eSourceFormat) * NUM_PIXEL_FORMATS + static_cast<size_t>(eDestFormat)] != nullptr;
+    }
+
+    /******************************************************************************
+     * @brief Converts an image between pixel formats that are only known at runtime
+     *      by looking up the compile time kernel in the dispatch table.
+     *
+     * @param cvSource - The image to convert.
+     * @param cvDest - The image to store the result in. May alias cvSource.
+     * @param eSourceFormat - The pixel format of cvSource.
+     * @param eDestFormat - The pixel format to convert to.
+     * @return true - The image was converted.
+     * @return false - The pair is unsupported or the source image doesn't match eSourceFormat.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    inline bool Convert(const cv::Mat& cvSource, cv::Mat& cvDest, const PIXEL_FORMATS eSourceFormat, const PIXEL_FORMATS eDestFormat)
+    {
+        // Look up kernel.
+        ConversionFunction pfnConversion = CONVERSION_TABLE[static_cast<size_t>(eSourceFormat) * NUM_PIXEL_FORMATS + static_cast<size_t>(eDestFormat)];
+        // Check if the pair is supported.
+        if (pfnConversion == nullptr)
+        {
+            return false;
+        }
+
+        // Run kernel.
+        return pfnConversion(cvSource, cvDest);
+    }
+
+    /******************************************************************************
+     * @brief Crops, rotates, flips, scales, and converts an image in a single pass
+     *      for pixel formats that are only known at runtime.
+     *
+     * @param cvSource - The raw image.
+     * @param cvDest - The image to store the result in. Must not alias cvSource.
+     * @param eSourceFormat - The pixel format of cvSource.
+     * @param eDestFormat - The pixel format to convert to.
+     * @param stTransform - The crop, rotation, and flip to apply.
+     * @param cvOutputSize - The size to scale the transformed image to. Empty keeps the transformed size.
+     * @param nInterpolation - cv::INTER_NEAREST for nearest neighbour, anything else for bilinear (area averaged below half size).
+     * @return true - The image was converted.
+     * @return false - The pair is unsupported or the source image doesn't match eSourceFormat.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    inline bool Convert(const cv::Mat& cvSource,
+                        cv::Mat& cvDest,
+                        const PIXEL_FORMATS eSourceFormat,
+                        const PIXEL_FORMATS eDestFormat,
+                        const FrameTransform& stTransform,
+                        const cv::Size& cvOutputSize,
+                        const int nInterpolation = cv::INTER_LINEAR)
+    {
+        // Look up kernel.
+        TransformFunction pfnTransform = TRANSFORM_TABLE[static_cast<size_t>(eSourceFormat) * NUM_PIXEL_FORMATS + static_cast<size_t>(eDestFormat)];
+        // Check if the pair is supported.
+        if (pfnTransform == nullptr)
+        {
+            return false;
+        }
+
+        // Run kernel.
+        return pfnTransform(cvSource, cvDest, stTransform, cvOutputSize, nInterpolation);
+    }
+}    // namespace conversions
+
+#endif    // PIXEL_CONVERSIONS_HPP
@@ -43,15 +43,22 @@ BasicCam::BasicCam(const std::string szCameraPath,
     m_szCameraPath              = szCameraPath;
     m_nCameraIndex              = -1;
     m_nNumFrameRetrievalThreads = nNumFrameRetrievalThreads;
+    m_unFrameSequence           = 0;
+    m_bFrameIsFromCamera        = false;
+    m_bUndistortionEnabled      = false;
+    m_unUndistortionMapLookups  = 0;
+    m_bCaptureStalled           = false;
+    m_bFrameCopiesOpen          = false;
+    m_pCamera                   = std::make_shared<cv::VideoCapture>();
 
     // Set flag specifying that the camera is located at a dev/video index.
     m_bCameraIsConnectedOnVideoIndex = false;
 
     // Attempt to open camera with OpenCV's VideoCapture and print if successfully opened or not.
-    if (m_cvCamera.open(szCameraPath))
+    if (m_pCamera->open(szCameraPath))
     {
         // Submit logger message.
-        LOG_INFO(logging::g_qSharedLogger, "Camera {} at path/URL {} has been successfully opened.", m_cvCamera.getBackendName(), m_szCameraPath);
+        LOG_INFO(logging::g_qSharedLogger, "Camera {} at path/URL {} has been successfully opened.", m_pCamera->getBackendName(), m_szCameraPath);
     }
     else
     {
@@ -95,6 +102,13 @@ BasicCam::BasicCam(const int nCameraIndex,
     m_nCameraIndex              = nCameraIndex;
     m_szCameraPath              = "";
     m_nNumFrameRetrievalThreads = nNumFrameRetrievalThreads;
+    m_unFrameSequence           = 0;
+    m_bFrameIsFromCamera        = false;
+    m_bUndistortionEnabled      = false;
+    m_unUndistortionMapLookups  = 0;
+    m_bCaptureStalled           = false;
+    m_bFrameCopiesOpen          = false;
+    m_pCamera                   = std::make_shared<cv::VideoCapture>();
 
     // Limit this classes FPS to the given camera FPS.
     this->SetMainThreadIPSLimit(nPropFramesPerSecond);
@@ -103,17 +117,17 @@ BasicCam::BasicCam(const int nCameraIndex,
     m_bCameraIsConnectedOnVideoIndex = true;
 
     // Set video cap properties.
-    m_cvCamera.set(cv::CAP_PROP_FRAME_WIDTH, nPropResolutionX);
-    m_cvCamera.set(cv::CAP_PROP_FRAME_HEIGHT, nPropResolutionY);
-    m_cvCamera.set(cv::CAP_PROP_FPS, nPropFramesPerSecond);
+    m_pCamera->set(cv::CAP_PROP_FRAME_WIDTH, nPropResolutionX);
+    m_pCamera->set(cv::CAP_PROP_FRAME_HEIGHT, nPropResolutionY);
+    m_pCamera->set(cv::CAP_PROP_FPS, nPropFramesPerSecond);
 
     // Attempt to open camera with OpenCV's VideoCapture.
-    m_cvCamera.open(m_nCameraIndex);
+    m_pCamera->open(m_nCameraIndex);
     // Check if the camera was successfully opened.
-    if (m_cvCamera.isOpened())
+    if (m_pCamera->isOpened())
     {
         // Submit logger message.
-        LOG_INFO(logging::g_qSharedLogger, "Camera {} at video index {} has been successfully opened.", m_cvCamera.getBackendName(), m_nCameraIndex);
+        LOG_INFO(logging::g_qSharedLogger, "Camera {} at video index {} has been successfully opened.", m_pCamera->getBackendName(), m_nCameraIndex);
     }
     else
     {
@@ -125,6 +139,74 @@ BasicCam::BasicCam(const int nCameraIndex,
     this->SetMainThreadIPSLimit(nPropFramesPerSecond);
 }
 
+/******************************************************************************
+ * @brief Construct a new Basic Cam:: Basic Cam object that reads a video file or
+ *      stream in place of the camera at a video index. The camera still reports the
+ *      index as its location, so it is handled, recorded, and streamed exactly like
+ *      the real camera would be. Used by cameras that play back footage or make their
+ *      own frames.
+ *
+ * @param nCameraIndex - The video index of the camera this stands in for.
+ * @param szSourcePath - The file path or URL to read frames from. Empty opens nothing, for cameras that make their own frames.
+ * @param nPropResolutionX - X res of camera.
+ * @param nPropResolutionY - Y res of camera.
+ * @param nPropFramesPerSecond - FPS camera is running at.
+ * @param ePropPixelFormat - The pixel layout/format of the image.
+ * @param dPropHorizontalFOV - The horizontal field of view.
+ * @param dPropVerticalFOV - The vertical field of view.
+ * @param bEnableRecordingFlag - Whether or not this camera should be recorded.
+ * @param nNumFrameRetrievalThreads - The number of threads to use for frame queueing and copying.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+BasicCam::BasicCam(const int nCameraIndex,
+                   const std::string szSourcePath,
+                   const int nPropResolutionX,
+                   const int nPropResolutionY,
+                   const int nPropFramesPerSecond,
+                   const PIXEL_FORMATS ePropPixelFormat,
+                   const double dPropHorizontalFOV,
+                   const double dPropVerticalFOV,
+                   const bool bEnableRecordingFlag,
+                   const int nNumFrameRetrievalThreads) :
+    Camera(nPropResolutionX, nPropResolutionY, nPropFramesPerSecond, ePropPixelFormat, dPropHorizontalFOV, dPropVerticalFOV, bEnableRecordingFlag)
+{
+    // Assign member variables.
+    m_szCameraPath              = szSourcePath;
+    m_nCameraIndex              = nCameraIndex;
+    m_nNumFrameRetrievalThreads = nNumFrameRetrievalThreads;
+    m_unFrameSequence           = 0;
+    m_bFrameIsFromCamera        = false;
+    m_bUndistortionEnabled      = false;
+    m_unUndistortionMapLookups  = 0;
+    m_bCaptureStalled           = false;
+    m_bFrameCopiesOpen          = false;
+    m_pCamera                   = std::make_shared<cv::VideoCapture>();
+
+    // Set flag specifying that the camera is located at a dev/video index. Only the frames come from the path.
+    m_bCameraIsConnectedOnVideoIndex = true;
+
+    // Check if there is a source to open.
+    if (!szSourcePath.empty())
+    {
+        // Attempt to open the source with OpenCV's VideoCapture and print if successfully opened or not.
+        if (m_pCamera->open(szSourcePath))
+        {
+            // Submit logger message.
+            LOG_INFO(logging::g_qSharedLogger, "Camera at video index {} is reading from {} with {}.", m_nCameraIndex, m_szCameraPath, m_pCamera->getBackendName());
+        }
+        else
+        {
+            // Submit logger message.
+            LOG_ERROR(logging::g_qSharedLogger, "Unable to open {} for camera at video index {}", m_szCameraPath, m_nCameraIndex);
+        }
+    }
+
+    // Set max FPS of the ThreadedContinuousCode method.
+    this->SetMainThreadIPSLimit(nPropFramesPerSecond);
+}
+
 /******************************************************************************
  * @brief Destroy the Basic Cam:: Basic Cam object.
  *
@@ -139,7 +221,7 @@ BasicCam::~BasicCam()
     this->Join();
 
     // Release camera capture object.
-    m_cvCamera.release();
+    this->GetCapture()->release();
 
     // Submit logger message.
     LOG_INFO(logging::g_qSharedLogger, "Basic camera at video index {} has been successfully closed.", m_nCameraIndex);
@@ -159,8 +241,48 @@ BasicCam::~BasicCam()
  ******************************************************************************/
 void BasicCam::ThreadedContinuousCode()
 {
+    // Check if the thread just started.
+    if (!m_bFrameCopiesOpen)
+    {
+        // Frame requests can be queued now that there is a thread to copy them.
+        std::unique_lock<std::shared_mutex> lkScheduler(m_muPoolScheduleMutex);
+        m_bFrameCopiesOpen = true;
+    }
+
+    // Check if this thread replaced one that stalled on the capture.
+    if (m_bCaptureStalled)
+    {
+        // Serve black frames until the camera is back, and let anyone watching this camera know it's gone.
+        this->ClearFrame();
+        this->PublishCameraState(false);
+
+        // The stuck thread still has the old capture, so open the camera again on a fresh one.
+        bool bCameraReopened = this->ReopenCapture();
+        // Check if this thread got stuck opening the camera and was replaced too.
+        if (this->GetMainThreadWasReplaced())
+        {
+            return;
+        }
+        // Frame requests can be queued again.
+        m_bCaptureStalled = false;
+
+        // Check if camera was reopened.
+        if (bCameraReopened)
+        {
+            // Submit logger message.
+            LOG_INFO(logging::g_qSharedLogger, "Camera {}/{} has been reopened after its capture stalled.", m_nCameraIndex, m_szCameraPath);
+            // Let anyone watching this camera know it's back.
+            this->PublishCameraState(true);
+        }
+        else
+        {
+            // Submit logger message.
+            LOG_WARNING(logging::g_qSharedLogger, "Unable to reopen Camera {}/{} after its capture stalled! Trying again in 5 seconds...", m_nCameraIndex, m_szCameraPath);
+        }
+    }
+
     // Check if camera is NOT open.
-    if (!m_cvCamera.isOpened())
+    if (!this->GetCameraIsOpen())
     {
         // If this is the first iteration of the thread the camera probably isn't present so stop thread to save resources.
         if (this->GetThreadState() == AutonomyThreadState::eStarting)
@@ -183,16 +305,12 @@ void BasicCam::ThreadedContinuousCode()
             // Only try to reopen camera every 5 seconds.
             if (nTimeSinceEpoch % 5 == 0 && !bReopenAlreadyChecked)
             {
-                // Check if camera was opened with an index or path.
-                if (m_nCameraIndex == -1)
+                // Attempt to reopen camera.
+                bCameraReopened = this->ReopenCapture();
+                // Check if this thread got stuck opening the camera and was replaced.
+                if (this->GetMainThreadWasReplaced())
                 {
-                    // Attempt to reopen camera.
-                    bCameraReopened = m_cvCamera.open(m_szCameraPath);
-                }
-                else
-                {
-                    // Attempt to reopen camera.
-                    bCameraReopened = m_cvCamera.open(m_nCameraIndex);
+                    return;
                 }
 
                 // Check if camera was reopened.
@@ -200,6 +318,8 @@ void BasicCam::ThreadedContinuousCode()
                 {
                     // Submit logger message.
                     LOG_INFO(logging::g_qSharedLogger, "Camera {}/{} has been reconnected and reopened!", m_nCameraIndex, m_szCameraPath);
+                    // Let anyone watching this camera know it's back.
+                    this->PublishCameraState(true);
                 }
                 else
                 {
@@ -220,36 +340,221 @@ void BasicCam::ThreadedContinuousCode()
     }
     else
     {
+        // Frames are read into a Mat owned by this thread, so if the read stalls and this thread is replaced, the stuck read can't write
+        // over the frame the new thread is serving.
+        static thread_local cv::Mat cvReadFrame;
+        std::chrono::system_clock::time_point tmCaptureTime;
+        bool bFrameRead = this->ReadFrame(cvReadFrame, tmCaptureTime);
+        // Check if this thread was stuck reading and was replaced. The new thread has its own capture and frame.
+        if (this->GetMainThreadWasReplaced())
+        {
+            return;
+        }
+
         // Check if new frame was computed successfully.
-        if (m_cvCamera.read(m_cvFrame))
+        if (bFrameRead)
         {
-            // Resize the frame.
-            cv::resize(m_cvFrame, m_cvFrame, cv::Size(m_nPropResolutionX, m_nPropResolutionY), 0.0, 0.0, constants::BASICCAM_RESIZE_INTERPOLATION_METHOD);
+            // Swap the new frame in. The old frame's memory is read into next time.
+            cv::swap(m_cvFrame, cvReadFrame);
+            m_tmFrameCaptureTime = tmCaptureTime;
+            // Mark the frame as real.
+            m_bFrameIsFromCamera = true;
+            // The raw frame is kept as is. Scaling, orientation, and cropping happen in the same pass as the conversion for each request.
+            // A new source frame has arrived, so any conversions of the old one are no longer valid.
+            this->RetireDerivedFrames();
+            // Check if a frame copy is still holding the old frame. If so, let it keep it and read into new memory next time.
+            if (cvReadFrame.u != nullptr && cvReadFrame.u->refcount > 1)
+            {
+                cvReadFrame.release();
+            }
         }
         else
         {
             // Submit logger message.
             LOG_ERROR(logging::g_qSharedLogger, "Unable to read new frame for camera {}, {}! Closing camera...", m_nCameraIndex, m_szCameraPath);
             // Release camera capture.
-            m_cvCamera.release();
+            this->GetCapture()->release();
 
-            // Fill camera frame member variable with zeros. This ensures a non-corrupt, black image.
-            m_cvFrame = cv::Mat::zeros(m_nPropResolutionY, m_nPropResolutionX, CV_8UC3);
+            // Replace the frame with a black one.
+            this->ClearFrame();
+            // Let anyone watching this camera know it's gone.
+            this->PublishCameraState(false);
         }
     }
 
-    // Acquire a shared_lock on the frame copy queue.
+    // Get the number of waiting frame copies. The queue is only locked while each copy is taken out of it, not while copying, so a copy that
+    // hangs can't keep the queue locked.
     std::shared_lock<std::shared_mutex> lkSchedulers(m_muPoolScheduleMutex);
+    size_t siFrameCopies = m_qFrameCopySchedule.size();
+    lkSchedulers.unlock();
     // Check if the frame copy queue is empty.
-    if (!m_qFrameCopySchedule.empty())
+    if (siFrameCopies > 0)
+    {
+        // Serve the frame copies on up to m_nNumFrameRetrievalThreads threads, this one included. Copies cheap enough are all served right here.
+        this->ParallelizeLoop(m_nNumFrameRetrievalThreads,
+                              siFrameCopies,
+                              [this](const size_t siStart, const size_t siEnd)
+                              {
+                                  // Each call serves the next copy in the queue.
+                                  for (size_t siIter = siStart; siIter < siEnd; ++siIter)
+                                  {
+                                      this->PooledLinearCode();
+                                  }
+                              });
+    }
+}
+
+/******************************************************************************
+ * @brief Read the next frame from the capture. Called once per iteration of the
+ *      camera thread. Cameras that play back footage override this to pace frames.
+ *
+ * @param cvFrame - The Mat to read the frame into.
+ * @param tmCaptureTime - Set to the time the frame was captured.
+ * @return true - A new frame was read.
+ * @return false - The capture has failed or ended and will be closed.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool BasicCam::ReadFrame(cv::Mat& cvFrame, std::chrono::system_clock::time_point& tmCaptureTime)
+{
+    // Hold on to the capture, so it stays valid if the read stalls and the camera is reopened on a new one.
+    std::shared_ptr<cv::VideoCapture> pCamera = this->GetCapture();
+    // Read the frame and store the time it was captured.
+    if (!pCamera->read(cvFrame))
+    {
+        return false;
+    }
+    tmCaptureTime = std::chrono::system_clock::now();
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief Open the camera again on a new capture. The old capture is never reused,
+ *      because if it stalled, the thread stuck in it still has it. Cameras that make
+ *      their own frames override this.
+ *
+ * @return true - The camera was opened.
+ * @return false - The camera could not be opened.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool BasicCam::ReopenCapture()
+{
+    // Attempt to open the camera with a path or index on a new capture.
+    std::shared_ptr<cv::VideoCapture> pCamera = std::make_shared<cv::VideoCapture>();
+    bool bCameraOpened                        = !m_szCameraPath.empty() ? pCamera->open(m_szCameraPath) : pCamera->open(m_nCameraIndex);
+    // Check if this thread got stuck opening the camera and was replaced. The new thread owns the capture now.
+    if (this->GetMainThreadWasReplaced())
+    {
+        return false;
+    }
+
+    // Start using the new capture.
+    std::lock_guard<std::mutex> lkCameraLock(m_muCameraMutex);
+    m_pCamera = pCamera;
+    return bCameraOpened;
+}
+
+/******************************************************************************
+ * @brief Accessor for the capture the frames are read from. The camera thread can
+ *      replace it at any time, so use the returned copy instead of reading the
+ *      member again.
+ *
+ * @return std::shared_ptr<cv::VideoCapture> - The current capture.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+std::shared_ptr<cv::VideoCapture> BasicCam::GetCapture()
+{
+    // Acquire lock on the capture.
+    std::lock_guard<std::mutex> lkCameraLock(m_muCameraMutex);
+    return m_pCamera;
+}
+
+/******************************************************************************
+ * @brief Recovers from the camera thread getting stuck, usually in a read that
+ *      is hung inside the USB driver. Every frame copy waiting on the camera is
+ *      failed, so the streams and recorders waiting on them can carry on, and new
+ *      requests fail right away until the camera is back. The stuck thread is
+ *      replaced with a new one that reopens the camera on a fresh capture. Meant
+ *      to be called by the watchdog.
+ *
+ * @return true - The camera thread was replaced.
+ * @return false - The camera thread is stopping or stopped, so nothing was done.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool BasicCam::RecoverFromStall()
+{
+    // Fail new frame requests until the new thread has reopened the camera, so nothing else piles up behind it.
+    m_bCaptureStalled = true;
+    // Start a new camera thread in place of the stuck one.
+    if (!this->ReplaceMainThread())
+    {
+        m_bCaptureStalled = false;
+        return false;
+    }
+
+    // Acquire lock on frame copy queue. It is only held while a copy is queued or taken out, so a thread stuck copying doesn't hold it.
+    std::unique_lock<std::shared_mutex> lkScheduler(m_muPoolScheduleMutex);
+    // Fail every frame copy that was waiting on the stuck thread.
+    size_t siFailedFrameCopies = this->FailFrameCopies();
+    // Release lock on the frame schedule queue.
+    lkScheduler.unlock();
+
+    // Submit logger message.
+    LOG_WARNING(logging::g_qSharedLogger,
+                "Camera {}/{} capture has stalled! Failed {} waiting frame copies and restarted the camera thread.",
+                m_nCameraIndex,
+                m_szCameraPath,
+                siFailedFrameCopies);
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief The code inside this private method runs once in the camera thread after
+ *      it's told to stop. Every frame copy still waiting in the queue is failed, and
+ *      new requests fail right away until the camera is started again, so nothing
+ *      waits forever on a camera that isn't running.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void BasicCam::ThreadedStopCode()
+{
+    // Acquire lock on frame copy queue.
+    std::unique_lock<std::shared_mutex> lkScheduler(m_muPoolScheduleMutex);
+    // Stop accepting frame requests and fail the ones nobody will copy.
+    m_bFrameCopiesOpen = false;
+    this->FailFrameCopies();
+}
+
+/******************************************************************************
+ * @brief Fails every frame copy waiting in the queue, so whoever requested them
+ *      stops waiting and can free the frames. The frame copy queue must be locked.
+ *
+ * @return size_t - The number of frame copies that were failed.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+size_t BasicCam::FailFrameCopies()
+{
+    // Fail and remove each waiting frame copy.
+    size_t siFailedFrameCopies = m_qFrameCopySchedule.size();
+    while (!m_qFrameCopySchedule.empty())
     {
-        // Start the thread pool to store multiple copies of the sl::Mat into the given cv::Mats.
-        this->RunDetachedPool(m_qFrameCopySchedule.size(), m_nNumFrameRetrievalThreads);
-        // Wait for thread pool to finish.
-        this->JoinPool();
-        // Release lock on frame copy queue.
-        lkSchedulers.unlock();
+        m_qFrameCopySchedule.front().SetCopiedFrameStatus(false);
+        m_qFrameCopySchedule.pop();
     }
+
+    return siFailedFrameCopies;
 }
 
 /******************************************************************************
@@ -265,7 +570,7 @@ void BasicCam::ThreadedContinuousCode()
 void BasicCam::PooledLinearCode()
 {
     // Acquire mutex for getting frames out of the queue.
-    std::unique_lock<std::shared_mutex> lkFrameQueue(m_muFrameCopyMutex);
+    std::unique_lock<std::shared_mutex> lkFrameQueue(m_muPoolScheduleMutex);
     // Check if the queue is empty.
     if (!m_qFrameCopySchedule.empty())
     {
@@ -276,10 +581,18 @@ void BasicCam::PooledLinearCode()
         // Release lock.
         lkFrameQueue.unlock();
 
-        // Copy frame to data container.
-        *(stContainer.pFrame) = m_cvFrame.clone();
+        // Get the frame in the requested format and size. Conversions are shared between all requests for this frame. Holding the entry keeps
+        // it alive even if the camera moves on to a new frame while copying.
+        std::shared_ptr<DerivedFrame> pDerivedFrame = this->GetDerivedFrame(stContainer.eFrameType, stContainer.cvFrameSize, stContainer.cvRegionOfInterest);
+        // Copy the frame to the data container.
+        *(stContainer.pFrame) = pDerivedFrame->cvFrame.clone();
+        // Fill in the frame information if it was asked for.
+        if (stContainer.pFrameMetadata != nullptr)
+        {
+            *(stContainer.pFrameMetadata) = pDerivedFrame->stFrameMetadata;
+        }
         // Signal future that the frame has been successfully retrieved.
-        stContainer.pCopiedFrameStatus->set_value(true);
+        stContainer.SetCopiedFrameStatus(true);
     }
     else
     {
@@ -306,6 +619,12 @@ std::future<bool> BasicCam::RequestFrameCopy(cv::Mat& cvFrame)
 
     // Acquire lock on frame copy queue.
     std::unique_lock<std::shared_mutex> lkScheduler(m_muPoolScheduleMutex);
+    // Fail right away if the camera thread isn't running or is recovering from a stall. Nothing would copy the frame.
+    if (!m_bFrameCopiesOpen || m_bCaptureStalled)
+    {
+        stContainer.SetCopiedFrameStatus(false);
+        return stContainer.pCopiedFrameStatus->get_future();
+    }
     // Append frame fetch container to the schedule queue.
     m_qFrameCopySchedule.push(stContainer);
     // Release lock on the frame schedule queue.
@@ -315,6 +634,635 @@ std::future<bool> BasicCam::RequestFrameCopy(cv::Mat& cvFrame)
     return stContainer.pCopiedFrameStatus->get_future();
 }
 
+/******************************************************************************
+ * @brief Puts a frame pointer into a queue so a copy of a frame from the camera can be written to it.
+ *      The copied frame will be converted to the given pixel format and scaled to the given size.
+ *      The first request for a given format and size computes the conversion once for the current
+ *      frame, every other request for the same format and size reuses it until a new frame is read.
+ *      Remember, this code will be ran in whatever, class/thread calls it.
+ *
+ * @param cvFrame - A reference to the cv::Mat to store the frame in.
+ * @param eFrameFormat - The pixel format the copied frame should be in.
+ * @param cvFrameSize - The size the copied frame should be scaled to. An empty size means the camera resolution.
+ * @param cvRegionOfInterest - The normalized (0 to 1) region of the camera image to copy. The region is cut from
+ *                          the full resolution frame before scaling, so it acts as a digital zoom. An empty
+ *                          region means the whole image.
+ * @param pFrameMetadata - Where to store the sequence number and capture time of the copied frame. May be nullptr.
+ *                          Must stay valid until the future is ready.
+ * @param fnCopiedFrameCallback - Called right after the future is ready, from whichever thread made it ready. Lets
+ *                          the requester be woken up instead of polling the future. May be empty.
+ * @return std::future<bool> - A future that should be waited on before the passed in frame is used.
+ *                          Value will be true if frame was successfully retrieved.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+std::future<bool> BasicCam::RequestFrameCopy(cv::Mat& cvFrame,
+                                             const PIXEL_FORMATS eFrameFormat,
+                                             const cv::Size& cvFrameSize,
+                                             const cv::Rect2d& cvRegionOfInterest,
+                                             containers::FrameMetadata* pFrameMetadata,
+                                             const std::function<void()>& fnCopiedFrameCallback)
+{
+    // Assemble the FrameFetchContainer.
+    containers::FrameFetchContainer<cv::Mat> stContainer(cvFrame, eFrameFormat, cvFrameSize, cvRegionOfInterest, pFrameMetadata, fnCopiedFrameCallback);
+
+    // Acquire lock on frame copy queue.
+    std::unique_lock<std::shared_mutex> lkScheduler(m_muPoolScheduleMutex);
+    // Fail right away if the camera thread isn't running or is recovering from a stall. Nothing would copy the frame.
+    if (!m_bFrameCopiesOpen || m_bCaptureStalled)
+    {
+        stContainer.SetCopiedFrameStatus(false);
+        return stContainer.pCopiedFrameStatus->get_future();
+    }
+    // Append frame fetch container to the schedule queue.
+    m_qFrameCopySchedule.push(stContainer);
+    // Release lock on the frame schedule queue.
+    lkScheduler.unlock();
+
+    // Return the future from the promise stored in the container.
+    return stContainer.pCopiedFrameStatus->get_future();
+}
+
+/******************************************************************************
+ * @brief Sets the orientation and crop correction for this camera. The correction is
+ *      applied to every frame copy in the same pass that converts and scales it. The new
+ *      transform takes effect when the next frame is read, so copies of the current frame
+ *      stay consistent.
+ *
+ * @param stFrameTransform - The crop, rotation, and flip to apply to every frame.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void BasicCam::SetFrameTransform(const conversions::FrameTransform& stFrameTransform)
+{
+    // Check that the rotation is a quarter turn.
+    if (stFrameTransform.nRotation % 90 != 0)
+    {
+        // Submit logger message.
+        LOG_ERROR(logging::g_qSharedLogger,
+                  "BasicCam {}/{}: Rotation of {} degrees is not supported! Must be 0, 90, 180, or 270.",
+                  m_nCameraIndex,
+                  m_szCameraPath,
+                  stFrameTransform.nRotation);
+        return;
+    }
+
+    // Acquire lock on the cache.
+    std::lock_guard<std::mutex> lkCacheLock(m_muDerivedFrameCacheMutex);
+    // Store the transform until the next frame is read.
+    m_stPendingFrameTransform = stFrameTransform;
+}
+
+/******************************************************************************
+ * @brief Sets the function called whenever this camera is closed or reopened, so
+ *      other threads can react to the camera coming and going without polling it.
+ *      The callback is called once right away with the current state, and after that
+ *      from the camera thread, so it should be quick. Pass an empty function to stop
+ *      the calls.
+ *
+ * @param fnCameraStateCallback - Called with true when the camera opens and false when it closes.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void BasicCam::SetCameraStateCallback(const std::function<void(const bool)>& fnCameraStateCallback)
+{
+    // Acquire lock on the callback.
+    std::lock_guard<std::mutex> lkCallbackLock(m_muCameraStateCallbackMutex);
+    // Store the new callback.
+    m_fnCameraStateCallback = fnCameraStateCallback;
+
+    // Send the current state, so the watcher doesn't miss a change from before it was set.
+    if (m_fnCameraStateCallback)
+    {
+        m_fnCameraStateCallback(this->GetCameraIsOpen());
+    }
+}
+
+/******************************************************************************
+ * @brief Loads the lens calibration for this camera and enables undistortion of
+ *      every frame copy. The file is an OpenCV FileStorage file (YAML, XML, or JSON)
+ *      in the same layout the OpenCV calibration sample writes: distortion_coefficients,
+ *      and optionally camera_matrix, image_width, and image_height. If there is no
+ *      camera_matrix, one is built from the camera resolution and field of view. This
+ *      must be called before the camera is started.
+ *
+ * @param szCalibrationFile - The path to the calibration file.
+ * @return true - The calibration was loaded and undistortion is enabled.
+ * @return false - The calibration could not be loaded. Undistortion is left as it was.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool BasicCam::LoadCalibration(const std::string& szCalibrationFile)
+{
+    // Open the calibration file.
+    cv::FileStorage fsCalibration(szCalibrationFile, cv::FileStorage::READ);
+    if (!fsCalibration.isOpened())
+    {
+        // Submit logger message.
+        LOG_ERROR(logging::g_qSharedLogger, "BasicCam {}/{}: Unable to open calibration file {}!", m_nCameraIndex, m_szCameraPath, szCalibrationFile);
+        return false;
+    }
+
+    // Read the distortion coefficients. These are required.
+    cv::Mat cvDistortionCoefficients;
+    fsCalibration["distortion_coefficients"] >> cvDistortionCoefficients;
+    if (cvDistortionCoefficients.empty())
+    {
+        // Submit logger message.
+        LOG_ERROR(logging::g_qSharedLogger, "BasicCam {}/{}: Calibration file {} has no distortion_coefficients!", m_nCameraIndex, m_szCameraPath, szCalibrationFile);
+        return false;
+    }
+
+    // Read the camera matrix and the resolution it was calibrated at.
+    cv::Mat cvCameraMatrix;
+    int nCalibrationWidth  = 0;
+    int nCalibrationHeight = 0;
+    fsCalibration["camera_matrix"] >> cvCameraMatrix;
+    fsCalibration["image_width"] >> nCalibrationWidth;
+    fsCalibration["image_height"] >> nCalibrationHeight;
+    cv::Size cvCalibrationSize = cv::Size(nCalibrationWidth, nCalibrationHeight);
+    if (cvCalibrationSize.empty())
+    {
+        // Assume the calibration was done at the camera resolution.
+        cvCalibrationSize = cv::Size(m_nPropResolutionX, m_nPropResolutionY);
+    }
+
+    // Build a pinhole camera matrix from the field of view if the file doesn't have one.
+    if (cvCameraMatrix.empty())
+    {
+        cvCameraMatrix                  = cv::Mat::eye(3, 3, CV_64F);
+        cvCameraMatrix.at<double>(0, 0) = (cvCalibrationSize.width / 2.0) / std::tan(m_dPropHorizontalFOV * M_PI / 360.0);
+        cvCameraMatrix.at<double>(1, 1) = (cvCalibrationSize.height / 2.0) / std::tan(m_dPropVerticalFOV * M_PI / 360.0);
+        cvCameraMatrix.at<double>(0, 2) = cvCalibrationSize.width / 2.0;
+        cvCameraMatrix.at<double>(1, 2) = cvCalibrationSize.height / 2.0;
+
+        // Submit logger message.
+        LOG_INFO(logging::g_qSharedLogger, "BasicCam {}/{}: Calibration file {} has no camera_matrix, using the field of view.", m_nCameraIndex, m_szCameraPath, szCalibrationFile);
+    }
+
+    // Store the calibration.
+    cvCameraMatrix.convertTo(m_cvCameraMatrix, CV_64F);
+    cvDistortionCoefficients.convertTo(m_cvDistortionCoefficients, CV_64F);
+    m_cvCalibrationSize = cvCalibrationSize;
+
+    // Drop any old remap tables and enable undistortion.
+    std::lock_guard<std::mutex> lkMapCacheLock(m_muUndistortionMapCacheMutex);
+    m_mUndistortionMapCache.clear();
+    m_bUndistortionEnabled = true;
+
+    // Submit logger message.
+    LOG_INFO(logging::g_qSharedLogger, "BasicCam {}/{}: Loaded lens calibration from {}. Undistortion is enabled.", m_nCameraIndex, m_szCameraPath, szCalibrationFile);
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief Retrieves the current source frame in the given pixel format and size. If no
+ *      other request has asked for this format and size since the current frame was
+ *      read, the conversion is computed and cached. Otherwise the cached conversion is
+ *      returned. This is called from the frame copy pool, so multiple threads may ask for
+ *      the same conversion at once, only one of them will compute it. The source frame is
+ *      read from the snapshot taken when it was retired, never from m_cvFrame, so a copy
+ *      from a stuck thread can't race the thread that replaced it.
+ *
+ * @param eFrameFormat - The pixel format of the derived frame.
+ * @param cvFrameSize - The size of the derived frame. An empty size means the camera resolution.
+ * @param cvRegionOfInterest - The normalized region of the camera image to keep. An empty region means the whole image.
+ * @return std::shared_ptr<BasicCam::DerivedFrame> - The derived frame and the information about the frame it came from. Stays valid
+ *      for as long as it is held, even after the next source frame is read.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+std::shared_ptr<BasicCam::DerivedFrame> BasicCam::GetDerivedFrame(const PIXEL_FORMATS eFrameFormat, const cv::Size& cvFrameSize, const cv::Rect2d& cvRegionOfInterest)
+{
+    // Acquire lock on the cache. The source frame and transform are only changed with it held.
+    std::unique_lock<std::mutex> lkCacheLock(m_muDerivedFrameCacheMutex);
+    // Get the source frame. cv::Mat assignment is shallow, so this copies nothing.
+    cv::Mat cvSourceFrame = m_cvDerivedSourceFrame;
+    // Empty sizes mean the camera resolution.
+    cv::Size cvOutputSize = cvFrameSize.empty() ? cv::Size(m_nPropResolutionX, m_nPropResolutionY) : cvFrameSize;
+    // Narrow the camera transform down to the requested region. This only changes the crop, so it costs nothing extra.
+    conversions::FrameTransform stFrameTransform = m_stFrameTransform.GetRegionOfInterestTransform(cvRegionOfInterest, cvSourceFrame.size());
+
+    // Find or create the cache entry for this format, size, and crop.
+    const cv::Rect& cvCrop = stFrameTransform.cvCrop;
+    std::shared_ptr<DerivedFrame>& pDerivedFrame =
+        m_mDerivedFrameCache[std::make_tuple(eFrameFormat, cvOutputSize.width, cvOutputSize.height, cvCrop.x, cvCrop.y, cvCrop.width, cvCrop.height)];
+    if (pDerivedFrame == nullptr)
+    {
+        // Create a new empty entry for the current source frame.
+        pDerivedFrame                  = std::make_shared<DerivedFrame>();
+        pDerivedFrame->stFrameMetadata = m_stDerivedFrameMetadata;
+    }
+    // Keep a reference to the entry and release the cache lock so other formats can be computed in parallel.
+    std::shared_ptr<DerivedFrame> pEntry = pDerivedFrame;
+    lkCacheLock.unlock();
+
+    // Lock the entry. If another thread is computing this conversion we will wait for it here.
+    std::lock_guard<std::mutex> lkConversionLock(pEntry->muConversionMutex);
+    // Check if the conversion still needs to be computed.
+    if (!pEntry->bConverted)
+    {
+        // Check if the request matches the source frame exactly.
+        if (eFrameFormat == this->GetSourcePixelFormat(cvSourceFrame) && cvOutputSize == cvSourceFrame.size() && stFrameTransform.IsIdentity() &&
+            !m_bUndistortionEnabled)
+        {
+            // No conversion needed. Share the source frame, the entry keeps its memory alive.
+            pEntry->cvFrame = cvSourceFrame;
+        }
+        // Check if planar YUV 4:2:0 was requested. This is what video encoders take.
+        else if (eFrameFormat == PIXEL_FORMATS::eYUV420)
+        {
+            // Build it from the BGR frame of the same size and region. That frame is shared with any other consumer asking for BGR.
+            std::shared_ptr<DerivedFrame> pBGRFrame = this->GetDerivedFrame(PIXEL_FORMATS::eBGR, cvOutputSize, cvRegionOfInterest);
+            const cv::Mat& cvBGRFrame               = pBGRFrame->cvFrame;
+            // Chroma is subsampled by two in both directions, so the size must be even.
+            if (cvBGRFrame.cols % 2 == 0 && cvBGRFrame.rows % 2 == 0 && cvBGRFrame.channels() == 3)
+            {
+                // Convert to I420. A single channel image with the Y plane followed by the U and V planes.
+                cv::cvtColor(cvBGRFrame, pEntry->cvFrame, cv::COLOR_BGR2YUV_I420);
+            }
+            else
+            {
+                // Submit logger message.
+                LOG_WARNING(logging::g_qSharedLogger,
+                            "BasicCam {}/{}: YUV420 frames must have an even width and height, got {}x{}. Frame will not be converted.",
+                            m_nCameraIndex,
+                            m_szCameraPath,
+                            cvBGRFrame.cols,
+                            cvBGRFrame.rows);
+                pEntry->cvFrame = cv::Mat();
+            }
+        }
+        else
+        {
+            // Convert the source frame.
+            this->ConvertFrame(cvSourceFrame, pEntry->cvFrame, eFrameFormat, cvOutputSize, stFrameTransform);
+        }
+        pEntry->bConverted = true;
+    }
+
+    return pEntry;
+}
+
+/******************************************************************************
+ * @brief Converts a frame to the given pixel format and resizes it. If the camera has
+ *      a lens calibration, the undistortion, crop, rotation, flip, and scale are done by a
+ *      single remap with a cached table, then the small output is converted. If the camera
+ *      only has an orientation or crop correction, the crop, rotation, flip, scale, and
+ *      conversion are all done in one pass over the output image. Otherwise, if the frame
+ *      is being shrunk, it is resized first so the color conversion touches fewer pixels.
+ *
+ * @param cvSourceFrame - The frame to convert.
+ * @param cvDestFrame - The frame to store the result in.
+ * @param eFrameFormat - The pixel format to convert to.
+ * @param cvFrameSize - The size to scale to.
+ * @param stFrameTransform - The crop, rotation, and flip to apply.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void BasicCam::ConvertFrame(const cv::Mat& cvSourceFrame,
+                            cv::Mat& cvDestFrame,
+                            const PIXEL_FORMATS eFrameFormat,
+                            const cv::Size& cvFrameSize,
+                            const conversions::FrameTransform& stFrameTransform)
+{
+    // Determine the pixel format the source frame is actually in. Some cameras hand back grayscale or BGRA frames.
+    PIXEL_FORMATS eSourceFormat = this->GetSourcePixelFormat(cvSourceFrame);
+    // Check if there is a conversion kernel for this format pair.
+    bool bConvert = eSourceFormat != eFrameFormat;
+    if (bConvert && !conversions::IsSupported(eSourceFormat, eFrameFormat))
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger, "BasicCam {}/{}: Unsupported frame copy pixel format requested. Frame will not be converted.", m_nCameraIndex, m_szCameraPath);
+        bConvert = false;
+    }
+
+    // Check if the lens needs to be undistorted.
+    if (m_bUndistortionEnabled)
+    {
+        // Get the remap table for this output. It is built once and reused for every frame.
+        std::shared_ptr<UndistortionMap> pMap = this->GetUndistortionMap(cvSourceFrame.size(), cvFrameSize, stFrameTransform);
+        // Undistort, crop, orient, and scale in one pass. The fixed-point tables let OpenCV use its vectorized, row-parallel remap.
+        cv::Mat cvUndistortedFrame;
+        cv::remap(cvSourceFrame,
+                  cvUndistortedFrame,
+                  pMap->cvMap1,
+                  pMap->cvMap2,
+                  constants::BASICCAM_RESIZE_INTERPOLATION_METHOD == cv::INTER_NEAREST ? cv::INTER_NEAREST : cv::INTER_LINEAR,
+                  cv::BORDER_CONSTANT);
+
+        // Convert the now much smaller frame if needed.
+        if (bConvert)
+        {
+            conversions::Convert(cvUndistortedFrame, cvDestFrame, eSourceFormat, eFrameFormat);
+        }
+        else
+        {
+            // Shallow copy of the newly allocated image.
+            cvDestFrame = cvUndistortedFrame;
+        }
+        return;
+    }
+
+    // Check if the frame needs to be cropped, rotated, or flipped.
+    if (!stFrameTransform.IsIdentity())
+    {
+        // Do everything in a single pass straight into the destination. Unsupported conversions keep the source format.
+        cv::Mat cvTransformedFrame;
+        if (!conversions::Convert(cvSourceFrame,
+                                  cvTransformedFrame,
+                                  eSourceFormat,
+                                  bConvert ? eFrameFormat : eSourceFormat,
+                                  stFrameTransform,
+                                  cvFrameSize,
+                                  constants::BASICCAM_RESIZE_INTERPOLATION_METHOD))
+        {
+            // Submit logger message.
+            LOG_WARNING(logging::g_qSharedLogger, "BasicCam {}/{}: Unable to apply frame transform. Frame will not be transformed.", m_nCameraIndex, m_szCameraPath);
+        }
+        else
+        {
+            // Shallow copy of the newly allocated image.
+            cvDestFrame = cvTransformedFrame;
+            return;
+        }
+    }
+
+    // Check if the frame needs to be resized.
+    bool bResize = cvSourceFrame.size() != cvFrameSize;
+    // Shrink before converting, enlarge after converting. This keeps the color conversion on the smaller image.
+    bool bResizeFirst = bResize && cvFrameSize.area() < cvSourceFrame.size().area();
+
+    // Start from the source frame. cv::Mat assignment is shallow, so this copies nothing.
+    cv::Mat cvWorkingFrame = cvSourceFrame;
+    if (bResizeFirst)
+    {
+        // Resize the frame.
+        cv::resize(cvWorkingFrame, cvWorkingFrame, cvFrameSize, 0.0, 0.0, constants::BASICCAM_RESIZE_INTERPOLATION_METHOD);
+    }
+    if (bConvert)
+    {
+        // Convert the frame with the kernel for this format pair. Always into a new image, the working frame may still share the source memory.
+        cv::Mat cvConvertedFrame;
+        conversions::Convert(cvWorkingFrame, cvConvertedFrame, eSourceFormat, eFrameFormat);
+        cvWorkingFrame = cvConvertedFrame;
+    }
+    if (bResize && !bResizeFirst)
+    {
+        // Resize the frame.
+        cv::resize(cvWorkingFrame, cvWorkingFrame, cvFrameSize, 0.0, 0.0, constants::BASICCAM_RESIZE_INTERPOLATION_METHOD);
+    }
+
+    // Make sure the destination never shares memory with the source frame.
+    if (cvWorkingFrame.data == cvSourceFrame.data)
+    {
+        // Deep copy.
+        cvDestFrame = cvWorkingFrame.clone();
+    }
+    else
+    {
+        // Shallow copy of the newly allocated image.
+        cvDestFrame = cvWorkingFrame;
+    }
+}
+
+/******************************************************************************
+ * @brief Retrieves the remap table for a raw frame size, output size, and transform.
+ *      Tables are built the first time they are needed and kept across frames, so the
+ *      undistortion costs a single remap per output per frame. If multiple threads ask
+ *      for the same table at once, only one of them will build it. Once the cache is
+ *      full, the least recently used table is dropped to make room.
+ *
+ * @param cvFrameSize - The size of the raw frame.
+ * @param cvFrameOutputSize - The size of the output frame.
+ * @param stFrameTransform - The crop, rotation, and flip to apply.
+ * @return std::shared_ptr<UndistortionMap> - The built remap table.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+std::shared_ptr<BasicCam::UndistortionMap> BasicCam::GetUndistortionMap(const cv::Size& cvFrameSize,
+                                                                        const cv::Size& cvFrameOutputSize,
+                                                                        const conversions::FrameTransform& stFrameTransform)
+{
+    // Acquire lock on the map cache.
+    std::unique_lock<std::mutex> lkMapCacheLock(m_muUndistortionMapCacheMutex);
+    // Tables are only valid for one raw frame size.
+    if (cvFrameSize != m_cvUndistortionFrameSize)
+    {
+        // Drop all tables. Any thread still using one holds its own reference.
+        m_mUndistortionMapCache.clear();
+        m_cvUndistortionFrameSize = cvFrameSize;
+    }
+
+    // Find the cache entry for this output size and crop.
+    const cv::Rect cvCrop                                = stFrameTransform.GetCropRegion(cvFrameSize);
+    const std::tuple<int, int, int, int, int, int> tpKey = std::make_tuple(cvFrameOutputSize.width, cvFrameOutputSize.height, cvCrop.x, cvCrop.y, cvCrop.width, cvCrop.height);
+    auto itMap                                           = m_mUndistortionMapCache.find(tpKey);
+    if (itMap == m_mUndistortionMapCache.end())
+    {
+        // Keep the cache from growing forever as regions of interest change. Evict the least recently used table, so the ones still in use stay built.
+        if (!m_mUndistortionMapCache.empty() && m_mUndistortionMapCache.size() >= constants::BASICCAM_UNDISTORTION_MAP_CACHE_SIZE)
+        {
+            auto itLeastRecentlyUsed = std::min_element(m_mUndistortionMapCache.begin(),
+                                                        m_mUndistortionMapCache.end(),
+                                                        [](const auto& stLeft, const auto& stRight) { return stLeft.second->unLastUsed < stRight.second->unLastUsed; });
+            m_mUndistortionMapCache.erase(itLeastRecentlyUsed);
+        }
+
+        // Create a new empty entry.
+        itMap = m_mUndistortionMapCache.emplace(tpKey, std::make_shared<UndistortionMap>()).first;
+    }
+    // Mark the table as just used.
+    std::shared_ptr<UndistortionMap>& pMap = itMap->second;
+    pMap->unLastUsed                       = ++m_unUndistortionMapLookups;
+    // Keep a reference to the entry and release the cache lock so other tables can be built in parallel.
+    std::shared_ptr<UndistortionMap> pEntry = pMap;
+    lkMapCacheLock.unlock();
+
+    // Lock the entry. If another thread is building this table we will wait for it here.
+    std::lock_guard<std::mutex> lkBuildLock(pEntry->muBuildMutex);
+    // Check if the table still needs to be built.
+    if (!pEntry->bBuilt)
+    {
+        // Build the table.
+        this->BuildUndistortionMap(*pEntry, cvFrameSize, cvFrameOutputSize, stFrameTransform);
+        pEntry->bBuilt = true;
+    }
+
+    return pEntry;
+}
+
+/******************************************************************************
+ * @brief Builds a remap table that undistorts the lens, crops, rotates, flips, and
+ *      scales a raw frame in one lookup. The undistorted image is built directly at
+ *      the output resolution by scaling the camera matrix, then the table itself is
+ *      rotated and flipped, and finally it is packed into OpenCV's fixed-point
+ *      CV_16SC2 plus interpolation table format.
+ *
+ * @param stMap - The entry to store the table in.
+ * @param cvFrameSize - The size of the raw frame.
+ * @param cvFrameOutputSize - The size of the output frame.
+ * @param stFrameTransform - The crop, rotation, and flip to apply.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void BasicCam::BuildUndistortionMap(UndistortionMap& stMap,
+                                    const cv::Size& cvFrameSize,
+                                    const cv::Size& cvFrameOutputSize,
+                                    const conversions::FrameTransform& stFrameTransform) const
+{
+    // Scale the camera matrix from the calibration resolution to the raw frame resolution.
+    cv::Mat cvFrameCameraMatrix = m_cvCameraMatrix.clone();
+    double dFrameScaleX         = static_cast<double>(cvFrameSize.width) / m_cvCalibrationSize.width;
+    double dFrameScaleY         = static_cast<double>(cvFrameSize.height) / m_cvCalibrationSize.height;
+    cvFrameCameraMatrix.at<double>(0, 0) *= dFrameScaleX;
+    cvFrameCameraMatrix.at<double>(0, 2) *= dFrameScaleX;
+    cvFrameCameraMatrix.at<double>(1, 1) *= dFrameScaleY;
+    cvFrameCameraMatrix.at<double>(1, 2) *= dFrameScaleY;
+
+    // The table is built before rotating, so quarter turns swap the output width and height.
+    cv::Size cvUnrotatedSize = stFrameTransform.IsQuarterTurn() ? cv::Size(cvFrameOutputSize.height, cvFrameOutputSize.width) : cvFrameOutputSize;
+    // Move the principal point into the crop and scale the whole matrix to the output size.
+    cv::Rect cvCrop              = stFrameTransform.GetCropRegion(cvFrameSize);
+    double dOutputScaleX         = static_cast<double>(cvUnrotatedSize.width) / cvCrop.width;
+    double dOutputScaleY         = static_cast<double>(cvUnrotatedSize.height) / cvCrop.height;
+    cv::Mat cvOutputCameraMatrix = cvFrameCameraMatrix.clone();
+    cvOutputCameraMatrix.at<double>(0, 0) *= dOutputScaleX;
+    cvOutputCameraMatrix.at<double>(1, 1) *= dOutputScaleY;
+    cvOutputCameraMatrix.at<double>(0, 2) = (cvFrameCameraMatrix.at<double>(0, 2) - cvCrop.x + 0.5) * dOutputScaleX - 0.5;
+    cvOutputCameraMatrix.at<double>(1, 2) = (cvFrameCameraMatrix.at<double>(1, 2) - cvCrop.y + 0.5) * dOutputScaleY - 0.5;
+
+    // Build the floating point table for the undistorted, cropped, and scaled image.
+    cv::Mat cvFloatMap;
+    cv::Mat cvUnusedMap;
+    cv::initUndistortRectifyMap(cvFrameCameraMatrix, m_cvDistortionCoefficients, cv::Mat(), cvOutputCameraMatrix, cvUnrotatedSize, CV_32FC2, cvFloatMap, cvUnusedMap);
+
+    // Rotate and flip the table itself, so looking up the output pixel lands on the right raw pixel.
+    switch (((stFrameTransform.nRotation % 360 + 360) % 360) / 90)
+    {
+        case 1: cv::rotate(cvFloatMap, cvFloatMap, cv::ROTATE_90_CLOCKWISE); break;
+        case 2: cv::rotate(cvFloatMap, cvFloatMap, cv::ROTATE_180); break;
+        case 3: cv::rotate(cvFloatMap, cvFloatMap, cv::ROTATE_90_COUNTERCLOCKWISE); break;
+        default: break;
+    }
+    if (stFrameTransform.bFlipHorizontal || stFrameTransform.bFlipVertical)
+    {
+        // Flip code 1 is horizontal, 0 is vertical, and -1 is both.
+        cv::flip(cvFloatMap, cvFloatMap, stFrameTransform.bFlipHorizontal ? (stFrameTransform.bFlipVertical ? -1 : 1) : 0);
+    }
+
+    // Pack into the compact fixed-point form.
+    cv::convertMaps(cvFloatMap, cv::Mat(), stMap.cvMap1, stMap.cvMap2, CV_16SC2);
+}
+
+/******************************************************************************
+ * @brief Determines the pixel format a captured frame is actually stored in. The
+ *      camera is configured with m_ePropPixelFormat, but OpenCV may hand back
+ *      single channel or four channel frames depending on the device and backend.
+ *
+ * @param cvFrame - The captured frame.
+ * @return PIXEL_FORMATS - The pixel format of the frame.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+PIXEL_FORMATS BasicCam::GetSourcePixelFormat(const cv::Mat& cvFrame) const
+{
+    // Trust the configured format if its channel count matches the frame.
+    if (conversions::GetChannelCount(m_ePropPixelFormat) == cvFrame.channels())
+    {
+        return m_ePropPixelFormat;
+    }
+
+    // Otherwise fall back to the OpenCV default layouts.
+    switch (cvFrame.channels())
+    {
+        case 1: return PIXEL_FORMATS::eGrayscale;
+        case 4: return PIXEL_FORMATS::eBGRA;
+        default: return PIXEL_FORMATS::eBGR;
+    }
+}
+
+/******************************************************************************
+ * @brief Drops every derived frame computed from the old source frame and hands the
+ *      current one to the frame copies. This must be called whenever m_cvFrame changes.
+ *      It is only called from the main camera thread between frame copies. Any pending
+ *      frame transform is also applied here for the same reason. A copy that is still
+ *      running from a stuck thread keeps its own reference to the old entries.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void BasicCam::RetireDerivedFrames()
+{
+    // Acquire lock on the cache.
+    std::lock_guard<std::mutex> lkCacheLock(m_muDerivedFrameCacheMutex);
+    // Increment frame sequence.
+    ++m_unFrameSequence;
+    // Clear cached conversions.
+    m_mDerivedFrameCache.clear();
+    // Hand the new source frame and its information to the frame copies.
+    m_cvDerivedSourceFrame                   = m_cvFrame;
+    m_stDerivedFrameMetadata.unFrameSequence = m_unFrameSequence;
+    m_stDerivedFrameMetadata.tmCaptureTime   = m_tmFrameCaptureTime;
+    m_stDerivedFrameMetadata.bCameraIsOnline = m_bFrameIsFromCamera;
+    // Check if the frame transform has changed.
+    if (!(m_stFrameTransform == m_stPendingFrameTransform))
+    {
+        // Remap tables depend on the rotation and flips, so drop them.
+        std::lock_guard<std::mutex> lkMapCacheLock(m_muUndistortionMapCacheMutex);
+        m_mUndistortionMapCache.clear();
+    }
+    // Apply the latest frame transform.
+    m_stFrameTransform = m_stPendingFrameTransform;
+}
+
+/******************************************************************************
+ * @brief Replaces the current frame with a black one, for when the camera is gone.
+ *      Only called from the main camera thread.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void BasicCam::ClearFrame()
+{
+    // Fill camera frame member variable with zeros. This ensures a non-corrupt, black image.
+    m_cvFrame            = cv::Mat::zeros(m_nPropResolutionY, m_nPropResolutionX, CV_8UC3);
+    m_tmFrameCaptureTime = std::chrono::system_clock::now();
+    // Mark the frame as filler so recorders and streamers don't encode it.
+    m_bFrameIsFromCamera = false;
+    // The source frame has changed, so any conversions of the old one are no longer valid.
+    this->RetireDerivedFrames();
+}
+
+/******************************************************************************
+ * @brief Calls the camera state callback, if one is set.
+ *
+ * @param bCameraIsOpen - Whether the camera is now open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void BasicCam::PublishCameraState(const bool bCameraIsOpen)
+{
+    // Acquire lock on the callback.
+    std::lock_guard<std::mutex> lkCallbackLock(m_muCameraStateCallbackMutex);
+    // Call the callback.
+    if (m_fnCameraStateCallback)
+    {
+        m_fnCameraStateCallback(bCameraIsOpen);
+    }
+}
+
 /******************************************************************************
  * @brief Accessor for the camera open status.
  *
@@ -327,7 +1275,7 @@ std::future<bool> BasicCam::RequestFrameCopy(cv::Mat& cvFrame)
 bool BasicCam::GetCameraIsOpen()
 {
     // Get camera status from OpenCV.
-    return m_cvCamera.isOpened();
+    return this->GetCapture()->isOpened();
 }
 
 /******************************************************************************
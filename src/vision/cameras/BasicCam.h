@@ -13,9 +13,17 @@
 
 #include "../../interfaces/AutonomyThread.hpp"
 #include "../../interfaces/Camera.hpp"
+#include "../../util/vision/PixelConversions.hpp"
 
 /// \cond
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <opencv2/opencv.hpp>
+#include <tuple>
 
 /// \endcond
 
@@ -56,6 +64,21 @@ class BasicCam : public Camera<cv::Mat>
                  const int nNumFrameRetrievalThreads = 10);
         ~BasicCam();
         std::future<bool> RequestFrameCopy(cv::Mat& cvFrame) override;
+        std::future<bool> RequestFrameCopy(cv::Mat& cvFrame,
+                                           const PIXEL_FORMATS eFrameFormat,
+                                           const cv::Size& cvFrameSize,
+                                           const cv::Rect2d& cvRegionOfInterest               = cv::Rect2d(),
+                                           containers::FrameMetadata* pFrameMetadata          = nullptr,
+                                           const std::function<void()>& fnCopiedFrameCallback = nullptr);
+        bool RecoverFromStall();
+
+        /////////////////////////////////////////
+        // Setters.
+        /////////////////////////////////////////
+
+        void SetFrameTransform(const conversions::FrameTransform& stFrameTransform);
+        bool LoadCalibration(const std::string& szCalibrationFile);
+        void SetCameraStateCallback(const std::function<void(const bool)>& fnCameraStateCallback);
 
         /////////////////////////////////////////
         // Getters.
@@ -64,24 +87,117 @@ class BasicCam : public Camera<cv::Mat>
         std::string GetCameraLocation() const;
         bool GetCameraIsOpen() override;
 
+    protected:
+        /////////////////////////////////////////
+        // Declare protected methods and member variables.
+        /////////////////////////////////////////
+        BasicCam(const int nCameraIndex,
+                 const std::string szSourcePath,
+                 const int nPropResolutionX,
+                 const int nPropResolutionY,
+                 const int nPropFramesPerSecond,
+                 const PIXEL_FORMATS ePropPixelFormat,
+                 const double dPropHorizontalFOV,
+                 const double dPropVerticalFOV,
+                 const bool bEnableRecordingFlag,
+                 const int nNumFrameRetrievalThreads = 10);
+        virtual bool ReadFrame(cv::Mat& cvFrame, std::chrono::system_clock::time_point& tmCaptureTime);
+        virtual bool ReopenCapture();
+        std::shared_ptr<cv::VideoCapture> GetCapture();
+
     private:
         /////////////////////////////////////////
         // Declare private member variables.
         /////////////////////////////////////////
         // Basic Camera specific.
-        cv::VideoCapture m_cvCamera;
         std::string m_szCameraPath;
+
+        // The capture the frames are read from. It is replaced rather than reopened, since a thread stuck reading from the old one may still be
+        // using it. Only accessed through a copy taken with the mutex held, so it can be replaced while other threads use it.
+        std::shared_ptr<cv::VideoCapture> m_pCamera;
+        std::mutex m_muCameraMutex;
         bool m_bCameraIsConnectedOnVideoIndex;
         int m_nCameraIndex;
         int m_nNumFrameRetrievalThreads;
 
         // Mats for storing frames.
         cv::Mat m_cvFrame;
+        uint64_t m_unFrameSequence;
+        bool m_bFrameIsFromCamera;
+        std::chrono::system_clock::time_point m_tmFrameCaptureTime;
+
+        // Set when the camera thread stalls and is replaced, until the new thread has reopened the camera. Frame requests fail right away meanwhile.
+        std::atomic_bool m_bCaptureStalled;
+        // Whether the camera thread is running and will copy queued frames. Only changed with the frame copy queue locked, so no request is left in it.
+        std::atomic_bool m_bFrameCopiesOpen;
+
+        // Called from the camera thread whenever the camera is closed or reopened.
+        std::function<void(const bool)> m_fnCameraStateCallback;
+        std::mutex m_muCameraStateCallbackMutex;
+
+        // Orientation and crop correction applied to every frame copy.
+        conversions::FrameTransform m_stFrameTransform;
+        conversions::FrameTransform m_stPendingFrameTransform;
+
+        // Struct used to store a frame that has been converted and/or resized from the current source frame.
+        struct DerivedFrame
+        {
+            public:
+                std::mutex muConversionMutex;
+                bool bConverted = false;
+                cv::Mat cvFrame;
+                containers::FrameMetadata stFrameMetadata;
+        };
+
+        // Lens calibration used to undistort frames.
+        bool m_bUndistortionEnabled;
+        cv::Mat m_cvCameraMatrix;
+        cv::Mat m_cvDistortionCoefficients;
+        cv::Size m_cvCalibrationSize;
+
+        // Struct used to store a fixed-point remap table that undistorts, crops, orients, and scales a frame in one pass.
+        struct UndistortionMap
+        {
+            public:
+                std::mutex muBuildMutex;
+                bool bBuilt = false;
+                cv::Mat cvMap1;
+                cv::Mat cvMap2;
+                uint64_t unLastUsed = 0;    // The cache lookup this table was last used on. Guarded by the cache mutex.
+        };
+
+        // Cache of remap tables. Keyed by output width, height, and raw frame crop (x, y, width, height). Kept across frames.
+        std::map<std::tuple<int, int, int, int, int, int>, std::shared_ptr<UndistortionMap>> m_mUndistortionMapCache;
+        std::mutex m_muUndistortionMapCacheMutex;
+        cv::Size m_cvUndistortionFrameSize;
+        uint64_t m_unUndistortionMapLookups;
+
+        // Cache of derived frames for the current source frame. Keyed by pixel format, width, height, and raw frame crop (x, y, width, height).
+        std::map<std::tuple<PIXEL_FORMATS, int, int, int, int, int, int>, std::shared_ptr<DerivedFrame>> m_mDerivedFrameCache;
+        // The source frame the derived frames are made from, and its information. Shallow copies taken when the frame is retired, so a copy
+        // never reads m_cvFrame while the camera thread replaces it.
+        cv::Mat m_cvDerivedSourceFrame;
+        containers::FrameMetadata m_stDerivedFrameMetadata;
+        std::mutex m_muDerivedFrameCacheMutex;
 
         /////////////////////////////////////////
         // Declare private methods.
         /////////////////////////////////////////
         void ThreadedContinuousCode() override;
         void PooledLinearCode() override;
+        void ThreadedStopCode() override;
+        size_t FailFrameCopies();
+        std::shared_ptr<DerivedFrame> GetDerivedFrame(const PIXEL_FORMATS eFrameFormat, const cv::Size& cvFrameSize, const cv::Rect2d& cvRegionOfInterest);
+        void ConvertFrame(const cv::Mat& cvSourceFrame,
+                          cv::Mat& cvDestFrame,
+                          const PIXEL_FORMATS eFrameFormat,
+                          const cv::Size& cvFrameSize,
+                          const conversions::FrameTransform& stFrameTransform);
+        PIXEL_FORMATS GetSourcePixelFormat(const cv::Mat& cvFrame) const;
+        std::shared_ptr<UndistortionMap> GetUndistortionMap(const cv::Size& cvFrameSize, const cv::Size& cvFrameOutputSize, const conversions::FrameTransform& stFrameTransform);
+        void BuildUndistortionMap(UndistortionMap& stMap, const cv::Size& cvFrameSize, const cv::Size& cvFrameOutputSize, const conversions::FrameTransform& stFrameTransform) const;
+        void RetireDerivedFrames();
+        void ClearFrame();
+        void PublishCameraState(const bool bCameraIsOpen);
 };
 #endif
@@ -0,0 +1,222 @@
+/******************************************************************************
+ * @brief Implements the ReplayCam class.
+ *
+ * @file ReplayCam.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "ReplayCam.h"
+#include "../../RoveSoCameraServerLogging.h"
+#include "../recorders/FrameIndexWriter.h"
+
+/// \cond
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Construct a new Replay Cam:: Replay Cam object.
+ *
+ * @param nCameraIndex - The video index of the camera the recording stands in for.
+ * @param szRecordingPath - The recording to play back.
+ * @param dReplaySpeed - How fast to play the recording. 1 keeps the original timing, 2 is twice as fast,
+ *                      and 0 releases frames as fast as they can be decoded.
+ * @param nPropResolutionX - X res of camera.
+ * @param nPropResolutionY - Y res of camera.
+ * @param nPropFramesPerSecond - FPS camera is running at.
+ * @param dPropHorizontalFOV - The horizontal field of view.
+ * @param dPropVerticalFOV - The vertical field of view.
+ * @param bEnableRecordingFlag - Whether or not this camera should be recorded.
+ * @param nNumFrameRetrievalThreads - The number of threads to use for frame queueing and copying.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+ReplayCam::ReplayCam(const int nCameraIndex,
+                     const std::string szRecordingPath,
+                     const double dReplaySpeed,
+                     const int nPropResolutionX,
+                     const int nPropResolutionY,
+                     const int nPropFramesPerSecond,
+                     const double dPropHorizontalFOV,
+                     const double dPropVerticalFOV,
+                     const bool bEnableRecordingFlag,
+                     const int nNumFrameRetrievalThreads) :
+    BasicCam(nCameraIndex,
+             szRecordingPath,
+             nPropResolutionX,
+             nPropResolutionY,
+             nPropFramesPerSecond,
+             PIXEL_FORMATS::eBGR,
+             dPropHorizontalFOV,
+             dPropVerticalFOV,
+             bEnableRecordingFlag,
+             nNumFrameRetrievalThreads)
+{
+    // Assign member variables.
+    m_szRecordingPath = szRecordingPath;
+    m_dReplaySpeed    = dReplaySpeed;
+    m_siFrameNumber   = 0;
+
+    // Load the capture times of the recording.
+    this->LoadFrameIndex();
+
+    // Frames are paced by the recording's timestamps instead of the camera FPS.
+    this->SetMainThreadIPSLimit(0);
+}
+
+/******************************************************************************
+ * @brief Destroy the Replay Cam:: Replay Cam object.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+ReplayCam::~ReplayCam()
+{
+    // Stop threaded code before this object goes away, since the camera thread reads through it.
+    this->RequestStop();
+    this->Join();
+}
+
+/******************************************************************************
+ * @brief Find the recording of a camera in a folder of recordings. Recordings are
+ *      looked for with the names the RecordingHandler gives them, first as one file,
+ *      then as the first file of a segmented recording.
+ *
+ * @param szDirectory - The folder to look in. Ex: a cameras folder from a previous run.
+ * @param nCameraIndex - The video index of the camera.
+ * @return std::string - The path of the recording, or an empty string if there isn't one.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+std::string ReplayCam::FindRecording(const std::string& szDirectory, const int nCameraIndex)
+{
+    // Check each name the camera's recording could have.
+    std::error_code errCode;
+    for (const std::string& szFileName : {std::to_string(nCameraIndex) + ".mkv", std::to_string(nCameraIndex) + "_00000.mkv"})
+    {
+        std::filesystem::path szPath = std::filesystem::path(szDirectory) / szFileName;
+        if (std::filesystem::is_regular_file(szPath, errCode))
+        {
+            return szPath.string();
+        }
+    }
+
+    return "";
+}
+
+/******************************************************************************
+ * @brief Read the next frame of the recording and wait until it is due. When the
+ *      recording ends it starts over from the beginning.
+ *
+ * @param cvFrame - The Mat to read the frame into.
+ * @param tmCaptureTime - Set to the time the frame was released, like a live capture.
+ * @return true - A new frame was read.
+ * @return false - The recording could not be read.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool ReplayCam::ReadFrame(cv::Mat& cvFrame, std::chrono::system_clock::time_point& tmCaptureTime)
+{
+    // Read the next frame.
+    if (!BasicCam::ReadFrame(cvFrame, tmCaptureTime))
+    {
+        // The recording has ended, so start it over.
+        this->GetCapture()->set(cv::CAP_PROP_POS_FRAMES, 0);
+        m_siFrameNumber = 0;
+        if (!BasicCam::ReadFrame(cvFrame, tmCaptureTime))
+        {
+            return false;
+        }
+
+        // Submit logger message.
+        LOG_INFO(logging::g_qSharedLogger, "ReplayCam: Reached the end of {}. Playing it again from the start.", m_szRecordingPath);
+    }
+
+    // Get how long after the first frame this one was captured. The index has the exact capture times, otherwise the frame timestamp is used.
+    int64_t nFrameOffset = 0;
+    if (m_siFrameNumber < m_vCaptureTimes.size())
+    {
+        nFrameOffset = m_vCaptureTimes[m_siFrameNumber] - m_vCaptureTimes.front();
+    }
+    else
+    {
+        nFrameOffset = static_cast<int64_t>(this->GetCapture()->get(cv::CAP_PROP_POS_MSEC) * 1000.0);
+    }
+    // The replay timing starts over with each pass through the recording.
+    if (m_siFrameNumber == 0)
+    {
+        m_tmReplayStart = std::chrono::steady_clock::now();
+    }
+    ++m_siFrameNumber;
+
+    // Wait until the frame is due. Recordings can have long gaps where the camera was offline, so keep checking for a stop request.
+    if (m_dReplaySpeed > 0.0)
+    {
+        std::chrono::steady_clock::time_point tmFrameDue = m_tmReplayStart + std::chrono::microseconds(static_cast<int64_t>(nFrameOffset / m_dReplaySpeed));
+        while (std::chrono::steady_clock::now() < tmFrameDue && this->GetThreadState() != AutonomyThreadState::eStopping)
+        {
+            // Waiting out a gap isn't a stall.
+            this->Heartbeat();
+            std::this_thread::sleep_until(std::min(tmFrameDue, std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
+        }
+    }
+    tmCaptureTime = std::chrono::system_clock::now();
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief Open the recording again on a new capture. It starts over from the beginning.
+ *
+ * @return true - The recording was opened.
+ * @return false - The recording could not be opened.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool ReplayCam::ReopenCapture()
+{
+    // The new capture starts at the first frame, so the replay timing has to as well.
+    m_siFrameNumber = 0;
+    return BasicCam::ReopenCapture();
+}
+
+/******************************************************************************
+ * @brief Load the capture times from the recording's frame index, if it has one.
+ *      Without one, the timestamps in the recording are used instead.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void ReplayCam::LoadFrameIndex()
+{
+    // Open the index file.
+    std::ifstream fIndexFile(m_szRecordingPath + frameindex::FRAMEINDEX_EXTENSION, std::ios::binary);
+    frameindex::FileHeader stHeader;
+    if (!fIndexFile || !fIndexFile.read(reinterpret_cast<char*>(&stHeader), sizeof(stHeader)) || stHeader.unMagic != frameindex::FRAMEINDEX_MAGIC ||
+        stHeader.unVersion != frameindex::FRAMEINDEX_VERSION || stHeader.unRecordSize != sizeof(frameindex::Record))
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger, "ReplayCam: No frame index for {}. Using the recording's timestamps.", m_szRecordingPath);
+        return;
+    }
+
+    // Read the capture time of every frame. A record cut off by a crash is ignored.
+    frameindex::Record stRecord;
+    while (fIndexFile.read(reinterpret_cast<char*>(&stRecord), sizeof(stRecord)))
+    {
+        m_vCaptureTimes.push_back(stRecord.nCaptureTime);
+    }
+
+    // Submit logger message.
+    LOG_INFO(logging::g_qSharedLogger, "ReplayCam: Loaded capture times of {} frames for {}.", m_vCaptureTimes.size(), m_szRecordingPath);
+}
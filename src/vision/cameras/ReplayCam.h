@@ -0,0 +1,78 @@
+/******************************************************************************
+ * @brief Defines the ReplayCam class.
+ *
+ * @file ReplayCam.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef REPLAYCAM_H
+#define REPLAYCAM_H
+
+#include "BasicCam.h"
+
+/// \cond
+#include <chrono>
+#include <opencv2/opencv.hpp>
+#include <string>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This class plays a camera recording back in place of a real camera, so
+ *      the whole camera, streaming, and recording pipeline can be run and profiled
+ *      on a machine without cameras, against real mission footage. It is a BasicCam
+ *      that reads frames from the recording instead of the device, so every frame
+ *      goes through the same conversions and copies a live frame would.
+ *
+ *      Frames are released with the spacing they were originally captured with,
+ *      taken from the recording's frame index if it has one. The replay can also run
+ *      N times faster or as fast as frames can be decoded. The recording loops when
+ *      it reaches the end.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class ReplayCam : public BasicCam
+{
+    public:
+        /////////////////////////////////////////
+        // Declare public methods and member variables.
+        /////////////////////////////////////////
+
+        ReplayCam(const int nCameraIndex,
+                  const std::string szRecordingPath,
+                  const double dReplaySpeed,
+                  const int nPropResolutionX,
+                  const int nPropResolutionY,
+                  const int nPropFramesPerSecond,
+                  const double dPropHorizontalFOV,
+                  const double dPropVerticalFOV,
+                  const bool bEnableRecordingFlag,
+                  const int nNumFrameRetrievalThreads = 10);
+        ~ReplayCam();
+        static std::string FindRecording(const std::string& szDirectory, const int nCameraIndex);
+
+    private:
+        /////////////////////////////////////////
+        // Declare private member variables.
+        /////////////////////////////////////////
+
+        std::string m_szRecordingPath;
+        double m_dReplaySpeed;
+        std::vector<int64_t> m_vCaptureTimes;
+        size_t m_siFrameNumber;
+        std::chrono::steady_clock::time_point m_tmReplayStart;
+
+        /////////////////////////////////////////
+        // Declare private methods.
+        /////////////////////////////////////////
+
+        bool ReadFrame(cv::Mat& cvFrame, std::chrono::system_clock::time_point& tmCaptureTime) override;
+        bool ReopenCapture() override;
+        void LoadFrameIndex();
+};
+#endif
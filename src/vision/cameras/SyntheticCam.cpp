@@ -0,0 +1,269 @@
+/******************************************************************************
+ * @brief Implements the SyntheticCam class.
+ *
+ * @file SyntheticCam.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "SyntheticCam.h"
+#include "../../RoveSoCameraServerLogging.h"
+
+/// \cond
+#include <algorithm>
+#include <array>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Construct a new Synthetic Cam:: Synthetic Cam object.
+ *
+ * @param nCameraIndex - The video index of the camera this stands in for. Also seeds the noise.
+ * @param ePattern - The kind of frames to generate.
+ * @param dNoiseLevel - How strong the noise is, from 0 to 1. Only used by the noise pattern.
+ * @param nPropResolutionX - X res of camera.
+ * @param nPropResolutionY - Y res of camera.
+ * @param nPropFramesPerSecond - FPS camera is running at.
+ * @param dPropHorizontalFOV - The horizontal field of view.
+ * @param dPropVerticalFOV - The vertical field of view.
+ * @param bEnableRecordingFlag - Whether or not this camera should be recorded.
+ * @param nNumFrameRetrievalThreads - The number of threads to use for frame queueing and copying.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+SyntheticCam::SyntheticCam(const int nCameraIndex,
+                           const SYNTHETIC_PATTERNS ePattern,
+                           const double dNoiseLevel,
+                           const int nPropResolutionX,
+                           const int nPropResolutionY,
+                           const int nPropFramesPerSecond,
+                           const double dPropHorizontalFOV,
+                           const double dPropVerticalFOV,
+                           const bool bEnableRecordingFlag,
+                           const int nNumFrameRetrievalThreads) :
+    BasicCam(nCameraIndex,
+             "",
+             nPropResolutionX,
+             nPropResolutionY,
+             nPropFramesPerSecond,
+             PIXEL_FORMATS::eBGR,
+             dPropHorizontalFOV,
+             dPropVerticalFOV,
+             bEnableRecordingFlag,
+             nNumFrameRetrievalThreads)
+{
+    // Assign member variables.
+    m_unNoiseSeed   = (static_cast<uint64_t>(nCameraIndex) + 1) * 0x9E3779B97F4A7C15;
+    m_ePattern      = ePattern;
+    m_dNoiseLevel   = std::clamp(dNoiseLevel, 0.0, 1.0);
+    m_unFrameNumber = 0;
+
+    // Draw the color bars every pattern starts from.
+    const std::array<cv::Scalar, 8> aBarColors = {cv::Scalar(255, 255, 255),
+                                                  cv::Scalar(0, 255, 255),
+                                                  cv::Scalar(255, 255, 0),
+                                                  cv::Scalar(0, 255, 0),
+                                                  cv::Scalar(255, 0, 255),
+                                                  cv::Scalar(0, 0, 255),
+                                                  cv::Scalar(255, 0, 0),
+                                                  cv::Scalar(0, 0, 0)};
+    m_cvColorBars                              = cv::Mat(nPropResolutionY, nPropResolutionX, CV_8UC3);
+    for (size_t siBar = 0; siBar < aBarColors.size(); ++siBar)
+    {
+        int nBarStart = static_cast<int>(siBar * nPropResolutionX / aBarColors.size());
+        int nBarEnd   = static_cast<int>((siBar + 1) * nPropResolutionX / aBarColors.size());
+        m_cvColorBars(cv::Rect(nBarStart, 0, nBarEnd - nBarStart, nPropResolutionY)).setTo(aBarColors[siBar]);
+    }
+
+    // Submit logger message.
+    LOG_INFO(logging::g_qSharedLogger,
+             "Synthetic camera at video index {} is generating {}x{} frames at {} FPS.",
+             nCameraIndex,
+             nPropResolutionX,
+             nPropResolutionY,
+             nPropFramesPerSecond);
+}
+
+/******************************************************************************
+ * @brief Destroy the Synthetic Cam:: Synthetic Cam object.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+SyntheticCam::~SyntheticCam()
+{
+    // Stop threaded code before this object goes away, since the camera thread reads through it.
+    this->RequestStop();
+    this->Join();
+}
+
+/******************************************************************************
+ * @brief Read the frame number and capture time stamped into a frame by a
+ *      SyntheticCam. Works on frames that have been resized or encoded and decoded,
+ *      as long as the aspect ratio is kept and the top rows aren't cropped.
+ *
+ * @param cvFrame - The BGR frame to read.
+ * @param unFrameNumber - Set to the frame number, counting from 1 when the camera started.
+ * @param tmCaptureTime - Set to the time the frame was generated.
+ * @return true - The stamp was read and its check bits match.
+ * @return false - The frame has no readable stamp.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool SyntheticCam::ReadFrameStamp(const cv::Mat& cvFrame, uint64_t& unFrameNumber, std::chrono::system_clock::time_point& tmCaptureTime)
+{
+    // Check that the frame is big enough to hold a stamp.
+    if (cvFrame.empty() || cvFrame.type() != CV_8UC3 || cvFrame.cols < 64 || cvFrame.rows < 3 * cvFrame.cols / 64)
+    {
+        return false;
+    }
+
+    // Read each row of 64 blocks from the center of each block.
+    std::array<uint64_t, 3> aRows = {0, 0, 0};
+    double dBlockSize             = cvFrame.cols / 64.0;
+    for (size_t siRow = 0; siRow < aRows.size(); ++siRow)
+    {
+        int nY = static_cast<int>((siRow + 0.5) * dBlockSize);
+        for (int nBit = 0; nBit < 64; ++nBit)
+        {
+            const cv::Vec3b& cvPixel = cvFrame.at<cv::Vec3b>(nY, static_cast<int>((nBit + 0.5) * dBlockSize));
+            aRows[siRow]             = (aRows[siRow] << 1) | ((cvPixel[0] + cvPixel[1] + cvPixel[2]) > 3 * 127 ? 1 : 0);
+        }
+    }
+
+    // Check the last row, which is the other two combined and inverted.
+    if (aRows[2] != ~(aRows[0] ^ aRows[1]))
+    {
+        return false;
+    }
+    unFrameNumber = aRows[0];
+    tmCaptureTime = std::chrono::system_clock::time_point(std::chrono::microseconds(static_cast<int64_t>(aRows[1])));
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief Accessor for the camera open status. A synthetic camera is always open.
+ *
+ * @return true - Always.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool SyntheticCam::GetCameraIsOpen()
+{
+    // There is no device that could be disconnected.
+    return true;
+}
+
+/******************************************************************************
+ * @brief Called when the camera thread stalled and was replaced. There is no capture
+ *      to reopen, so the new thread just carries on generating frames.
+ *
+ * @return true - Always.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool SyntheticCam::ReopenCapture()
+{
+    // There is no device to open.
+    return true;
+}
+
+/******************************************************************************
+ * @brief Generate the next frame. Called by the camera thread at the camera FPS.
+ *
+ * @param cvFrame - The Mat to draw the frame into. Reused between frames.
+ * @param tmCaptureTime - Set to the time the frame was generated.
+ * @return true - Always.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool SyntheticCam::ReadFrame(cv::Mat& cvFrame, std::chrono::system_clock::time_point& tmCaptureTime)
+{
+    // Count the frame.
+    ++m_unFrameNumber;
+
+    // Draw the pattern.
+    if (m_ePattern == SYNTHETIC_PATTERNS::eStatic)
+    {
+        m_cvColorBars.copyTo(cvFrame);
+    }
+    else
+    {
+        // Slide the color bars sideways a few pixels every frame.
+        cvFrame.create(m_cvColorBars.size(), m_cvColorBars.type());
+        int nShift = static_cast<int>((m_unFrameNumber * 4) % static_cast<uint64_t>(m_cvColorBars.cols));
+        if (nShift > 0)
+        {
+            m_cvColorBars(cv::Rect(0, 0, m_cvColorBars.cols - nShift, m_cvColorBars.rows)).copyTo(cvFrame(cv::Rect(nShift, 0, m_cvColorBars.cols - nShift, m_cvColorBars.rows)));
+            m_cvColorBars(cv::Rect(m_cvColorBars.cols - nShift, 0, nShift, m_cvColorBars.rows)).copyTo(cvFrame(cv::Rect(0, 0, nShift, m_cvColorBars.rows)));
+        }
+        else
+        {
+            m_cvColorBars.copyTo(cvFrame);
+        }
+
+        // Add noise. It is seeded from the camera and frame number, so it's the same on every run.
+        if (m_ePattern == SYNTHETIC_PATTERNS::eNoise && m_dNoiseLevel > 0.0)
+        {
+            double dAmplitude = m_dNoiseLevel * 128.0;
+            cv::RNG cvRandom(m_unNoiseSeed ^ m_unFrameNumber);
+            m_cvNoise.create(cvFrame.size(), CV_8UC3);
+            cvRandom.fill(m_cvNoise, cv::RNG::UNIFORM, 0, 2.0 * dAmplitude + 1.0);
+            cv::addWeighted(cvFrame, 1.0, m_cvNoise, 1.0, -dAmplitude, cvFrame);
+        }
+    }
+
+    // Stamp the frame so it can be traced through the pipeline.
+    tmCaptureTime = std::chrono::system_clock::now();
+    WriteFrameStamp(cvFrame, m_unFrameNumber, tmCaptureTime);
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief Draw the frame number and capture time into the top of a frame. Each is
+ *      a row of 64 square blocks, most significant bit first, white for a one. A
+ *      third row holds both combined and inverted, so readers can tell a real stamp
+ *      from picture content. Blocks are 1/64 of the frame width, so frames narrower
+ *      than 64 pixels aren't stamped.
+ *
+ * @param cvFrame - The BGR frame to draw into.
+ * @param unFrameNumber - The frame number to stamp.
+ * @param tmCaptureTime - The capture time to stamp.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void SyntheticCam::WriteFrameStamp(cv::Mat& cvFrame, const uint64_t unFrameNumber, const std::chrono::system_clock::time_point& tmCaptureTime)
+{
+    // Check that the frame is big enough to hold a stamp.
+    if (cvFrame.cols < 64 || cvFrame.rows < 3 * cvFrame.cols / 64)
+    {
+        return;
+    }
+
+    // Draw each row of blocks.
+    uint64_t unCaptureTime              = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(tmCaptureTime.time_since_epoch()).count());
+    const std::array<uint64_t, 3> aRows = {unFrameNumber, unCaptureTime, ~(unFrameNumber ^ unCaptureTime)};
+    double dBlockSize                   = cvFrame.cols / 64.0;
+    for (size_t siRow = 0; siRow < aRows.size(); ++siRow)
+    {
+        int nTop    = static_cast<int>(siRow * dBlockSize);
+        int nBottom = static_cast<int>((siRow + 1) * dBlockSize);
+        for (int nBit = 0; nBit < 64; ++nBit)
+        {
+            int nLeft  = static_cast<int>(nBit * dBlockSize);
+            int nRight = static_cast<int>((nBit + 1) * dBlockSize);
+            bool bOne  = (aRows[siRow] >> (63 - nBit)) & 1;
+            cvFrame(cv::Rect(nLeft, nTop, nRight - nLeft, nBottom - nTop)).setTo(bOne ? cv::Scalar(255, 255, 255) : cv::Scalar(0, 0, 0));
+        }
+    }
+}
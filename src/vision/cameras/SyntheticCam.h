@@ -0,0 +1,89 @@
+/******************************************************************************
+ * @brief Defines the SyntheticCam class.
+ *
+ * @file SyntheticCam.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef SYNTHETICCAM_H
+#define SYNTHETICCAM_H
+
+#include "BasicCam.h"
+
+/// \cond
+#include <chrono>
+#include <opencv2/opencv.hpp>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This class generates frames in place of a real camera, so the server can
+ *      be loaded with any number of cameras at any resolution and frame rate on a
+ *      machine without them. It is a BasicCam that makes its frames instead of
+ *      reading them, so every frame goes through the same conversions and copies a
+ *      live frame would.
+ *
+ *      The pattern sets how costly the frames are to encode, from a still image to
+ *      noise. Frames are the same on every run, since the noise is seeded from the
+ *      camera index and frame number. Every frame has its frame number and capture
+ *      time stamped into the top rows as blocks that survive compression, so
+ *      latency can be measured from a decoded stream or recording with
+ *      ReadFrameStamp().
+ *
+ *      Any of the fixed camera slots can be made synthetic, and SYNTHETICCAM_COUNT
+ *      adds that many more on top of them, each streamed and recorded like the
+ *      left drive camera.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class SyntheticCam : public BasicCam
+{
+    public:
+        /////////////////////////////////////////
+        // Declare public methods and member variables.
+        /////////////////////////////////////////
+
+        SyntheticCam(const int nCameraIndex,
+                     const SYNTHETIC_PATTERNS ePattern,
+                     const double dNoiseLevel,
+                     const int nPropResolutionX,
+                     const int nPropResolutionY,
+                     const int nPropFramesPerSecond,
+                     const double dPropHorizontalFOV,
+                     const double dPropVerticalFOV,
+                     const bool bEnableRecordingFlag,
+                     const int nNumFrameRetrievalThreads = 10);
+        ~SyntheticCam();
+        static bool ReadFrameStamp(const cv::Mat& cvFrame, uint64_t& unFrameNumber, std::chrono::system_clock::time_point& tmCaptureTime);
+        static void WriteFrameStamp(cv::Mat& cvFrame, const uint64_t unFrameNumber, const std::chrono::system_clock::time_point& tmCaptureTime);
+
+        /////////////////////////////////////////
+        // Getters.
+        /////////////////////////////////////////
+
+        bool GetCameraIsOpen() override;
+
+    private:
+        /////////////////////////////////////////
+        // Declare private member variables.
+        /////////////////////////////////////////
+
+        uint64_t m_unNoiseSeed;
+        SYNTHETIC_PATTERNS m_ePattern;
+        double m_dNoiseLevel;
+        uint64_t m_unFrameNumber;
+        cv::Mat m_cvColorBars;
+        cv::Mat m_cvNoise;
+
+        /////////////////////////////////////////
+        // Declare private methods.
+        /////////////////////////////////////////
+
+        bool ReadFrame(cv::Mat& cvFrame, std::chrono::system_clock::time_point& tmCaptureTime) override;
+        bool ReopenCapture() override;
+};
+#endif
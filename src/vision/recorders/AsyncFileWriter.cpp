@@ -0,0 +1,512 @@
+/******************************************************************************
+ * @brief Implements the AsyncFileWriter class.
+ *
+ * @file AsyncFileWriter.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "AsyncFileWriter.h"
+#include "../../RoveSoCameraServerLogging.h"
+
+/// \cond
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+extern "C"
+{
+#include <libavformat/avio.h>
+}
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Construct a new Async File Writer:: Async File Writer object.
+ *
+ * @param siBufferSize - The size in bytes of each write buffer. Rounded up to a whole page.
+ * @param siMaxBuffers - The max number of buffers that can be waiting to be written.
+ * @param nFSyncInterval - How often in milliseconds written data is synced to storage. 0 syncs after
+ *                      every buffer and -1 never syncs, leaving it up to the OS.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+AsyncFileWriter::AsyncFileWriter(const size_t siBufferSize, const size_t siMaxBuffers, const int nFSyncInterval)
+{
+    // Initialize member variables.
+    m_siBufferSize        = std::max<size_t>((siBufferSize + 4095) / 4096 * 4096, 4096);
+    m_siMaxBuffers        = std::max<size_t>(siMaxBuffers, 2);
+    m_nFSyncInterval      = nFSyncInterval;
+    m_nFileDescriptor     = -1;
+    m_nFilePosition       = 0;
+    m_nFileSize           = 0;
+    m_nActiveBufferOffset = 0;
+    m_pActiveBuffer       = nullptr;
+    m_bWriteInProgress    = false;
+    m_tmLastFSync         = std::chrono::steady_clock::now();
+    m_bWriteFailed        = false;
+    m_unBytesInFlight     = 0;
+    m_unBytesWritten      = 0;
+    m_unWriteStalls       = 0;
+    m_siNextLatencyIndex  = 0;
+    // Keep the last 512 write times for the latency percentiles.
+    m_vWriteLatencies.reserve(512);
+}
+
+/******************************************************************************
+ * @brief Destroy the Async File Writer:: Async File Writer object. Everything
+ *      handed off is written and the open file is closed first.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+AsyncFileWriter::~AsyncFileWriter()
+{
+    // Close the file and wait for the writer thread to finish with it.
+    this->CloseFile();
+    this->WaitUntilDrained();
+
+    // Signal and wait for writer thread to stop.
+    this->RequestStop();
+    m_cdWriteJobsCondition.notify_all();
+    this->Join();
+}
+
+/******************************************************************************
+ * @brief Open a new file to write to. If a file is already open, it is closed in
+ *      the background once its data is written.
+ *
+ * @param szFilePath - The file to create. It is truncated if it already exists.
+ * @return true - The file was opened.
+ * @return false - The file could not be opened.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool AsyncFileWriter::OpenFile(const std::string& szFilePath)
+{
+    // Close the previous file.
+    this->CloseFile();
+
+    // Open the new file.
+    m_nFileDescriptor = ::open(szFilePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (m_nFileDescriptor < 0)
+    {
+        // Submit logger message.
+        LOG_ERROR(logging::g_qSharedLogger, "AsyncFileWriter: Could not open {}: {}", szFilePath, std::strerror(errno));
+        return false;
+    }
+
+    // Reset file position.
+    m_nFilePosition       = 0;
+    m_nFileSize           = 0;
+    m_nActiveBufferOffset = 0;
+    m_bWriteFailed        = false;
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief Close the current file. Any data still buffered is handed to the writer
+ *      thread, which syncs and closes the file after writing it. This does not wait.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void AsyncFileWriter::CloseFile()
+{
+    // Check if a file is open.
+    if (m_nFileDescriptor < 0)
+    {
+        return;
+    }
+
+    // Hand off the last of the data, then the close.
+    this->SubmitActiveBuffer();
+    std::unique_lock<std::mutex> lkWriteJobsLock(m_muWriteJobsMutex);
+    m_dqWriteJobs.push_back({nullptr, m_nFileDescriptor, 0, true});
+    lkWriteJobsLock.unlock();
+    m_cdWriteJobsCondition.notify_one();
+
+    // The writer thread owns the file now.
+    m_nFileDescriptor = -1;
+}
+
+/******************************************************************************
+ * @brief Wait for the writer thread to finish everything that has been handed off
+ *      to it. Data still in the active buffer is not included, call CloseFile() first.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void AsyncFileWriter::WaitUntilDrained()
+{
+    // Nothing will be written if the thread isn't running.
+    if (this->GetThreadState() != AutonomyThreadState::eRunning)
+    {
+        return;
+    }
+
+    // Wait for the job queue to empty.
+    std::unique_lock<std::mutex> lkWriteJobsLock(m_muWriteJobsMutex);
+    m_cdFreeBufferCondition.wait(lkWriteJobsLock, [this] { return m_dqWriteJobs.empty() && !m_bWriteInProgress; });
+}
+
+/******************************************************************************
+ * @brief Copy data into the write buffers at the current file position. Full
+ *      buffers are handed to the writer thread.
+ *
+ * @param pData - The data to write.
+ * @param nDataSize - The number of bytes to write.
+ * @return int - The number of bytes written, or a negative error code.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+int AsyncFileWriter::Write(const uint8_t* pData, const int nDataSize)
+{
+    // Check if the file can be written to.
+    if (m_nFileDescriptor < 0 || m_bWriteFailed)
+    {
+        return AVERROR(EIO);
+    }
+
+    // Copy the data into the buffers.
+    size_t siRemaining = static_cast<size_t>(nDataSize);
+    while (siRemaining > 0)
+    {
+        // Get a buffer to copy into.
+        if (!m_pActiveBuffer && !this->AcquireActiveBuffer())
+        {
+            return AVERROR(ENOMEM);
+        }
+
+        // Fill as much of the buffer as we can.
+        size_t siCopySize = std::min(siRemaining, m_siBufferSize - m_pActiveBuffer->siSize);
+        std::memcpy(m_pActiveBuffer->pData.get() + m_pActiveBuffer->siSize, pData, siCopySize);
+        m_pActiveBuffer->siSize += siCopySize;
+        pData += siCopySize;
+        siRemaining -= siCopySize;
+        m_nFilePosition += static_cast<int64_t>(siCopySize);
+        m_nFileSize = std::max(m_nFileSize, m_nFilePosition);
+
+        // Check if the buffer is full.
+        if (m_pActiveBuffer->siSize == m_siBufferSize)
+        {
+            this->SubmitActiveBuffer();
+        }
+    }
+
+    return nDataSize;
+}
+
+/******************************************************************************
+ * @brief Move the file position. Data written before the seek is handed off first,
+ *      and because the writer thread writes jobs in order, later writes to the same
+ *      place always win.
+ *
+ * @param nOffset - The offset to seek to.
+ * @param nWhence - SEEK_SET, SEEK_CUR, SEEK_END or AVSEEK_SIZE.
+ * @return int64_t - The new file position, the file size for AVSEEK_SIZE, or a negative error code.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+int64_t AsyncFileWriter::Seek(const int64_t nOffset, const int nWhence)
+{
+    // Check if only the size is wanted.
+    if (nWhence & AVSEEK_SIZE)
+    {
+        return m_nFileSize;
+    }
+
+    // Find the new position.
+    int64_t nNewPosition;
+    switch (nWhence & ~AVSEEK_FORCE)
+    {
+        case SEEK_SET: nNewPosition = nOffset; break;
+        case SEEK_CUR: nNewPosition = m_nFilePosition + nOffset; break;
+        case SEEK_END: nNewPosition = m_nFileSize + nOffset; break;
+        default: return AVERROR(EINVAL);
+    }
+    if (nNewPosition < 0)
+    {
+        return AVERROR(EINVAL);
+    }
+
+    // Check if the position actually changed.
+    if (nNewPosition != m_nFilePosition)
+    {
+        // Hand off what was written at the old position.
+        this->SubmitActiveBuffer();
+        m_nFilePosition       = nNewPosition;
+        m_nActiveBufferOffset = nNewPosition;
+    }
+
+    return m_nFilePosition;
+}
+
+/******************************************************************************
+ * @brief AVIOContext write callback.
+ *
+ * @param pOpaque - The AsyncFileWriter to write to.
+ * @param pBuffer - The data to write.
+ * @param nBufferSize - The number of bytes to write.
+ * @return int - The number of bytes written, or a negative error code.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+int AsyncFileWriter::WritePacket(void* pOpaque, const uint8_t* pBuffer, int nBufferSize)
+{
+    // Forward to the writer.
+    return static_cast<AsyncFileWriter*>(pOpaque)->Write(pBuffer, nBufferSize);
+}
+
+/******************************************************************************
+ * @brief AVIOContext seek callback.
+ *
+ * @param pOpaque - The AsyncFileWriter to seek.
+ * @param nOffset - The offset to seek to.
+ * @param nWhence - SEEK_SET, SEEK_CUR, SEEK_END or AVSEEK_SIZE.
+ * @return int64_t - The new file position, the file size for AVSEEK_SIZE, or a negative error code.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+int64_t AsyncFileWriter::SeekPacket(void* pOpaque, int64_t nOffset, int nWhence)
+{
+    // Forward to the writer.
+    return static_cast<AsyncFileWriter*>(pOpaque)->Seek(nOffset, nWhence);
+}
+
+/******************************************************************************
+ * @brief Accessor for the write statistics. Latency percentiles are over the most
+ *      recent buffer writes.
+ *
+ * @return AsyncFileWriter::WriteStatistics - The current statistics.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+AsyncFileWriter::WriteStatistics AsyncFileWriter::GetStatistics()
+{
+    // Copy the latency samples.
+    std::unique_lock<std::mutex> lkStatisticsLock(m_muStatisticsMutex);
+    std::vector<double> vLatencies = m_vWriteLatencies;
+    lkStatisticsLock.unlock();
+
+    // Calculate percentiles.
+    WriteStatistics stStatistics{};
+    if (!vLatencies.empty())
+    {
+        std::sort(vLatencies.begin(), vLatencies.end());
+        auto GetPercentile = [&vLatencies](const double dPercentile)
+        {
+            // Pick the sample at this percentile.
+            return vLatencies[std::min(vLatencies.size() - 1, static_cast<size_t>(dPercentile * vLatencies.size()))];
+        };
+        stStatistics.dP50LatencyMs = GetPercentile(0.50);
+        stStatistics.dP95LatencyMs = GetPercentile(0.95);
+        stStatistics.dP99LatencyMs = GetPercentile(0.99);
+        stStatistics.dMaxLatencyMs = vLatencies.back();
+    }
+    stStatistics.unBytesInFlight = m_unBytesInFlight;
+    stStatistics.unBytesWritten  = m_unBytesWritten;
+    stStatistics.unWriteStalls   = m_unWriteStalls;
+
+    return stStatistics;
+}
+
+/******************************************************************************
+ * @brief This code will run continuously in a separate thread. The oldest write
+ *      job is written to the file, and the file is synced and closed if needed.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void AsyncFileWriter::ThreadedContinuousCode()
+{
+    // Acquire lock on write jobs queue.
+    std::unique_lock<std::mutex> lkWriteJobsLock(m_muWriteJobsMutex);
+    // Wait for a job. Time out every so often so a stop request is noticed.
+    if (!m_cdWriteJobsCondition.wait_for(lkWriteJobsLock,
+                                         std::chrono::milliseconds(100),
+                                         [this] { return !m_dqWriteJobs.empty() || this->GetThreadState() == AutonomyThreadState::eStopping; }) ||
+        m_dqWriteJobs.empty())
+    {
+        return;
+    }
+
+    // Take the oldest job out of the queue.
+    WriteJob stWriteJob = m_dqWriteJobs.front();
+    m_dqWriteJobs.pop_front();
+    m_bWriteInProgress = true;
+    lkWriteJobsLock.unlock();
+
+    // Check if there is data to write.
+    if (stWriteJob.pBuffer)
+    {
+        // Write the whole buffer. pwrite() can write less than asked or be interrupted, so keep going until it's done.
+        std::chrono::steady_clock::time_point tmStartTime = std::chrono::steady_clock::now();
+        size_t siWritten                                  = 0;
+        while (siWritten < stWriteJob.pBuffer->siSize)
+        {
+            ssize_t nResult = ::pwrite(stWriteJob.nFileDescriptor,
+                                       stWriteJob.pBuffer->pData.get() + siWritten,
+                                       stWriteJob.pBuffer->siSize - siWritten,
+                                       stWriteJob.nFileOffset + static_cast<int64_t>(siWritten));
+            if (nResult < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (nResult <= 0)
+            {
+                // Only report the first failure, the rest of the file is lost anyway.
+                if (!m_bWriteFailed.exchange(true))
+                {
+                    // Submit logger message.
+                    LOG_ERROR(logging::g_qSharedLogger, "AsyncFileWriter: Failed to write to file: {}", std::strerror(errno));
+                }
+                break;
+            }
+            siWritten += static_cast<size_t>(nResult);
+        }
+        double dLatencyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tmStartTime).count();
+
+        // Update statistics.
+        m_unBytesWritten += siWritten;
+        m_unBytesInFlight -= stWriteJob.pBuffer->siSize;
+        std::unique_lock<std::mutex> lkStatisticsLock(m_muStatisticsMutex);
+        if (m_vWriteLatencies.size() < m_vWriteLatencies.capacity())
+        {
+            m_vWriteLatencies.push_back(dLatencyMs);
+        }
+        else
+        {
+            m_vWriteLatencies[m_siNextLatencyIndex] = dLatencyMs;
+        }
+        m_siNextLatencyIndex = (m_siNextLatencyIndex + 1) % m_vWriteLatencies.capacity();
+        lkStatisticsLock.unlock();
+
+        // Check if the data should be synced to storage now.
+        if (m_nFSyncInterval == 0 ||
+            (m_nFSyncInterval > 0 && std::chrono::steady_clock::now() - m_tmLastFSync >= std::chrono::milliseconds(m_nFSyncInterval)))
+        {
+            ::fdatasync(stWriteJob.nFileDescriptor);
+            m_tmLastFSync = std::chrono::steady_clock::now();
+        }
+    }
+
+    // Check if the file should be closed.
+    if (stWriteJob.bCloseFile)
+    {
+        // Make sure the finished file is on storage, unless syncing is turned off.
+        if (m_nFSyncInterval >= 0)
+        {
+            ::fdatasync(stWriteJob.nFileDescriptor);
+        }
+        ::close(stWriteJob.nFileDescriptor);
+    }
+
+    // Return the buffer to the pool.
+    lkWriteJobsLock.lock();
+    if (stWriteJob.pBuffer)
+    {
+        stWriteJob.pBuffer->siSize = 0;
+        m_dqFreeBuffers.push_back(stWriteJob.pBuffer);
+    }
+    m_bWriteInProgress = false;
+    lkWriteJobsLock.unlock();
+    m_cdFreeBufferCondition.notify_all();
+}
+
+/******************************************************************************
+ * @brief This method holds the code that is ran in the thread pool started by
+ *      the ThreadedLinearCode() method. It currently does nothing and is not
+ *      needed in the current implementation of the AsyncFileWriter.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void AsyncFileWriter::PooledLinearCode() {}
+
+/******************************************************************************
+ * @brief Hand the active buffer to the writer thread. Does nothing if it is empty.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void AsyncFileWriter::SubmitActiveBuffer()
+{
+    // Check if there is anything to write.
+    if (!m_pActiveBuffer || m_pActiveBuffer->siSize == 0)
+    {
+        return;
+    }
+
+    // Queue the buffer.
+    m_unBytesInFlight += m_pActiveBuffer->siSize;
+    std::unique_lock<std::mutex> lkWriteJobsLock(m_muWriteJobsMutex);
+    m_dqWriteJobs.push_back({m_pActiveBuffer, m_nFileDescriptor, m_nActiveBufferOffset, false});
+    lkWriteJobsLock.unlock();
+    m_cdWriteJobsCondition.notify_one();
+
+    // The next write starts a new buffer at the current position.
+    m_pActiveBuffer       = nullptr;
+    m_nActiveBufferOffset = m_nFilePosition;
+}
+
+/******************************************************************************
+ * @brief Get an empty buffer to write into. A new buffer is allocated if none are
+ *      free and the pool isn't full yet, otherwise this waits for the writer thread.
+ *
+ * @return true - The active buffer is ready.
+ * @return false - A buffer could not be allocated.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool AsyncFileWriter::AcquireActiveBuffer()
+{
+    // Acquire lock on buffers.
+    std::unique_lock<std::mutex> lkWriteJobsLock(m_muWriteJobsMutex);
+    // Check if a new buffer is needed.
+    if (m_dqFreeBuffers.empty())
+    {
+        // Check if the pool can grow.
+        if (m_vBufferPool.size() < m_siMaxBuffers)
+        {
+            // Allocate a page aligned buffer.
+            std::unique_ptr<WriteBuffer> pBuffer = std::make_unique<WriteBuffer>();
+            pBuffer->pData.reset(static_cast<uint8_t*>(std::aligned_alloc(4096, m_siBufferSize)));
+            if (!pBuffer->pData)
+            {
+                // Submit logger message.
+                LOG_ERROR(logging::g_qSharedLogger, "AsyncFileWriter: Failed to allocate a {} byte write buffer.", m_siBufferSize);
+                return false;
+            }
+            m_dqFreeBuffers.push_back(pBuffer.get());
+            m_vBufferPool.emplace_back(std::move(pBuffer));
+        }
+        else
+        {
+            // Storage has fallen behind by the whole pool, so we have to wait for it.
+            ++m_unWriteStalls;
+            m_cdFreeBufferCondition.wait(lkWriteJobsLock, [this] { return !m_dqFreeBuffers.empty(); });
+        }
+    }
+
+    // Take a free buffer.
+    m_pActiveBuffer = m_dqFreeBuffers.front();
+    m_dqFreeBuffers.pop_front();
+    m_pActiveBuffer->siSize = 0;
+    m_nActiveBufferOffset   = m_nFilePosition;
+
+    return true;
+}
@@ -0,0 +1,148 @@
+/******************************************************************************
+ * @brief Defines the AsyncFileWriter class.
+ *
+ * @file AsyncFileWriter.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ASYNC_FILE_WRITER_H
+#define ASYNC_FILE_WRITER_H
+
+#include "../../interfaces/AutonomyThread.hpp"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The AsyncFileWriter class moves disk writes for a recording off of the
+ *      encoding thread. Writes are copied into large page aligned buffers, and full
+ *      buffers are handed to this class's own thread which writes them with pwrite().
+ *      On eMMC and SD storage a single write can stall for hundreds of milliseconds
+ *      during flash garbage collection, and now only this thread waits on it. Seeks are
+ *      supported, so containers that go back to fill in their header still work.
+ *
+ *      Files are opened on the calling thread, but closing and syncing them happens on
+ *      the writer thread after their last buffer is written. Switching to a new file
+ *      therefore never waits on the old one.
+ *
+ *      The buffer pool grows on demand up to a limit. Only when every buffer is waiting
+ *      to be written does a write block, which means storage has been slower than the
+ *      encoder for a long time.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class AsyncFileWriter : public AutonomyThread<void>
+{
+    public:
+        /////////////////////////////////////////
+        // Define public structs specific to this class.
+        /////////////////////////////////////////
+
+        // Struct used to report how the storage is keeping up.
+        struct WriteStatistics
+        {
+            public:
+                double dP50LatencyMs;      // The median time a single buffer write took.
+                double dP95LatencyMs;      // The 95th percentile time a single buffer write took.
+                double dP99LatencyMs;      // The 99th percentile time a single buffer write took.
+                double dMaxLatencyMs;      // The longest time a single buffer write took.
+                uint64_t unBytesInFlight;  // The number of bytes handed off but not written yet.
+                uint64_t unBytesWritten;   // The total number of bytes written.
+                uint64_t unWriteStalls;    // The number of times a write had to wait for a free buffer.
+        };
+
+        /////////////////////////////////////////
+        // Declare public class methods and variables.
+        /////////////////////////////////////////
+
+        AsyncFileWriter(const size_t siBufferSize, const size_t siMaxBuffers, const int nFSyncInterval);
+        ~AsyncFileWriter();
+        bool OpenFile(const std::string& szFilePath);
+        void CloseFile();
+        void WaitUntilDrained();
+        int Write(const uint8_t* pData, const int nDataSize);
+        int64_t Seek(const int64_t nOffset, const int nWhence);
+
+        // Callbacks for a libavformat AVIOContext. The opaque pointer must be an AsyncFileWriter.
+        static int WritePacket(void* pOpaque, const uint8_t* pBuffer, int nBufferSize);
+        static int64_t SeekPacket(void* pOpaque, int64_t nOffset, int nWhence);
+
+        /////////////////////////////////////////
+        // Accessors.
+        /////////////////////////////////////////
+
+        WriteStatistics GetStatistics();
+
+    private:
+        /////////////////////////////////////////
+        // Declare private methods.
+        /////////////////////////////////////////
+
+        void ThreadedContinuousCode() override;
+        void PooledLinearCode() override;
+        void SubmitActiveBuffer();
+        bool AcquireActiveBuffer();
+
+        /////////////////////////////////////////
+        // Declare private class member variables.
+        /////////////////////////////////////////
+
+        // Struct used to store a page aligned block of memory.
+        struct WriteBuffer
+        {
+            public:
+                std::unique_ptr<uint8_t, decltype(&std::free)> pData{nullptr, &std::free};
+                size_t siSize = 0;
+        };
+
+        // Struct used to store a piece of work for the writer thread.
+        struct WriteJob
+        {
+            public:
+                WriteBuffer* pBuffer;    // The data to write, or nullptr if this job only closes the file.
+                int nFileDescriptor;     // The file to write to.
+                int64_t nFileOffset;     // Where in the file the data goes.
+                bool bCloseFile;         // Whether the file should be synced and closed after this job.
+        };
+
+        size_t m_siBufferSize;
+        size_t m_siMaxBuffers;
+        int m_nFSyncInterval;
+        int m_nFileDescriptor;
+        int64_t m_nFilePosition;
+        int64_t m_nFileSize;
+        int64_t m_nActiveBufferOffset;
+        WriteBuffer* m_pActiveBuffer;
+        std::vector<std::unique_ptr<WriteBuffer>> m_vBufferPool;
+        std::deque<WriteBuffer*> m_dqFreeBuffers;
+        std::deque<WriteJob> m_dqWriteJobs;
+        bool m_bWriteInProgress;
+        std::mutex m_muWriteJobsMutex;
+        std::condition_variable m_cdWriteJobsCondition;
+        std::condition_variable m_cdFreeBufferCondition;
+        std::chrono::steady_clock::time_point m_tmLastFSync;
+        std::atomic<bool> m_bWriteFailed;
+        std::atomic<uint64_t> m_unBytesInFlight;
+        std::atomic<uint64_t> m_unBytesWritten;
+        std::atomic<uint64_t> m_unWriteStalls;
+        std::vector<double> m_vWriteLatencies;
+        size_t m_siNextLatencyIndex;
+        std::mutex m_muStatisticsMutex;
+};
+
+#endif    // ASYNC_FILE_WRITER_H
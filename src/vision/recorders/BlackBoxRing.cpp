@@ -0,0 +1,245 @@
+/******************************************************************************
+ * @brief Implements the BlackBoxRing class.
+ *
+ * @file BlackBoxRing.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "BlackBoxRing.h"
+#include "../../RoveSoCameraServerLogging.h"
+
+/// \cond
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Construct a new Black Box Ring:: Black Box Ring object.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+BlackBoxRing::BlackBoxRing()
+{
+    // Initialize member variables.
+    m_nFileDescriptor = -1;
+    m_pMapping        = nullptr;
+    m_siMappingSize   = 0;
+    m_pHeader         = nullptr;
+    m_pIndex          = nullptr;
+    m_pData           = nullptr;
+}
+
+/******************************************************************************
+ * @brief Destroy the Black Box Ring:: Black Box Ring object.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+BlackBoxRing::~BlackBoxRing()
+{
+    // Unmap and close the file.
+    this->Close();
+}
+
+/******************************************************************************
+ * @brief Create and map a new ring file. If a ring file from a previous run is at
+ *      the same path, it is renamed to end in .prev first so it can still be recovered.
+ *
+ * @param szFilePath - The ring file to create.
+ * @param siDataSize - The size in bytes of the packet data ring.
+ * @param unIndexEntries - The max number of packets the index can hold.
+ * @param pCodecCtx - The open encoder the packets come from.
+ * @return true - The ring file is ready.
+ * @return false - The file could not be created or mapped.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool BlackBoxRing::Open(const std::string& szFilePath, const size_t siDataSize, const uint32_t unIndexEntries, const AVCodecContext* pCodecCtx)
+{
+    // Close any previous file.
+    this->Close();
+
+    // Keep the previous run's ring file, it might be needed after a crash.
+    std::error_code errCode;
+    if (std::filesystem::exists(szFilePath, errCode))
+    {
+        std::filesystem::rename(szFilePath, szFilePath + ".prev", errCode);
+    }
+
+    // Work out the file layout. Each section starts on a page.
+    size_t siIndexSize = (static_cast<size_t>(unIndexEntries) * sizeof(blackbox::IndexEntry) + 4095) / 4096 * 4096;
+    size_t siRingSize  = (siDataSize + 4095) / 4096 * 4096;
+    m_siMappingSize    = blackbox::BLACKBOX_HEADER_SIZE + siIndexSize + siRingSize;
+
+    // Create the file and allocate all of its space now, so writing through the mapping can never run out of disk.
+    m_nFileDescriptor = ::open(szFilePath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (m_nFileDescriptor < 0 || ::posix_fallocate(m_nFileDescriptor, 0, static_cast<off_t>(m_siMappingSize)) != 0)
+    {
+        // Submit logger message.
+        LOG_ERROR(logging::g_qSharedLogger, "BlackBoxRing: Could not create {} bytes for {}: {}", m_siMappingSize, szFilePath, std::strerror(errno));
+        this->Close();
+        return false;
+    }
+
+    // Map the file.
+    void* pMapping = ::mmap(nullptr, m_siMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_nFileDescriptor, 0);
+    if (pMapping == MAP_FAILED)
+    {
+        // Submit logger message.
+        LOG_ERROR(logging::g_qSharedLogger, "BlackBoxRing: Could not map {}: {}", szFilePath, std::strerror(errno));
+        this->Close();
+        return false;
+    }
+    m_pMapping = static_cast<uint8_t*>(pMapping);
+    m_pHeader  = reinterpret_cast<blackbox::FileHeader*>(m_pMapping);
+    m_pIndex   = reinterpret_cast<blackbox::IndexEntry*>(m_pMapping + blackbox::BLACKBOX_HEADER_SIZE);
+    m_pData    = m_pMapping + blackbox::BLACKBOX_HEADER_SIZE + siIndexSize;
+
+    // Fill in the header. The new file is all zeros, so the index starts out empty.
+    m_pHeader->unVersion      = blackbox::BLACKBOX_VERSION;
+    m_pHeader->unIndexEntries = unIndexEntries;
+    m_pHeader->unDataSize     = siRingSize;
+    m_pHeader->nCodecID       = pCodecCtx->codec_id;
+    m_pHeader->nWidth         = pCodecCtx->width;
+    m_pHeader->nHeight        = pCodecCtx->height;
+    m_pHeader->nTimeBaseNum   = pCodecCtx->time_base.num;
+    m_pHeader->nTimeBaseDen   = pCodecCtx->time_base.den;
+    m_pHeader->unNextSequence = 0;
+    m_pHeader->unReservedEnd  = 0;
+    // Check if the codec headers fit.
+    if (pCodecCtx->extradata_size > 0 && static_cast<size_t>(pCodecCtx->extradata_size) <= blackbox::BLACKBOX_MAX_EXTRADATA_SIZE)
+    {
+        std::memcpy(m_pHeader->aExtradata, pCodecCtx->extradata, pCodecCtx->extradata_size);
+        m_pHeader->unExtradataSize = pCodecCtx->extradata_size;
+    }
+    else if (pCodecCtx->extradata_size > 0)
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger, "BlackBoxRing: Codec headers for {} are too big to store. Recovery may not be able to decode it.", szFilePath);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    m_pHeader->unMagic = blackbox::BLACKBOX_MAGIC;
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief Store a packet in the ring, overwriting the oldest packets if needed.
+ *      Only memory writes, no system calls.
+ *
+ * @param pPacket - The encoded packet to store.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void BlackBoxRing::AddPacket(const AVPacket* pPacket)
+{
+    // Check if the ring is open and the packet fits.
+    if (!m_pMapping || pPacket->size <= 0 || static_cast<uint64_t>(pPacket->size) > m_pHeader->unDataSize)
+    {
+        return;
+    }
+
+    // Clear the index entry this packet will use, so it can't be trusted until it's finished.
+    uint64_t unSequence          = m_pHeader->unNextSequence;
+    blackbox::IndexEntry* pEntry = &m_pIndex[unSequence % m_pHeader->unIndexEntries];
+    pEntry->unSequence           = 0;
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // Reserve space for the data. Packets never wrap around the end of the ring, they skip to the start instead.
+    uint64_t unDataPosition = m_pHeader->unReservedEnd;
+    uint64_t unDataOffset   = unDataPosition % m_pHeader->unDataSize;
+    if (unDataOffset + pPacket->size > m_pHeader->unDataSize)
+    {
+        unDataPosition += m_pHeader->unDataSize - unDataOffset;
+        unDataOffset = 0;
+    }
+    m_pHeader->unReservedEnd = unDataPosition + pPacket->size;
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // Write the data and the entry.
+    std::memcpy(m_pData + unDataOffset, pPacket->data, pPacket->size);
+    pEntry->nPTS           = pPacket->pts;
+    pEntry->nDTS           = pPacket->dts;
+    pEntry->nWallTime      = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    pEntry->unDataPosition = unDataPosition;
+    pEntry->unSize         = pPacket->size;
+    pEntry->unFlags        = pPacket->flags;
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // Commit the entry.
+    pEntry->unSequence        = unSequence + 1;
+    m_pHeader->unNextSequence = unSequence + 1;
+}
+
+/******************************************************************************
+ * @brief Ask the kernel to start writing the mapped pages to storage. Doesn't
+ *      wait. Only needed to limit what a power loss can take, a crash of the server
+ *      alone loses nothing.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void BlackBoxRing::Sync()
+{
+    // Check if the ring is open.
+    if (m_pMapping)
+    {
+        ::msync(m_pMapping, m_siMappingSize, MS_ASYNC);
+    }
+}
+
+/******************************************************************************
+ * @brief Unmap and close the ring file. Safe to call if nothing is open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void BlackBoxRing::Close()
+{
+    // Unmap the file.
+    if (m_pMapping)
+    {
+        ::msync(m_pMapping, m_siMappingSize, MS_ASYNC);
+        ::munmap(m_pMapping, m_siMappingSize);
+    }
+    // Close the file.
+    if (m_nFileDescriptor >= 0)
+    {
+        ::close(m_nFileDescriptor);
+    }
+
+    // Reset member variables.
+    m_nFileDescriptor = -1;
+    m_pMapping        = nullptr;
+    m_pHeader         = nullptr;
+    m_pIndex          = nullptr;
+    m_pData           = nullptr;
+}
+
+/******************************************************************************
+ * @brief Accessor for the open status of the ring file.
+ *
+ * @return true - Packets are being stored.
+ * @return false - The ring file isn't open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool BlackBoxRing::GetIsOpen() const
+{
+    // Return whether the file is mapped.
+    return m_pMapping != nullptr;
+}
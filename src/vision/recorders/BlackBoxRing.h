@@ -0,0 +1,128 @@
+/******************************************************************************
+ * @brief Defines the BlackBoxRing class and the layout of black box ring files.
+ *
+ * @file BlackBoxRing.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef BLACK_BOX_RING_H
+#define BLACK_BOX_RING_H
+
+/// \cond
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+}
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Namespace containing the on-disk layout of a black box ring file. The
+ *      file is a header page, then an index of packet entries, then a ring of packet
+ *      data. The recovery tool reads files with these same structs.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+namespace blackbox
+{
+    // Identifies a black box ring file. "RSBLKBOX".
+    constexpr uint64_t BLACKBOX_MAGIC   = 0x584F424B4C425352;
+    constexpr uint32_t BLACKBOX_VERSION = 1;
+    // The size of the file header, one page.
+    constexpr size_t BLACKBOX_HEADER_SIZE = 4096;
+    // The max size of the codec headers stored in the file header.
+    constexpr size_t BLACKBOX_MAX_EXTRADATA_SIZE = 3072;
+
+    // Struct stored at the start of the file.
+    struct FileHeader
+    {
+        public:
+            uint64_t unMagic;                                   // Always BLACKBOX_MAGIC.
+            uint32_t unVersion;                                 // Always BLACKBOX_VERSION.
+            uint32_t unIndexEntries;                            // The number of entries in the index.
+            uint64_t unDataSize;                                // The size in bytes of the packet data ring.
+            int32_t nCodecID;                                   // The AVCodecID of the packets.
+            int32_t nWidth;                                     // The width of the encoded frames.
+            int32_t nHeight;                                    // The height of the encoded frames.
+            int32_t nTimeBaseNum;                               // The numerator of the packet time base.
+            int32_t nTimeBaseDen;                               // The denominator of the packet time base.
+            uint32_t unExtradataSize;                           // The number of bytes of codec headers.
+            uint8_t aExtradata[BLACKBOX_MAX_EXTRADATA_SIZE];    // The codec headers. Ex: SPS and PPS.
+            volatile uint64_t unNextSequence;                   // The sequence number the next packet will get.
+            volatile uint64_t unReservedEnd;                    // The absolute data position written up to, including a packet being written.
+    };
+    static_assert(sizeof(FileHeader) <= BLACKBOX_HEADER_SIZE, "The black box file header must fit in one page.");
+
+    // Struct stored in the index for each packet.
+    struct IndexEntry
+    {
+        public:
+            volatile uint64_t unSequence;    // The packet sequence number plus one. 0 means empty or being written.
+            int64_t nPTS;                    // The packet presentation timestamp in the file time base.
+            int64_t nDTS;                    // The packet decode timestamp in the file time base.
+            int64_t nWallTime;               // When the packet was stored, in microseconds since the epoch.
+            uint64_t unDataPosition;         // The absolute position of the packet data. The offset in the ring is this modulo the data size.
+            uint32_t unSize;                 // The number of bytes of packet data.
+            uint32_t unFlags;                // The AVPacket flags. Ex: AV_PKT_FLAG_KEY.
+    };
+}    // namespace blackbox
+
+/******************************************************************************
+ * @brief The BlackBoxRing class keeps the most recent encoded packets of a
+ *      recording in a fixed size, memory mapped file. The file is allocated up front,
+ *      and packets are stored with plain memory writes, so there are no system calls
+ *      on the hot path. If the server crashes, the kernel still has the mapped pages
+ *      and writes them out. Sync() can be called every so often to limit what a power
+ *      loss can take. The last seconds of video can be recovered from the file offline
+ *      with the --recover-blackbox mode of the server.
+ *
+ *      Packets are committed so that a crash in the middle of a write never leaves a
+ *      valid looking entry pointing at torn data. The entry is cleared, the data space
+ *      is reserved in the header, the data and entry are written, and only then is the
+ *      entry's sequence number set.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class BlackBoxRing
+{
+    public:
+        /////////////////////////////////////////
+        // Declare public class methods and variables.
+        /////////////////////////////////////////
+
+        BlackBoxRing();
+        ~BlackBoxRing();
+        bool Open(const std::string& szFilePath, const size_t siDataSize, const uint32_t unIndexEntries, const AVCodecContext* pCodecCtx);
+        void AddPacket(const AVPacket* pPacket);
+        void Sync();
+        void Close();
+
+        /////////////////////////////////////////
+        // Accessors.
+        /////////////////////////////////////////
+
+        bool GetIsOpen() const;
+
+    private:
+        /////////////////////////////////////////
+        // Declare private class member variables.
+        /////////////////////////////////////////
+
+        int m_nFileDescriptor;
+        uint8_t* m_pMapping;
+        size_t m_siMappingSize;
+        blackbox::FileHeader* m_pHeader;
+        blackbox::IndexEntry* m_pIndex;
+        uint8_t* m_pData;
+};
+
+#endif    // BLACK_BOX_RING_H
@@ -0,0 +1,497 @@
+/******************************************************************************
+ * @brief Implements the CameraRecorder class.
+ *
+ * @file CameraRecorder.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "CameraRecorder.h"
+#include "../../RoveSoCameraServerConstants.h"
+#include "../../RoveSoCameraServerLogging.h"
+
+/// \cond
+#include <algorithm>
+#include <filesystem>
+#include <time.h>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Construct a new Camera Recorder:: Camera Recorder object.
+ *
+ * @param pCamera - The camera to record.
+ * @param szOutputPath - The file to record to.
+ * @param stEncoderSettings - The encoder settings to record this camera with.
+ * @param nSegmentDuration - The length in seconds of each recording segment. 0 disables it.
+ * @param nSegmentMaxSize - The max size in megabytes of each recording segment. 0 disables it.
+ * @param nMaxQueuedFrames - The max number of frames waiting to be written before new ones are dropped.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+CameraRecorder::CameraRecorder(BasicCam* pCamera,
+                               const std::string& szOutputPath,
+                               const FFmpegRecordingMuxer::EncoderSettings& stEncoderSettings,
+                               const int nSegmentDuration,
+                               const int nSegmentMaxSize,
+                               const int nMaxQueuedFrames)
+{
+    // Initialize member variables.
+    m_pCamera             = pCamera;
+    m_szOutputPath        = szOutputPath;
+    m_siMaxQueuedFrames   = std::max(nMaxQueuedFrames, 1);
+    m_unDroppedFrames     = 0;
+    m_unDuplicateFrames   = 0;
+    m_nEncodeCPUTime      = 0;
+    m_unLastFrameSequence = 0;
+    m_bCameraOffline      = false;
+    m_pGroupMuxer         = nullptr;
+    m_nGroupTrack         = -1;
+
+    // Move disk writes off of the encoding thread if enabled.
+    if (constants::RECORDER_ENABLE_ASYNC_WRITER)
+    {
+        m_FFmpegMuxer.EnableAsyncWriter(constants::RECORDER_WRITE_BUFFER_SIZE, constants::RECORDER_WRITE_BUFFER_COUNT, constants::RECORDER_FSYNC_INTERVAL);
+    }
+
+    // Keep recent packets in memory for instant replay if enabled.
+    if (constants::RECORDER_ENABLE_REPLAY_BUFFER)
+    {
+        m_FFmpegMuxer.EnableReplayBuffer(constants::RECORDER_REPLAY_HISTORY,
+                                         static_cast<size_t>(constants::RECORDER_REPLAY_MAX_SIZE) * 1024 * 1024,
+                                         constants::RECORDER_CONTINUOUS_RECORDING);
+    }
+
+    // Keep the most recent packets in a ring file that survives a crash if enabled. The path doesn't change between runs, so
+    // the ring from a crashed run is kept as .prev when the server starts again.
+    if (constants::RECORDER_ENABLE_BLACKBOX)
+    {
+        // Assemble the ring file path.
+        std::filesystem::path szRingPath = constants::LOGGING_OUTPUT_PATH_ABSOLUTE;
+        szRingPath /= "blackbox";
+        std::string szRingName = m_pCamera->GetCameraLocation();
+        std::replace(szRingName.begin(), szRingName.end(), '/', '_');
+
+        // Check if directory exists.
+        std::error_code errCode;
+        std::filesystem::create_directories(szRingPath, errCode);
+        m_FFmpegMuxer.EnableBlackBox((szRingPath / (szRingName + ".ring")).string(),
+                                     static_cast<size_t>(constants::RECORDER_BLACKBOX_SIZE) * 1024 * 1024,
+                                     constants::RECORDER_BLACKBOX_INDEX_ENTRIES,
+                                     constants::RECORDER_BLACKBOX_SYNC_INTERVAL);
+    }
+
+    // Write a frame index next to each recording file if enabled.
+    if (constants::RECORDER_ENABLE_FRAME_INDEX)
+    {
+        m_FFmpegMuxer.EnableFrameIndex();
+    }
+
+    // Open writer.
+    if (!m_FFmpegMuxer.Open(m_szOutputPath, m_pCamera->GetPropResolution(), stEncoderSettings, nSegmentDuration, nSegmentMaxSize))
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger, "CameraRecorder: Failed to open recording muxer for basic camera at path/index {}", m_pCamera->GetCameraLocation());
+    }
+}
+
+/******************************************************************************
+ * @brief Construct a new Camera Recorder:: Camera Recorder object that records to
+ *      one track of a group recording instead of its own file.
+ *
+ * @param pCamera - The camera to record.
+ * @param pGroupMuxer - The open group recording to write to. Must outlive this recorder.
+ * @param nGroupTrack - The track of the group recording this camera is written to.
+ * @param nMaxQueuedFrames - The max number of frames waiting to be written before new ones are dropped.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+CameraRecorder::CameraRecorder(BasicCam* pCamera, FFmpegGroupRecordingMuxer* pGroupMuxer, const int nGroupTrack, const int nMaxQueuedFrames)
+{
+    // Initialize member variables.
+    m_pCamera             = pCamera;
+    m_szOutputPath        = pGroupMuxer->GetOutputPath();
+    m_siMaxQueuedFrames   = std::max(nMaxQueuedFrames, 1);
+    m_unDroppedFrames     = 0;
+    m_unDuplicateFrames   = 0;
+    m_nEncodeCPUTime      = 0;
+    m_unLastFrameSequence = 0;
+    m_bCameraOffline      = false;
+    m_pGroupMuxer         = pGroupMuxer;
+    m_nGroupTrack         = nGroupTrack;
+}
+
+/******************************************************************************
+ * @brief Destroy the Camera Recorder:: Camera Recorder object.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+CameraRecorder::~CameraRecorder()
+{
+    // Signal and wait for recording thread to stop.
+    this->RequestStop();
+    m_cdFrameJobsCondition.notify_all();
+    this->Join();
+
+    // Any frames still queued are waiting on the camera's copy queue. A running camera fills them shortly and a stopped one has
+    // already failed them, so wait for that and write the ones that were copied.
+    std::chrono::steady_clock::time_point tmCopyDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(constants::RECORDER_STOP_COPY_TIMEOUT);
+    std::lock_guard<std::mutex> lkFrameJobsLock(m_muFrameJobsMutex);
+    for (FrameJob& stFrameJob : m_dqFrameJobs)
+    {
+        // Check if the copy finished in time.
+        if (stFrameJob.fuCopyStatus.wait_until(tmCopyDeadline) != std::future_status::ready)
+        {
+            // Submit logger message.
+            LOG_WARNING(logging::g_qSharedLogger, "CameraRecorder: Camera {} never finished a frame copy! Dropping the frame.", m_pCamera->GetCameraLocation());
+            // The camera's copy shares the frame, so it's freed once the camera is done with it.
+            continue;
+        }
+
+        // Check if the frame was copied.
+        if (stFrameJob.fuCopyStatus.get())
+        {
+            // Write frame.
+            this->WriteFrameJob(stFrameJob);
+        }
+    }
+    m_dqFrameJobs.clear();
+
+    // Flush the encoder and finish the file.
+    m_FFmpegMuxer.Close();
+}
+
+/******************************************************************************
+ * @brief Requests a frame copy from the camera and queues it to be written by this
+ *      recorder's thread. This never waits on the camera or the encoder, so it is safe
+ *      to call from a loop that schedules many recorders.
+ *
+ * @return true - The frame was scheduled.
+ * @return false - The writer isn't open or the queue is full, so the frame was dropped.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool CameraRecorder::ScheduleFrame()
+{
+    // Check if the writer is open.
+    if (!this->GetWriterIsOpen())
+    {
+        return false;
+    }
+
+    // Acquire lock on frame jobs queue.
+    std::unique_lock<std::mutex> lkFrameJobsLock(m_muFrameJobsMutex);
+    // Check if the queue is full.
+    if (m_dqFrameJobs.size() >= m_siMaxQueuedFrames)
+    {
+        // Drop this frame.
+        ++m_unDroppedFrames;
+        return false;
+    }
+
+    // Request a YUV 4:2:0 frame at the camera resolution so the encoder can use it as is. The camera shares this conversion with any
+    // other consumer asking for the same format and size. The metadata gives the real capture time for the frame timestamp. The copy
+    // callback holds the frame and metadata, so the camera's copy keeps them alive even if this recorder is gone before it runs.
+    FrameJob stFrameJob;
+    stFrameJob.pFrame         = std::make_shared<cv::Mat>();
+    stFrameJob.pFrameMetadata = std::make_shared<containers::FrameMetadata>();
+    stFrameJob.fuCopyStatus   = m_pCamera->RequestFrameCopy(*stFrameJob.pFrame,
+                                                          PIXEL_FORMATS::eYUV420,
+                                                          m_pCamera->GetPropResolution(),
+                                                          cv::Rect2d(),
+                                                          stFrameJob.pFrameMetadata.get(),
+                                                          [pFrame = stFrameJob.pFrame, pFrameMetadata = stFrameJob.pFrameMetadata]() {});
+    // Queue the frame.
+    m_dqFrameJobs.emplace_back(std::move(stFrameJob));
+    lkFrameJobsLock.unlock();
+
+    // Wake up recorder thread.
+    m_cdFrameJobsCondition.notify_one();
+    return true;
+}
+
+/******************************************************************************
+ * @brief This code will run continuously in a separate thread. The oldest queued
+ *      frame is waited on and written to the filesystem.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void CameraRecorder::ThreadedContinuousCode()
+{
+    // Acquire lock on frame jobs queue.
+    std::unique_lock<std::mutex> lkFrameJobsLock(m_muFrameJobsMutex);
+    // Wait for a frame to be scheduled. Time out every so often so a stop request is noticed.
+    if (!m_cdFrameJobsCondition.wait_for(lkFrameJobsLock,
+                                         std::chrono::milliseconds(100),
+                                         [this] { return !m_dqFrameJobs.empty() || this->GetThreadState() == AutonomyThreadState::eStopping; }) ||
+        m_dqFrameJobs.empty())
+    {
+        return;
+    }
+
+    // Get the oldest frame in the queue.
+    FrameJob& stOldestFrameJob = m_dqFrameJobs.front();
+    lkFrameJobsLock.unlock();
+
+    // Wait for the camera to copy the frame. Newer frames keep being requested meanwhile. Time out every so often so a stop
+    // request is noticed. The frame stays queued until then, since the camera still has a pointer to it.
+    if (stOldestFrameJob.fuCopyStatus.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready)
+    {
+        return;
+    }
+
+    // Take the frame out of the queue. It stays owned by this thread until it is written.
+    lkFrameJobsLock.lock();
+    FrameJob stFrameJob = std::move(m_dqFrameJobs.front());
+    m_dqFrameJobs.pop_front();
+    lkFrameJobsLock.unlock();
+
+    // Encode the frame if it was copied.
+    if (stFrameJob.fuCopyStatus.get())
+    {
+        this->WriteFrameJob(stFrameJob);
+    }
+}
+
+/******************************************************************************
+ * @brief Encode a copied frame, stamped with the time it was captured. If the camera
+ *      hasn't read a new frame since the last one written, the copy is a duplicate and
+ *      is skipped instead. This happens when frames are scheduled faster than the camera
+ *      delivers them, or the scheduling loop runs late and catches up. Since every frame
+ *      keeps its own capture time, skipping it leaves a longer gap in the timestamps
+ *      rather than time running fast or slow, so playback matches the real time.
+ *
+ * @param stFrameJob - The frame job whose copy has finished.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void CameraRecorder::WriteFrameJob(const FrameJob& stFrameJob)
+{
+    // Check if the copy has a frame in it.
+    if (stFrameJob.pFrame->empty())
+    {
+        return;
+    }
+
+    // Check if the camera is disconnected. Its frames are black filler, so nothing is encoded until it's back.
+    if (!stFrameJob.pFrameMetadata->bCameraIsOnline)
+    {
+        m_bCameraOffline = true;
+        return;
+    }
+    // Check if the camera just came back. The muxer restarts with a keyframe after the gap.
+    if (m_bCameraOffline.exchange(false))
+    {
+        if (m_pGroupMuxer)
+        {
+            m_pGroupMuxer->MarkDiscontinuity(m_nGroupTrack);
+        }
+        else
+        {
+            m_FFmpegMuxer.MarkDiscontinuity();
+        }
+    }
+
+    // Check if this is the same camera frame as the last one written.
+    uint64_t unFrameSequence = stFrameJob.pFrameMetadata->unFrameSequence;
+    if (unFrameSequence != 0 && unFrameSequence <= m_unLastFrameSequence)
+    {
+        ++m_unDuplicateFrames;
+        return;
+    }
+    m_unLastFrameSequence = unFrameSequence;
+
+    // Get the CPU time used by this thread before encoding.
+    timespec stStartTime;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &stStartTime);
+
+    // Encode the frame, stamped with the time it was captured.
+    if (m_pGroupMuxer)
+    {
+        m_pGroupMuxer->WriteFrame(m_nGroupTrack, *stFrameJob.pFrame, PIXEL_FORMATS::eYUV420, stFrameJob.pFrameMetadata->tmCaptureTime);
+    }
+    else
+    {
+        m_FFmpegMuxer.WriteFrame(*stFrameJob.pFrame, PIXEL_FORMATS::eYUV420, stFrameJob.pFrameMetadata->tmCaptureTime);
+    }
+
+    // Add the CPU time spent encoding.
+    timespec stEndTime;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &stEndTime);
+    m_nEncodeCPUTime += static_cast<int64_t>(stEndTime.tv_sec - stStartTime.tv_sec) * 1000000000 + (stEndTime.tv_nsec - stStartTime.tv_nsec);
+}
+
+/******************************************************************************
+ * @brief This method holds the code that is ran in the thread pool started by
+ *      the ThreadedLinearCode() method. It currently does nothing and is not
+ *      needed in the current implementation of the CameraRecorder.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void CameraRecorder::PooledLinearCode() {}
+
+/******************************************************************************
+ * @brief Tell the recorder its camera has gone offline. Nothing is recorded for
+ *      the outage, and recording picks back up with a keyframe once the camera
+ *      delivers real frames again.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void CameraRecorder::SetCameraOffline()
+{
+    // Update member variable.
+    m_bCameraOffline = true;
+}
+
+/******************************************************************************
+ * @brief Accessor for the writer open status.
+ *
+ * @return true - The writer is open and frames can be scheduled.
+ * @return false - The writer failed to open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool CameraRecorder::GetWriterIsOpen() const
+{
+    // Return writer status.
+    return m_pGroupMuxer ? m_pGroupMuxer->GetIsOpen() : m_FFmpegMuxer.GetIsOpen();
+}
+
+/******************************************************************************
+ * @brief Accessor for the recording file currently being written. Retention uses
+ *      this to make sure it never deletes a file that is still open.
+ *
+ * @return std::string - The path of the current segment, or an empty string if none is open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+std::string CameraRecorder::GetCurrentSegmentPath()
+{
+    // Return the muxer's current file.
+    return m_pGroupMuxer ? m_pGroupMuxer->GetOutputPath() : m_FFmpegMuxer.GetCurrentSegmentPath();
+}
+
+/******************************************************************************
+ * @brief Accessor for the disk write statistics of this recording.
+ *
+ * @return AsyncFileWriter::WriteStatistics - The write latency and throughput statistics.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+AsyncFileWriter::WriteStatistics CameraRecorder::GetWriteStatistics()
+{
+    // Return the muxer's write statistics. Recorders in a group share them.
+    return m_pGroupMuxer ? m_pGroupMuxer->GetWriteStatistics() : m_FFmpegMuxer.GetWriteStatistics();
+}
+
+/******************************************************************************
+ * @brief Save the instant replay history of this camera, plus what is recorded over
+ *      the next while, to a file. This is written in the background.
+ *
+ * @param szOutputPath - The file to save the event to.
+ * @param nPostEventSeconds - How many seconds after the trigger to keep saving.
+ * @return true - The event was started or extended.
+ * @return false - The replay buffer isn't enabled or has nothing in it yet.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool CameraRecorder::TriggerReplay(const std::string& szOutputPath, const int nPostEventSeconds)
+{
+    // Check if the replay buffer is enabled.
+    ReplayBuffer* pReplayBuffer = m_FFmpegMuxer.GetReplayBuffer();
+    if (!pReplayBuffer)
+    {
+        return false;
+    }
+
+    // Start saving the event.
+    return pReplayBuffer->Trigger(szOutputPath, nPostEventSeconds);
+}
+
+/******************************************************************************
+ * @brief Accessor for the memory used by the instant replay buffer.
+ *
+ * @return size_t - The number of bytes of packets held, or 0 if the replay buffer isn't enabled.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+size_t CameraRecorder::GetReplayMemoryUsage()
+{
+    // Check if the replay buffer is enabled.
+    ReplayBuffer* pReplayBuffer = m_FFmpegMuxer.GetReplayBuffer();
+    return pReplayBuffer ? pReplayBuffer->GetMemoryUsage() : 0;
+}
+
+/******************************************************************************
+ * @brief Accessor for how much time the instant replay buffer covers.
+ *
+ * @return double - The number of seconds held, or 0 if the replay buffer isn't enabled.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+double CameraRecorder::GetReplayBufferedSeconds()
+{
+    // Check if the replay buffer is enabled.
+    ReplayBuffer* pReplayBuffer = m_FFmpegMuxer.GetReplayBuffer();
+    return pReplayBuffer ? pReplayBuffer->GetBufferedSeconds() : 0.0;
+}
+
+/******************************************************************************
+ * @brief Accessor for the number of frames dropped because this recorder fell behind.
+ *
+ * @return uint64_t - The number of dropped frames.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+uint64_t CameraRecorder::GetDroppedFrames() const
+{
+    // Return member variable value.
+    return m_unDroppedFrames;
+}
+
+/******************************************************************************
+ * @brief Accessor for the number of frames skipped because the camera hadn't read a
+ *      new frame since the last one written.
+ *
+ * @return uint64_t - The number of duplicate frames.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+uint64_t CameraRecorder::GetDuplicateFrames() const
+{
+    // Return member variable value.
+    return m_unDuplicateFrames;
+}
+
+/******************************************************************************
+ * @brief Accessor for the total CPU time this recorder's thread has spent encoding
+ *      frames. Encoder worker threads are not included.
+ *
+ * @return std::chrono::nanoseconds - The CPU time spent encoding.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+std::chrono::nanoseconds CameraRecorder::GetEncodeCPUTime() const
+{
+    // Return member variable value.
+    return std::chrono::nanoseconds(m_nEncodeCPUTime.load());
+}
@@ -0,0 +1,123 @@
+/******************************************************************************
+ * @brief Defines the CameraRecorder class.
+ *
+ * @file CameraRecorder.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef CAMERA_RECORDER_H
+#define CAMERA_RECORDER_H
+
+#include "../cameras/BasicCam.h"
+#include "FFmpegGroupRecordingMuxer.h"
+#include "FFmpegRecordingMuxer.h"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <opencv2/opencv.hpp>
+#include <string>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The CameraRecorder class records a single camera to the filesystem in its
+ *      own thread. Frames are scheduled by the RecordingHandler, which only requests
+ *      a frame copy from the camera and queues it here. This thread then waits for the
+ *      copy and encodes it. Since scheduling and encoding happen in different threads,
+ *      the next frame is already being copied while the current one is encoded, and a
+ *      slow camera or encoder only holds up its own recording. The queue is bounded, so
+ *      a recorder that falls behind drops frames instead of using more and more memory.
+ *      Frames the camera already delivered once are skipped, so each camera frame is
+ *      recorded at most once, with the time it was captured. While the camera is
+ *      disconnected nothing is encoded, and recording resumes with a keyframe.
+ *
+ *      A recorder can also write to one track of an FFmpegGroupRecordingMuxer instead of
+ *      its own file. It still encodes in its own thread, the group muxer only puts the
+ *      tracks together.
+ *
+ *      The CPU time this thread spends encoding is counted so the cost of recording each
+ *      camera shows up in the write statistics. Encoder worker threads started by libav
+ *      when the thread count is above 1 are not included.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class CameraRecorder : public AutonomyThread<void>
+{
+    public:
+        /////////////////////////////////////////
+        // Declare public class methods and variables.
+        /////////////////////////////////////////
+
+        CameraRecorder(BasicCam* pCamera,
+                       const std::string& szOutputPath,
+                       const FFmpegRecordingMuxer::EncoderSettings& stEncoderSettings,
+                       const int nSegmentDuration,
+                       const int nSegmentMaxSize,
+                       const int nMaxQueuedFrames);
+        CameraRecorder(BasicCam* pCamera, FFmpegGroupRecordingMuxer* pGroupMuxer, const int nGroupTrack, const int nMaxQueuedFrames);
+        ~CameraRecorder();
+        bool ScheduleFrame();
+        bool TriggerReplay(const std::string& szOutputPath, const int nPostEventSeconds);
+        void SetCameraOffline();
+
+        /////////////////////////////////////////
+        // Accessors.
+        /////////////////////////////////////////
+
+        bool GetWriterIsOpen() const;
+        std::string GetCurrentSegmentPath();
+        AsyncFileWriter::WriteStatistics GetWriteStatistics();
+        size_t GetReplayMemoryUsage();
+        double GetReplayBufferedSeconds();
+        uint64_t GetDroppedFrames() const;
+        uint64_t GetDuplicateFrames() const;
+        std::chrono::nanoseconds GetEncodeCPUTime() const;
+
+    private:
+        /////////////////////////////////////////
+        // Declare private methods.
+        /////////////////////////////////////////
+
+        void ThreadedContinuousCode() override;
+        void PooledLinearCode() override;
+
+        /////////////////////////////////////////
+        // Declare private class member variables.
+        /////////////////////////////////////////
+
+        // Struct used to store a frame that has been requested from the camera and is waiting to be written.
+        struct FrameJob
+        {
+            public:
+                std::shared_ptr<cv::Mat> pFrame;
+                std::shared_ptr<containers::FrameMetadata> pFrameMetadata;
+                std::future<bool> fuCopyStatus;
+        };
+
+        void WriteFrameJob(const FrameJob& stFrameJob);
+
+        BasicCam* m_pCamera;
+        std::string m_szOutputPath;
+        FFmpegRecordingMuxer m_FFmpegMuxer;
+        FFmpegGroupRecordingMuxer* m_pGroupMuxer;
+        int m_nGroupTrack;
+        size_t m_siMaxQueuedFrames;
+        std::deque<FrameJob> m_dqFrameJobs;
+        std::mutex m_muFrameJobsMutex;
+        std::condition_variable m_cdFrameJobsCondition;
+        std::atomic<uint64_t> m_unDroppedFrames;
+        std::atomic<uint64_t> m_unDuplicateFrames;
+        std::atomic<int64_t> m_nEncodeCPUTime;
+        uint64_t m_unLastFrameSequence;
+        std::atomic<bool> m_bCameraOffline;
+};
+#endif
@@ -0,0 +1,443 @@
+/******************************************************************************
+ * @brief Implements the FFmpegGroupRecordingMuxer class.
+ *
+ * @file FFmpegGroupRecordingMuxer.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "FFmpegGroupRecordingMuxer.h"
+#include "../../RoveSoCameraServerLogging.h"
+
+/// \cond
+extern "C"
+{
+#include <libavutil/dict.h>
+}
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Construct a new FFmpegGroupRecordingMuxer::FFmpegGroupRecordingMuxer object.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+FFmpegGroupRecordingMuxer::FFmpegGroupRecordingMuxer()
+{
+    // Initialize member variables.
+    m_bIsOpen         = false;
+    m_bHeaderWritten  = false;
+    m_nStartTimestamp = AV_NOPTS_VALUE;
+    m_pFormatCtx      = nullptr;
+    m_pFileWriter     = nullptr;
+}
+
+/******************************************************************************
+ * @brief Destroy the FFmpegGroupRecordingMuxer::FFmpegGroupRecordingMuxer object.
+ *        Finishes the file if it is still open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+FFmpegGroupRecordingMuxer::~FFmpegGroupRecordingMuxer()
+{
+    // Flush the encoders, write the trailer and clean up.
+    this->Close();
+
+    // Delete the file writer. This waits for the file to reach storage.
+    delete m_pFileWriter;
+    m_pFileWriter = nullptr;
+}
+
+/******************************************************************************
+ * @brief Write the file through an AsyncFileWriter instead of blocking writes on
+ *        the encoding threads. Must be called before Open().
+ *
+ * @param siBufferSize - The size in bytes of each write buffer.
+ * @param siMaxBuffers - The max number of buffers that can be waiting to be written.
+ * @param nFSyncInterval - How often in milliseconds written data is synced to storage. 0 syncs after
+ *                      every buffer and -1 never syncs, leaving it up to the OS.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegGroupRecordingMuxer::EnableAsyncWriter(const size_t siBufferSize, const size_t siMaxBuffers, const int nFSyncInterval)
+{
+    // Check if a recording is open.
+    if (m_bIsOpen)
+    {
+        LOG_WARNING(logging::g_qSharedLogger, "FFmpegGroupRecordingMuxer: Can't enable the async writer while {} is open.", m_szOutputPath);
+        return;
+    }
+
+    // Create and start the file writer.
+    delete m_pFileWriter;
+    m_pFileWriter = new AsyncFileWriter(siBufferSize, siMaxBuffers, nFSyncInterval);
+    m_pFileWriter->Start();
+}
+
+/******************************************************************************
+ * @brief Set up an encoder for each track and open the file. The timeline of every
+ *        track starts now, so frames captured before this are not written.
+ *
+ * @param szOutputPath - The file to write. The container must support more than one video track. Ex: .mkv
+ * @param vTrackSettings - The settings of each track. The index in this vector is the track number.
+ * @return true - The file is open and frames can be written.
+ * @return false - Something failed, check the log.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool FFmpegGroupRecordingMuxer::Open(const std::string& szOutputPath, const std::vector<TrackSettings>& vTrackSettings)
+{
+    // Close any previous recording.
+    this->Close();
+
+    // Check if there is anything to record.
+    if (vTrackSettings.empty())
+    {
+        return false;
+    }
+
+    // Allocate the output context.
+    avformat_alloc_output_context2(&m_pFormatCtx, nullptr, nullptr, szOutputPath.c_str());
+    if (!m_pFormatCtx)
+    {
+        LOG_ERROR(logging::g_qSharedLogger, "FFmpegGroupRecordingMuxer: Could not allocate output context for {}.", szOutputPath);
+        return false;
+    }
+    // Don't hold packets back for long waiting on a track that has nothing to write, like a disconnected camera.
+    m_pFormatCtx->max_interleave_delta = 1000000;
+    {
+        // Acquire lock on output path.
+        std::lock_guard<std::mutex> lkOutputPathLock(m_muOutputPathMutex);
+        m_szOutputPath = szOutputPath;
+    }
+
+    // Create an encoder and a stream for each track.
+    for (const TrackSettings& stTrackSettings : vTrackSettings)
+    {
+        std::unique_ptr<Track> pTrack = std::make_unique<Track>();
+        pTrack->szName                = stTrackSettings.szName;
+        pTrack->cvFrameSize           = stTrackSettings.cvFrameSize;
+        pTrack->nLastTimestamp        = AV_NOPTS_VALUE;
+        pTrack->bDiscontinuity        = false;
+        pTrack->pPacket               = av_packet_alloc();
+        // Create the encoder and its stream. The codec headers from the encoder are copied in.
+        pTrack->pCodecCtx = FFmpegRecordingMuxer::CreateEncoder(stTrackSettings.cvFrameSize, stTrackSettings.stEncoderSettings, m_pFormatCtx->oformat->flags & AVFMT_GLOBALHEADER);
+        pTrack->pStream   = pTrack->pCodecCtx ? avformat_new_stream(m_pFormatCtx, nullptr) : nullptr;
+        // Check if the track was set up.
+        if (!pTrack->pStream || avcodec_parameters_from_context(pTrack->pStream->codecpar, pTrack->pCodecCtx) < 0)
+        {
+            LOG_ERROR(logging::g_qSharedLogger, "FFmpegGroupRecordingMuxer: Could not set up track {} of {}.", stTrackSettings.szName, szOutputPath);
+            avcodec_free_context(&pTrack->pCodecCtx);
+            av_packet_free(&pTrack->pPacket);
+            this->Close();
+            return false;
+        }
+        pTrack->pStream->time_base = pTrack->pCodecCtx->time_base;
+        av_dict_set(&pTrack->pStream->metadata, "title", stTrackSettings.szName.c_str(), 0);
+        m_vTracks.emplace_back(std::move(pTrack));
+    }
+
+    // Open the output file. With the async writer, libavformat writes into a custom IO context that hands data to the writer thread.
+    if (m_pFileWriter)
+    {
+        if (!m_pFileWriter->OpenFile(szOutputPath))
+        {
+            this->Close();
+            return false;
+        }
+        unsigned char* pIOBuffer = static_cast<unsigned char*>(av_malloc(65536));
+        m_pFormatCtx->pb         = avio_alloc_context(pIOBuffer,
+                                                      65536,
+                                                      1,
+                                                      m_pFileWriter,
+                                                      nullptr,
+                                                      &AsyncFileWriter::WritePacket,
+                                                      &AsyncFileWriter::SeekPacket);
+        m_pFormatCtx->flags |= AVFMT_FLAG_CUSTOM_IO;
+        if (!m_pFormatCtx->pb)
+        {
+            av_free(pIOBuffer);
+            LOG_ERROR(logging::g_qSharedLogger, "FFmpegGroupRecordingMuxer: Could not allocate IO context for {}.", szOutputPath);
+            this->Close();
+            return false;
+        }
+    }
+    else if (!(m_pFormatCtx->oformat->flags & AVFMT_NOFILE) && avio_open(&m_pFormatCtx->pb, szOutputPath.c_str(), AVIO_FLAG_WRITE) < 0)
+    {
+        LOG_ERROR(logging::g_qSharedLogger, "FFmpegGroupRecordingMuxer: Could not open output file {}.", szOutputPath);
+        this->Close();
+        return false;
+    }
+
+    // Write the container header and push it to disk right away.
+    if (avformat_write_header(m_pFormatCtx, nullptr) < 0)
+    {
+        LOG_ERROR(logging::g_qSharedLogger, "FFmpegGroupRecordingMuxer: Failed to write header for {}.", szOutputPath);
+        this->Close();
+        return false;
+    }
+    m_bHeaderWritten = true;
+    if (m_pFormatCtx->pb)
+    {
+        avio_flush(m_pFormatCtx->pb);
+    }
+
+    // Start the shared timeline.
+    m_nStartTimestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    m_bIsOpen         = true;
+
+    // Submit logger message.
+    LOG_INFO(logging::g_qSharedLogger, "FFmpegGroupRecordingMuxer: Recording {} tracks to {}.", m_vTracks.size(), szOutputPath);
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief Encode a frame and write it to a track. Safe to call from a different
+ *        thread for each track.
+ *
+ * @param nTrack - The track to write to.
+ * @param cvFrame - The frame to write. Must be a continuous I420 frame of the track's size.
+ * @param eFrameFormat - The pixel format of the frame. Only eYUV420 is supported.
+ * @param tmCaptureTime - When the frame was captured. Used as the frame timestamp on the shared timeline.
+ * @return true - The frame was sent to the encoder.
+ * @return false - The frame was not written.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool FFmpegGroupRecordingMuxer::WriteFrame(const int nTrack,
+                                           const cv::Mat& cvFrame,
+                                           const PIXEL_FORMATS eFrameFormat,
+                                           const std::chrono::system_clock::time_point& tmCaptureTime)
+{
+    // Check if the recording is open and the track exists.
+    if (!m_bIsOpen || nTrack < 0 || nTrack >= static_cast<int>(m_vTracks.size()) || cvFrame.empty())
+    {
+        return false;
+    }
+    Track& stTrack = *m_vTracks[nTrack];
+
+    // Check that the frame is an I420 image of the right size.
+    if (eFrameFormat != PIXEL_FORMATS::eYUV420 || cvFrame.cols != stTrack.cvFrameSize.width || cvFrame.rows != stTrack.cvFrameSize.height * 3 / 2 ||
+        cvFrame.type() != CV_8UC1 || !cvFrame.isContinuous())
+    {
+        LOG_WARNING(logging::g_qSharedLogger, "FFmpegGroupRecordingMuxer: Frame for track {} has the wrong layout. Skipping...", stTrack.szName);
+        return false;
+    }
+
+    // Convert the capture time to the shared timeline. Frames from before the file was opened don't belong in it.
+    int64_t nTimestamp = std::chrono::duration_cast<std::chrono::microseconds>(tmCaptureTime.time_since_epoch()).count() - m_nStartTimestamp;
+    if (nTimestamp < 0)
+    {
+        return false;
+    }
+
+    // Acquire lock on this track's encoder.
+    std::lock_guard<std::mutex> lkEncoderLock(stTrack.muEncoderMutex);
+    // Timestamps must always increase, even if the clock jumps backwards.
+    if (stTrack.nLastTimestamp != AV_NOPTS_VALUE && nTimestamp <= stTrack.nLastTimestamp)
+    {
+        nTimestamp = stTrack.nLastTimestamp + 1;
+    }
+    stTrack.nLastTimestamp = nTimestamp;
+
+    // Point an AVFrame at the Mat's planes, so the encoder reads it without a copy.
+    AVFrame* pFrame = FFmpegRecordingMuxer::WrapFrame(cvFrame, stTrack.cvFrameSize);
+    if (!pFrame)
+    {
+        return false;
+    }
+    pFrame->pts = nTimestamp;
+    // Start again with a keyframe after a gap.
+    pFrame->pict_type = stTrack.bDiscontinuity ? AV_PICTURE_TYPE_I : AV_PICTURE_TYPE_NONE;
+
+    // Encode the frame.
+    bool bFrameSent = this->EncodeFrame(stTrack, pFrame);
+    av_frame_free(&pFrame);
+    if (bFrameSent)
+    {
+        stTrack.bDiscontinuity = false;
+    }
+
+    return bFrameSent;
+}
+
+/******************************************************************************
+ * @brief Mark that a track's camera stopped delivering frames. The next frame on
+ *        the track is forced to be a keyframe. The gap is left in the timestamps.
+ *
+ * @param nTrack - The track that has a gap.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegGroupRecordingMuxer::MarkDiscontinuity(const int nTrack)
+{
+    // Check if the track exists.
+    if (nTrack < 0 || nTrack >= static_cast<int>(m_vTracks.size()))
+    {
+        return;
+    }
+
+    // Acquire lock on this track's encoder.
+    std::lock_guard<std::mutex> lkEncoderLock(m_vTracks[nTrack]->muEncoderMutex);
+    // Force a keyframe on the next frame.
+    m_vTracks[nTrack]->bDiscontinuity = true;
+}
+
+/******************************************************************************
+ * @brief Flush every encoder, finish the file and free everything. Must not be
+ *        called while frames are being written. Safe to call more than once.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegGroupRecordingMuxer::Close()
+{
+    // Check if the file was fully opened.
+    if (m_bIsOpen)
+    {
+        // Flush any frames still in the encoders.
+        m_bIsOpen = false;
+        for (std::unique_ptr<Track>& pTrack : m_vTracks)
+        {
+            std::lock_guard<std::mutex> lkEncoderLock(pTrack->muEncoderMutex);
+            this->EncodeFrame(*pTrack, nullptr);
+        }
+    }
+
+    // Finish the file.
+    if (m_pFormatCtx)
+    {
+        // The trailer is only valid if the header was written.
+        if (m_bHeaderWritten)
+        {
+            av_write_trailer(m_pFormatCtx);
+            m_bHeaderWritten = false;
+        }
+        if (m_pFormatCtx->flags & AVFMT_FLAG_CUSTOM_IO)
+        {
+            // Push the last of the data to the writer, then let it close the file in the background.
+            if (m_pFormatCtx->pb)
+            {
+                avio_flush(m_pFormatCtx->pb);
+                av_freep(&m_pFormatCtx->pb->buffer);
+                avio_context_free(&m_pFormatCtx->pb);
+            }
+            m_pFileWriter->CloseFile();
+        }
+        else if (!(m_pFormatCtx->oformat->flags & AVFMT_NOFILE))
+        {
+            avio_closep(&m_pFormatCtx->pb);
+        }
+        avformat_free_context(m_pFormatCtx);
+        m_pFormatCtx = nullptr;
+    }
+
+    // Free the tracks.
+    for (std::unique_ptr<Track>& pTrack : m_vTracks)
+    {
+        avcodec_free_context(&pTrack->pCodecCtx);
+        av_packet_free(&pTrack->pPacket);
+    }
+    m_vTracks.clear();
+
+    // Acquire lock on output path.
+    std::lock_guard<std::mutex> lkOutputPathLock(m_muOutputPathMutex);
+    m_szOutputPath.clear();
+}
+
+/******************************************************************************
+ * @brief Accessor for the open status of the recording.
+ *
+ * @return true - Frames can be written.
+ * @return false - The recording is closed or failed to open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool FFmpegGroupRecordingMuxer::GetIsOpen() const
+{
+    // Return member variable value.
+    return m_bIsOpen;
+}
+
+/******************************************************************************
+ * @brief Accessor for the path of the file being written.
+ *
+ * @return std::string - The file path, or an empty string if nothing is open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+std::string FFmpegGroupRecordingMuxer::GetOutputPath()
+{
+    // Acquire lock on output path.
+    std::lock_guard<std::mutex> lkOutputPathLock(m_muOutputPathMutex);
+    // Return member variable value.
+    return m_szOutputPath;
+}
+
+/******************************************************************************
+ * @brief Accessor for the disk write statistics of the async writer.
+ *
+ * @return AsyncFileWriter::WriteStatistics - The write statistics, or all zeros if the async writer isn't enabled.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+AsyncFileWriter::WriteStatistics FFmpegGroupRecordingMuxer::GetWriteStatistics()
+{
+    // Check if the async writer is enabled.
+    if (!m_pFileWriter)
+    {
+        return {};
+    }
+
+    // Return the writer's statistics.
+    return m_pFileWriter->GetStatistics();
+}
+
+/******************************************************************************
+ * @brief Send a frame to a track's encoder and write every packet it produces.
+ *        The track's encoder lock must be held.
+ *
+ * @param stTrack - The track to encode on.
+ * @param pFrame - The frame to encode, or nullptr to flush the encoder.
+ * @return true - The frame was accepted by the encoder.
+ * @return false - The encoder rejected the frame.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool FFmpegGroupRecordingMuxer::EncodeFrame(Track& stTrack, const AVFrame* pFrame)
+{
+    // Send the frame to the encoder.
+    if (avcodec_send_frame(stTrack.pCodecCtx, pFrame) < 0)
+    {
+        LOG_WARNING(logging::g_qSharedLogger, "FFmpegGroupRecordingMuxer: Encoder rejected a frame for track {}.", stTrack.szName);
+        return false;
+    }
+
+    // Write every packet the encoder has ready.
+    while (avcodec_receive_packet(stTrack.pCodecCtx, stTrack.pPacket) >= 0)
+    {
+        // Rescale to the stream and hand it to the muxer, which interleaves the tracks by timestamp.
+        av_packet_rescale_ts(stTrack.pPacket, stTrack.pCodecCtx->time_base, stTrack.pStream->time_base);
+        stTrack.pPacket->stream_index = stTrack.pStream->index;
+
+        // Acquire lock on the output file.
+        std::lock_guard<std::mutex> lkFormatLock(m_muFormatMutex);
+        av_interleaved_write_frame(m_pFormatCtx, stTrack.pPacket);
+        av_packet_unref(stTrack.pPacket);
+    }
+
+    return true;
+}
@@ -0,0 +1,124 @@
+/******************************************************************************
+ * @brief Defines the FFmpegGroupRecordingMuxer class.
+ *
+ * @file FFmpegGroupRecordingMuxer.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef FFMPEG_GROUP_RECORDING_MUXER_H
+#define FFMPEG_GROUP_RECORDING_MUXER_H
+
+#include "../../util/vision/FetchContainers.hpp"
+#include "AsyncFileWriter.h"
+#include "FFmpegRecordingMuxer.h"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <opencv2/opencv.hpp>
+#include <string>
+#include <vector>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+}
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The FFmpegGroupRecordingMuxer class records a group of cameras into one
+ *        file with one video track per camera. Every track is timestamped on the same
+ *        timeline, the capture time since the file was opened, so the cameras are in
+ *        sync on playback without any lining up afterwards. All tracks go through one
+ *        muxer and one file, and optionally one AsyncFileWriter.
+ *
+ *        Each track has its own encoder, and WriteFrame() encodes on the calling thread,
+ *        so each camera's CameraRecorder still encodes in parallel. Only writing the
+ *        encoded packets to the file is serialized.
+ *
+ *        Group recordings aren't split into segments, since a new segment would need a
+ *        keyframe on every track at once.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class FFmpegGroupRecordingMuxer
+{
+    public:
+        /////////////////////////////////////////
+        // Define public structs specific to this class.
+        /////////////////////////////////////////
+
+        // Struct used to describe one track of a group recording.
+        struct TrackSettings
+        {
+            public:
+                std::string szName;                                        // The track title. Ex: the camera location.
+                cv::Size cvFrameSize;                                      // The size of the frames that will be written to the track.
+                FFmpegRecordingMuxer::EncoderSettings stEncoderSettings;    // The encoder settings for the track.
+        };
+
+        /////////////////////////////////////////
+        // Declare public class methods and variables.
+        /////////////////////////////////////////
+
+        FFmpegGroupRecordingMuxer();
+        ~FFmpegGroupRecordingMuxer();
+        void EnableAsyncWriter(const size_t siBufferSize, const size_t siMaxBuffers, const int nFSyncInterval);
+        bool Open(const std::string& szOutputPath, const std::vector<TrackSettings>& vTrackSettings);
+        bool WriteFrame(const int nTrack, const cv::Mat& cvFrame, const PIXEL_FORMATS eFrameFormat, const std::chrono::system_clock::time_point& tmCaptureTime);
+        void MarkDiscontinuity(const int nTrack);
+        void Close();
+
+        /////////////////////////////////////////
+        // Accessors.
+        /////////////////////////////////////////
+
+        bool GetIsOpen() const;
+        std::string GetOutputPath();
+        AsyncFileWriter::WriteStatistics GetWriteStatistics();
+
+    private:
+        /////////////////////////////////////////
+        // Declare private methods.
+        /////////////////////////////////////////
+
+        // Struct used to store the encoder and stream of one track.
+        struct Track
+        {
+            public:
+                std::string szName;
+                cv::Size cvFrameSize;
+                AVCodecContext* pCodecCtx;
+                AVStream* pStream;
+                AVPacket* pPacket;
+                int64_t nLastTimestamp;
+                bool bDiscontinuity;
+                std::mutex muEncoderMutex;
+        };
+
+        bool EncodeFrame(Track& stTrack, const AVFrame* pFrame);
+
+        /////////////////////////////////////////
+        // Declare private class member variables.
+        /////////////////////////////////////////
+
+        std::atomic<bool> m_bIsOpen;
+        bool m_bHeaderWritten;
+        std::string m_szOutputPath;
+        std::mutex m_muOutputPathMutex;
+        int64_t m_nStartTimestamp;
+        std::vector<std::unique_ptr<Track>> m_vTracks;
+        AVFormatContext* m_pFormatCtx;
+        std::mutex m_muFormatMutex;
+        AsyncFileWriter* m_pFileWriter;
+};
+
+#endif    // FFMPEG_GROUP_RECORDING_MUXER_H
@@ -0,0 +1,913 @@
+/******************************************************************************
+ * @brief Implements the FFmpegRecordingMuxer class.
+ *
+ * @file FFmpegRecordingMuxer.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "FFmpegRecordingMuxer.h"
+#include "../../RoveSoCameraServerLogging.h"
+
+/// \cond
+#include <filesystem>
+
+extern "C"
+{
+#include <libavutil/opt.h>
+}
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Construct a new FFmpegRecordingMuxer::FFmpegRecordingMuxer object.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+FFmpegRecordingMuxer::FFmpegRecordingMuxer()
+{
+    // Initialize member variables.
+    m_bIsOpen                = false;
+    m_bSegmentHeaderWritten  = false;
+    m_bWriteToDisk           = true;
+    m_bDiscontinuity         = false;
+    m_nFirstTimestamp        = AV_NOPTS_VALUE;
+    m_nLastTimestamp         = AV_NOPTS_VALUE;
+    m_nSegmentDuration       = 0;
+    m_nSegmentMaxBytes       = 0;
+    m_nSegmentStartTimestamp = AV_NOPTS_VALUE;
+    m_nSegmentIndex          = 0;
+    m_pFormatCtx             = nullptr;
+    m_pCodecCtx              = nullptr;
+    m_pStream                = nullptr;
+    m_pPacket                = nullptr;
+    m_pConvertedFrame        = nullptr;
+    m_pSwsCtx                = nullptr;
+    m_pFileWriter            = nullptr;
+    m_pReplayBuffer          = nullptr;
+    m_pBlackBox              = nullptr;
+    m_siBlackBoxSize         = 0;
+    m_unBlackBoxEntries      = 0;
+    m_nBlackBoxSyncInterval  = 0;
+    m_nLastBlackBoxSync      = AV_NOPTS_VALUE;
+    m_pFrameIndex            = nullptr;
+    m_unFrameSequence        = 0;
+    m_pMetadata              = nullptr;
+}
+
+/******************************************************************************
+ * @brief Destroy the FFmpegRecordingMuxer::FFmpegRecordingMuxer object. Finishes
+ *        the file if it is still open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+FFmpegRecordingMuxer::~FFmpegRecordingMuxer()
+{
+    // Flush the encoder, write the trailer and clean up.
+    this->Close();
+
+    // Delete the file writer. This waits for the last file to reach storage.
+    delete m_pFileWriter;
+    m_pFileWriter = nullptr;
+    // Delete the replay buffer. This finishes any event being saved.
+    delete m_pReplayBuffer;
+    m_pReplayBuffer = nullptr;
+    // Delete the black box. Its file stays on disk.
+    delete m_pBlackBox;
+    m_pBlackBox = nullptr;
+    delete m_pFrameIndex;
+    m_pFrameIndex = nullptr;
+    av_dict_free(&m_pMetadata);
+}
+
+/******************************************************************************
+ * @brief Write recording files through an AsyncFileWriter instead of blocking
+ *        writes on the encoding thread. Must be called before Open().
+ *
+ * @param siBufferSize - The size in bytes of each write buffer.
+ * @param siMaxBuffers - The max number of buffers that can be waiting to be written.
+ * @param nFSyncInterval - How often in milliseconds written data is synced to storage. 0 syncs after
+ *                      every buffer and -1 never syncs, leaving it up to the OS.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegRecordingMuxer::EnableAsyncWriter(const size_t siBufferSize, const size_t siMaxBuffers, const int nFSyncInterval)
+{
+    // Check if a recording is open.
+    if (m_bIsOpen)
+    {
+        LOG_WARNING(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Can't enable the async writer while {} is open.", m_szOutputPath);
+        return;
+    }
+
+    // Create and start the file writer.
+    delete m_pFileWriter;
+    m_pFileWriter = new AsyncFileWriter(siBufferSize, siMaxBuffers, nFSyncInterval);
+    m_pFileWriter->Start();
+}
+
+/******************************************************************************
+ * @brief Keep the most recent encoded packets in memory so events can be saved
+ *        after they happen. Must be called before Open().
+ *
+ * @param nHistorySeconds - The number of seconds of packets to keep.
+ * @param siMaxBytes - The max number of bytes of packets to keep.
+ * @param bWriteToDisk - Whether the recording is still written to segment files. If false, only
+ *                      triggered events are saved.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegRecordingMuxer::EnableReplayBuffer(const int nHistorySeconds, const size_t siMaxBytes, const bool bWriteToDisk)
+{
+    // Check if a recording is open.
+    if (m_bIsOpen)
+    {
+        LOG_WARNING(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Can't enable the replay buffer while {} is open.", m_szOutputPath);
+        return;
+    }
+
+    // Create the replay buffer. It's started once the encoder is open.
+    delete m_pReplayBuffer;
+    m_pReplayBuffer = new ReplayBuffer(nHistorySeconds, siMaxBytes);
+    m_bWriteToDisk  = bWriteToDisk;
+}
+
+/******************************************************************************
+ * @brief Also store every encoded packet in a memory mapped black box ring file,
+ *        which can be recovered offline after a crash. Must be called before Open().
+ *
+ * @param szRingPath - The ring file to create. A ring file left at this path by a previous run is
+ *                      kept with .prev added to its name.
+ * @param siDataSize - The size in bytes of the packet data ring.
+ * @param unIndexEntries - The max number of packets the ring can hold.
+ * @param nSyncInterval - How often in seconds the kernel is asked to write the ring to storage. 0 never
+ *                      asks, which only risks losing data on power loss, not on a crash.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegRecordingMuxer::EnableBlackBox(const std::string& szRingPath, const size_t siDataSize, const uint32_t unIndexEntries, const int nSyncInterval)
+{
+    // Check if a recording is open.
+    if (m_bIsOpen)
+    {
+        LOG_WARNING(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Can't enable the black box while {} is open.", m_szOutputPath);
+        return;
+    }
+
+    // Create the black box. Its file is created once the encoder is open.
+    delete m_pBlackBox;
+    m_pBlackBox             = new BlackBoxRing();
+    m_szBlackBoxPath        = szRingPath;
+    m_siBlackBoxSize        = siDataSize;
+    m_unBlackBoxEntries     = unIndexEntries;
+    m_nBlackBoxSyncInterval = static_cast<int64_t>(nSyncInterval) * 1000000;
+}
+
+/******************************************************************************
+ * @brief Write a frame index next to every file of the recording. The index is
+ *        named after the file with FRAMEINDEX_EXTENSION added. Must be called before
+ *        Open().
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegRecordingMuxer::EnableFrameIndex()
+{
+    // Check if a recording is open.
+    if (m_bIsOpen)
+    {
+        LOG_WARNING(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Can't enable the frame index while {} is open.", m_szOutputPath);
+        return;
+    }
+
+    // Create the index writer. A file is created for each segment.
+    if (!m_pFrameIndex)
+    {
+        m_pFrameIndex = new FrameIndexWriter();
+    }
+}
+
+/******************************************************************************
+ * @brief Add a tag to the container of every file in the recording. Must be called
+ *        before Open().
+ *
+ * @param szKey - The name of the tag.
+ * @param szValue - The value of the tag.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegRecordingMuxer::SetMetadata(const std::string& szKey, const std::string& szValue)
+{
+    // Store the tag. It is copied into each file as it is opened.
+    av_dict_set(&m_pMetadata, szKey.c_str(), szValue.c_str(), 0);
+}
+
+/******************************************************************************
+ * @brief Set up the encoder and open the first file of a new recording.
+ *
+ * @param szOutputPath - The file to write. The container is picked from the extension. If the
+ *                      recording is segmented, each segment is named after this path with an
+ *                      increasing _00000 style index before the extension.
+ * @param cvFrameSize - The size of the frames that will be written.
+ * @param stSettings - The encoder settings for this recording.
+ * @param nSegmentDuration - The length in seconds to start a new segment after. 0 disables it.
+ * @param nSegmentMaxSize - The size in megabytes to start a new segment after. 0 disables it.
+ * @return true - The file and encoder are ready for frames.
+ * @return false - Something failed to initialize. Check the log.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool FFmpegRecordingMuxer::Open(const std::string& szOutputPath,
+                                const cv::Size& cvFrameSize,
+                                const EncoderSettings& stSettings,
+                                const int nSegmentDuration,
+                                const int nSegmentMaxSize)
+{
+    // Close any previous recording.
+    this->Close();
+
+    // Store recording info.
+    m_szOutputPath     = szOutputPath;
+    m_cvFrameSize      = cvFrameSize;
+    m_nFirstTimestamp  = AV_NOPTS_VALUE;
+    m_nLastTimestamp   = AV_NOPTS_VALUE;
+    m_bDiscontinuity   = false;
+    m_nSegmentDuration = static_cast<int64_t>(nSegmentDuration) * 1000000;
+    m_nSegmentMaxBytes = static_cast<int64_t>(nSegmentMaxSize) * 1024 * 1024;
+    m_nSegmentIndex    = 0;
+    m_unFrameSequence  = 0;
+
+    // Find the container format from the file extension.
+    const AVOutputFormat* pOutputFormat = av_guess_format(nullptr, m_szOutputPath.c_str(), nullptr);
+    if (!pOutputFormat)
+    {
+        LOG_ERROR(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Could not find a container format for {}.", m_szOutputPath);
+        this->Close();
+        return false;
+    }
+
+    // Create and open the encoder.
+    m_pCodecCtx = CreateEncoder(cvFrameSize, stSettings, pOutputFormat->flags & AVFMT_GLOBALHEADER);
+    if (!m_pCodecCtx)
+    {
+        LOG_ERROR(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Could not set up encoder {} for {}.", stSettings.szCodecName, m_szOutputPath);
+        this->Close();
+        return false;
+    }
+
+    // Allocate the packet used to drain the encoder.
+    m_pPacket = av_packet_alloc();
+
+    // Give the replay buffer the stream parameters it needs to save events.
+    if (m_pReplayBuffer)
+    {
+        if (!m_pReplayBuffer->SetStreamParameters(m_pCodecCtx))
+        {
+            LOG_ERROR(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Could not set up the replay buffer for {}.", m_szOutputPath);
+            this->Close();
+            return false;
+        }
+        m_pReplayBuffer->Start();
+    }
+
+    // Create the black box file. The recording still works without it.
+    if (m_pBlackBox && !m_pBlackBox->Open(m_szBlackBoxPath, m_siBlackBoxSize, m_unBlackBoxEntries, m_pCodecCtx))
+    {
+        LOG_WARNING(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Recording {} without a black box.", m_szOutputPath);
+    }
+    m_nLastBlackBoxSync = AV_NOPTS_VALUE;
+
+    // Open the first file.
+    if (m_bWriteToDisk && !this->OpenSegment())
+    {
+        this->Close();
+        return false;
+    }
+    m_bIsOpen = true;
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief Encode a frame and write it to the file.
+ *
+ * @param cvFrame - The frame to write. Must be the size given to Open().
+ * @param eFrameFormat - The pixel format of the frame. eYUV420 frames are passed to the
+ *                      encoder as is, eBGR frames are converted first.
+ * @param tmCaptureTime - When the frame was captured. Used as the frame timestamp.
+ * @return true - The frame was sent to the encoder.
+ * @return false - The frame was not written.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool FFmpegRecordingMuxer::WriteFrame(const cv::Mat& cvFrame, const PIXEL_FORMATS eFrameFormat, const std::chrono::system_clock::time_point& tmCaptureTime)
+{
+    // Check if the recording is open.
+    if (!m_bIsOpen || cvFrame.empty())
+    {
+        return false;
+    }
+
+    // Convert the capture time to a timestamp relative to the first frame.
+    int64_t nCaptureTimestamp = std::chrono::duration_cast<std::chrono::microseconds>(tmCaptureTime.time_since_epoch()).count();
+    if (m_nFirstTimestamp == AV_NOPTS_VALUE)
+    {
+        m_nFirstTimestamp = nCaptureTimestamp;
+    }
+    int64_t nTimestamp = nCaptureTimestamp - m_nFirstTimestamp;
+    // Timestamps must always increase, even if the clock jumps backwards.
+    if (m_nLastTimestamp != AV_NOPTS_VALUE && nTimestamp <= m_nLastTimestamp)
+    {
+        nTimestamp = m_nLastTimestamp + 1;
+    }
+
+    // Start again with a keyframe after a gap, so playback can jump straight to where the camera came back.
+    AVPictureType ePictureType = AV_PICTURE_TYPE_NONE;
+    if (m_bDiscontinuity)
+    {
+        // Submit logger message.
+        LOG_INFO(logging::g_qSharedLogger,
+                 "FFmpegRecordingMuxer: Resuming {} after a {:.1f} s gap.",
+                 m_szOutputPath,
+                 m_nLastTimestamp == AV_NOPTS_VALUE ? 0.0 : (nTimestamp - m_nLastTimestamp) / 1000000.0);
+        ePictureType = AV_PICTURE_TYPE_I;
+    }
+    m_nLastTimestamp = nTimestamp;
+
+    // Check what format the frame is in.
+    bool bFrameSent = false;
+    if (eFrameFormat == PIXEL_FORMATS::eYUV420)
+    {
+        // Check that the frame is an I420 image of the right size.
+        if (cvFrame.cols != m_cvFrameSize.width || cvFrame.rows != m_cvFrameSize.height * 3 / 2 || cvFrame.type() != CV_8UC1 || !cvFrame.isContinuous())
+        {
+            LOG_WARNING(logging::g_qSharedLogger, "FFmpegRecordingMuxer: YUV420 frame for {} has the wrong layout. Skipping...", m_szOutputPath);
+            return false;
+        }
+
+        // Point an AVFrame at the Mat's planes, so the encoder reads it without a copy.
+        AVFrame* pFrame = WrapFrame(cvFrame, m_cvFrameSize);
+        if (!pFrame)
+        {
+            return false;
+        }
+        pFrame->pts       = nTimestamp;
+        pFrame->pict_type = ePictureType;
+
+        // Encode the frame.
+        bFrameSent = this->EncodeFrame(pFrame);
+        av_frame_free(&pFrame);
+    }
+    else if (eFrameFormat == PIXEL_FORMATS::eBGR)
+    {
+        // Check that the frame is a BGR image of the right size.
+        if (cvFrame.size() != m_cvFrameSize || cvFrame.type() != CV_8UC3)
+        {
+            LOG_WARNING(logging::g_qSharedLogger, "FFmpegRecordingMuxer: BGR frame for {} has the wrong layout. Skipping...", m_szOutputPath);
+            return false;
+        }
+
+        // Set up the conversion frame the first time it is needed.
+        if (!m_pConvertedFrame)
+        {
+            m_pConvertedFrame         = av_frame_alloc();
+            m_pConvertedFrame->format = AV_PIX_FMT_YUV420P;
+            m_pConvertedFrame->width  = m_cvFrameSize.width;
+            m_pConvertedFrame->height = m_cvFrameSize.height;
+            av_frame_get_buffer(m_pConvertedFrame, 0);
+            m_pSwsCtx = sws_getContext(m_cvFrameSize.width,
+                                       m_cvFrameSize.height,
+                                       AV_PIX_FMT_BGR24,
+                                       m_cvFrameSize.width,
+                                       m_cvFrameSize.height,
+                                       AV_PIX_FMT_YUV420P,
+                                       SWS_BILINEAR,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr);
+        }
+
+        // The encoder may still hold the last converted frame, so make sure we aren't writing over it.
+        if (!m_pSwsCtx || av_frame_make_writable(m_pConvertedFrame) < 0)
+        {
+            return false;
+        }
+
+        // Convert to YUV 4:2:0.
+        const uint8_t* aInData[1] = {cvFrame.data};
+        int aInLinesize[1]        = {static_cast<int>(cvFrame.step)};
+        sws_scale(m_pSwsCtx, aInData, aInLinesize, 0, m_cvFrameSize.height, m_pConvertedFrame->data, m_pConvertedFrame->linesize);
+        m_pConvertedFrame->pts       = nTimestamp;
+        m_pConvertedFrame->pict_type = ePictureType;
+
+        // Encode the frame.
+        bFrameSent = this->EncodeFrame(m_pConvertedFrame);
+    }
+    else
+    {
+        LOG_WARNING(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Unsupported pixel format for {}. Skipping...", m_szOutputPath);
+    }
+
+    // The keyframe was sent, so the gap is handled.
+    if (bFrameSent)
+    {
+        m_bDiscontinuity = false;
+    }
+
+    return bFrameSent;
+}
+
+/******************************************************************************
+ * @brief Mark that the source stopped delivering frames, like a camera that was
+ *        disconnected. Nothing is written for the gap. The next frame is forced to be
+ *        a keyframe, and its capture time leaves a jump in the timestamps that shows
+ *        how long the gap was.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegRecordingMuxer::MarkDiscontinuity()
+{
+    // Force a keyframe on the next frame.
+    m_bDiscontinuity = true;
+}
+
+/******************************************************************************
+ * @brief Create and open an encoder for recording. Timestamps are in microseconds of
+ *        capture time, so frames don't have to arrive at a fixed rate. Shared with the
+ *        FFmpegGroupRecordingMuxer so every recording is encoded the same way.
+ *
+ * @param cvFrameSize - The size of the frames that will be encoded.
+ * @param stSettings - The encoder settings.
+ * @param bGlobalHeader - Whether the container wants the codec headers in one place instead of in every keyframe.
+ * @return AVCodecContext* - The open encoder, or nullptr if it couldn't be created. Free with avcodec_free_context().
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+AVCodecContext* FFmpegRecordingMuxer::CreateEncoder(const cv::Size& cvFrameSize, const EncoderSettings& stSettings, const bool bGlobalHeader)
+{
+    // Find the encoder.
+    const AVCodec* pCodec = avcodec_find_encoder_by_name(stSettings.szCodecName.c_str());
+    if (!pCodec)
+    {
+        LOG_ERROR(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Encoder {} not found.", stSettings.szCodecName);
+        return nullptr;
+    }
+
+    // Allocate the encoder context.
+    AVCodecContext* pCodecCtx = avcodec_alloc_context3(pCodec);
+    if (!pCodecCtx)
+    {
+        return nullptr;
+    }
+
+    // Configure the encoder.
+    pCodecCtx->width        = cvFrameSize.width;
+    pCodecCtx->height       = cvFrameSize.height;
+    pCodecCtx->pix_fmt      = AV_PIX_FMT_YUV420P;
+    pCodecCtx->time_base    = {1, 1000000};
+    pCodecCtx->framerate    = {stSettings.nFrameRate, 1};
+    pCodecCtx->gop_size     = stSettings.nGOPSize;
+    pCodecCtx->max_b_frames = 0;
+    pCodecCtx->thread_count = stSettings.nThreads;
+    pCodecCtx->thread_type  = FF_THREAD_SLICE | FF_THREAD_FRAME;
+    // Check if the container wants the codec headers in one place. They are then copied into every segment.
+    if (bGlobalHeader)
+    {
+        pCodecCtx->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+    }
+
+    // Configure rate control. Private options are ignored by encoders that don't have them.
+    if (!stSettings.szPreset.empty())
+    {
+        av_opt_set(pCodecCtx->priv_data, "preset", stSettings.szPreset.c_str(), 0);
+    }
+    if (stSettings.nBitRate > 0)
+    {
+        pCodecCtx->bit_rate = stSettings.nBitRate;
+    }
+    else
+    {
+        av_opt_set_int(pCodecCtx->priv_data, "crf", stSettings.nCRF, 0);
+    }
+
+    // Open the encoder.
+    if (avcodec_open2(pCodecCtx, pCodec, nullptr) < 0)
+    {
+        avcodec_free_context(&pCodecCtx);
+        return nullptr;
+    }
+
+    return pCodecCtx;
+}
+
+/******************************************************************************
+ * @brief Point an AVFrame at the planes of an I420 Mat. The Mat is kept alive by
+ *        the frame buffer, so the encoder reads it without a copy, even if it holds
+ *        on to the frame after the caller is done with the Mat.
+ *
+ * @param cvFrame - The continuous CV_8UC1 I420 frame, with a height of 3/2 the image height.
+ * @param cvFrameSize - The size of the image.
+ * @return AVFrame* - The frame, or nullptr on failure. Free with av_frame_free().
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+AVFrame* FFmpegRecordingMuxer::WrapFrame(const cv::Mat& cvFrame, const cv::Size& cvFrameSize)
+{
+    // Describe the frame.
+    AVFrame* pFrame = av_frame_alloc();
+    if (!pFrame)
+    {
+        return nullptr;
+    }
+    pFrame->format = AV_PIX_FMT_YUV420P;
+    pFrame->width  = cvFrameSize.width;
+    pFrame->height = cvFrameSize.height;
+    av_image_fill_arrays(pFrame->data, pFrame->linesize, cvFrame.data, AV_PIX_FMT_YUV420P, cvFrameSize.width, cvFrameSize.height, 1);
+
+    // Hand the frame buffer a reference to the Mat.
+    cv::Mat* pOwnedFrame = new cv::Mat(cvFrame);
+    pFrame->buf[0]       = av_buffer_create(cvFrame.data, cvFrame.total() * cvFrame.elemSize(), ReleaseMatBuffer, pOwnedFrame, AV_BUFFER_FLAG_READONLY);
+    if (!pFrame->buf[0])
+    {
+        delete pOwnedFrame;
+        av_frame_free(&pFrame);
+        return nullptr;
+    }
+
+    return pFrame;
+}
+
+/******************************************************************************
+ * @brief Flush the encoder, finish the file and free everything. Safe to call more
+ *        than once.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegRecordingMuxer::Close()
+{
+    // Check if the file was fully opened.
+    if (m_bIsOpen)
+    {
+        // Flush any frames still in the encoder.
+        this->EncodeFrame(nullptr);
+        m_bIsOpen = false;
+    }
+
+    // Finish the current file and clean up.
+    this->CloseSegment();
+    if (m_pBlackBox)
+    {
+        m_pBlackBox->Close();
+    }
+    avcodec_free_context(&m_pCodecCtx);
+    av_packet_free(&m_pPacket);
+    av_frame_free(&m_pConvertedFrame);
+    sws_freeContext(m_pSwsCtx);
+    m_pSwsCtx = nullptr;
+}
+
+/******************************************************************************
+ * @brief Accessor for the open status of the recording.
+ *
+ * @return true - Frames can be written.
+ * @return false - The recording is closed or failed to open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool FFmpegRecordingMuxer::GetIsOpen() const
+{
+    // Return member variable value.
+    return m_bIsOpen;
+}
+
+/******************************************************************************
+ * @brief Accessor for the path of the file currently being written.
+ *
+ * @return std::string - The current segment path, or an empty string if nothing is open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+std::string FFmpegRecordingMuxer::GetCurrentSegmentPath()
+{
+    // Acquire lock on segment path.
+    std::lock_guard<std::mutex> lkSegmentPathLock(m_muSegmentPathMutex);
+    // Return member variable value.
+    return m_szSegmentPath;
+}
+
+/******************************************************************************
+ * @brief Accessor for the disk write statistics of the async writer.
+ *
+ * @return AsyncFileWriter::WriteStatistics - The write statistics, or all zeros if the async writer isn't enabled.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+AsyncFileWriter::WriteStatistics FFmpegRecordingMuxer::GetWriteStatistics()
+{
+    // Check if the async writer is enabled.
+    if (!m_pFileWriter)
+    {
+        return {};
+    }
+
+    // Return the writer's statistics.
+    return m_pFileWriter->GetStatistics();
+}
+
+/******************************************************************************
+ * @brief Accessor for the replay buffer.
+ *
+ * @return ReplayBuffer* - The replay buffer, or nullptr if it isn't enabled.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+ReplayBuffer* FFmpegRecordingMuxer::GetReplayBuffer()
+{
+    // Return member variable value.
+    return m_pReplayBuffer;
+}
+
+/******************************************************************************
+ * @brief Open the next file of the recording and write its header. The encoder
+ *        must already be open.
+ *
+ * @return true - The file is ready for packets.
+ * @return false - The file could not be created. Check the log.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool FFmpegRecordingMuxer::OpenSegment()
+{
+    // Build the file name. Only segmented recordings get an index.
+    std::string szSegmentPath = m_szOutputPath;
+    if (m_nSegmentDuration > 0 || m_nSegmentMaxBytes > 0)
+    {
+        std::filesystem::path szPath(m_szOutputPath);
+        std::string szIndex = std::to_string(m_nSegmentIndex);
+        szIndex.insert(0, szIndex.length() < 5 ? 5 - szIndex.length() : 0, '0');
+        szPath.replace_filename(szPath.stem().string() + "_" + szIndex + szPath.extension().string());
+        szSegmentPath = szPath.string();
+    }
+    ++m_nSegmentIndex;
+    m_nSegmentStartTimestamp = AV_NOPTS_VALUE;
+
+    // Allocate the output context.
+    avformat_alloc_output_context2(&m_pFormatCtx, nullptr, nullptr, szSegmentPath.c_str());
+    if (!m_pFormatCtx)
+    {
+        LOG_ERROR(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Could not allocate output context for {}.", szSegmentPath);
+        return false;
+    }
+
+    // Create the video stream. The codec headers from the encoder are copied in, so each file can be decoded on its own.
+    m_pStream = avformat_new_stream(m_pFormatCtx, nullptr);
+    if (!m_pStream || avcodec_parameters_from_context(m_pStream->codecpar, m_pCodecCtx) < 0)
+    {
+        LOG_ERROR(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Could not create stream for {}.", szSegmentPath);
+        this->CloseSegment();
+        return false;
+    }
+    m_pStream->time_base = m_pCodecCtx->time_base;
+    av_dict_copy(&m_pFormatCtx->metadata, m_pMetadata, 0);
+
+    // Open the output file. With the async writer, libavformat writes into a custom IO context that hands data to the writer thread.
+    if (m_pFileWriter)
+    {
+        if (!m_pFileWriter->OpenFile(szSegmentPath))
+        {
+            this->CloseSegment();
+            return false;
+        }
+        unsigned char* pIOBuffer = static_cast<unsigned char*>(av_malloc(65536));
+        m_pFormatCtx->pb         = avio_alloc_context(pIOBuffer,
+                                                      65536,
+                                                      1,
+                                                      m_pFileWriter,
+                                                      nullptr,
+                                                      &AsyncFileWriter::WritePacket,
+                                                      &AsyncFileWriter::SeekPacket);
+        m_pFormatCtx->flags |= AVFMT_FLAG_CUSTOM_IO;
+        if (!m_pFormatCtx->pb)
+        {
+            av_free(pIOBuffer);
+            LOG_ERROR(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Could not allocate IO context for {}.", szSegmentPath);
+            this->CloseSegment();
+            return false;
+        }
+    }
+    else if (!(m_pFormatCtx->oformat->flags & AVFMT_NOFILE) && avio_open(&m_pFormatCtx->pb, szSegmentPath.c_str(), AVIO_FLAG_WRITE) < 0)
+    {
+        LOG_ERROR(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Could not open output file {}.", szSegmentPath);
+        this->CloseSegment();
+        return false;
+    }
+
+    // Write the container header and push it to disk right away.
+    if (avformat_write_header(m_pFormatCtx, nullptr) < 0)
+    {
+        LOG_ERROR(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Failed to write header for {}.", szSegmentPath);
+        this->CloseSegment();
+        return false;
+    }
+    m_bSegmentHeaderWritten = true;
+    if (m_pFormatCtx->pb)
+    {
+        avio_flush(m_pFormatCtx->pb);
+    }
+
+    // Create the frame index for this file. The stream time base is only final once the header is written. The recording still works without it.
+    if (m_pFrameIndex &&
+        !m_pFrameIndex->Open(szSegmentPath + frameindex::FRAMEINDEX_EXTENSION, m_pStream->time_base.num, m_pStream->time_base.den, m_pStream->index))
+    {
+        LOG_WARNING(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Recording {} without a frame index.", szSegmentPath);
+    }
+
+    // Update the current segment path.
+    std::lock_guard<std::mutex> lkSegmentPathLock(m_muSegmentPathMutex);
+    m_szSegmentPath = szSegmentPath;
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief Write the trailer of the current file and close it. Safe to call if no
+ *        file is open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegRecordingMuxer::CloseSegment()
+{
+    // Check if there is a file to close.
+    if (!m_pFormatCtx)
+    {
+        return;
+    }
+
+    // Finish the file. The trailer is only valid if the header was written.
+    if (m_bSegmentHeaderWritten)
+    {
+        av_write_trailer(m_pFormatCtx);
+        m_bSegmentHeaderWritten = false;
+    }
+    if (m_pFormatCtx->flags & AVFMT_FLAG_CUSTOM_IO)
+    {
+        // Push the last of the data to the writer, then let it close the file in the background.
+        if (m_pFormatCtx->pb)
+        {
+            avio_flush(m_pFormatCtx->pb);
+            av_freep(&m_pFormatCtx->pb->buffer);
+            avio_context_free(&m_pFormatCtx->pb);
+        }
+        m_pFileWriter->CloseFile();
+    }
+    else if (!(m_pFormatCtx->oformat->flags & AVFMT_NOFILE))
+    {
+        avio_closep(&m_pFormatCtx->pb);
+    }
+
+    // Finish the frame index.
+    if (m_pFrameIndex)
+    {
+        m_pFrameIndex->Close();
+    }
+
+    // Clean up.
+    avformat_free_context(m_pFormatCtx);
+    m_pFormatCtx = nullptr;
+    m_pStream    = nullptr;
+
+    // Clear the current segment path.
+    std::lock_guard<std::mutex> lkSegmentPathLock(m_muSegmentPathMutex);
+    m_szSegmentPath.clear();
+}
+
+/******************************************************************************
+ * @brief Send a frame to the encoder and write every packet it produces. If the
+ *        current segment is full, a new one is started at the next keyframe.
+ *
+ * @param pFrame - The frame to encode, or nullptr to flush the encoder.
+ * @return true - The frame was accepted by the encoder.
+ * @return false - The encoder rejected the frame.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool FFmpegRecordingMuxer::EncodeFrame(const AVFrame* pFrame)
+{
+    // Send the frame to the encoder.
+    if (avcodec_send_frame(m_pCodecCtx, pFrame) < 0)
+    {
+        LOG_WARNING(logging::g_qSharedLogger, "FFmpegRecordingMuxer: Encoder rejected a frame for {}.", m_szOutputPath);
+        return false;
+    }
+
+    // Write every packet the encoder has ready.
+    while (avcodec_receive_packet(m_pCodecCtx, m_pPacket) >= 0)
+    {
+        // Keep a reference to the packet for instant replay.
+        if (m_pReplayBuffer)
+        {
+            m_pReplayBuffer->AddPacket(m_pPacket);
+        }
+        // Store the packet in the black box, and every so often ask the kernel to write it out.
+        if (m_pBlackBox && m_pBlackBox->GetIsOpen())
+        {
+            m_pBlackBox->AddPacket(m_pPacket);
+            if (m_nBlackBoxSyncInterval > 0 && (m_nLastBlackBoxSync == AV_NOPTS_VALUE || m_pPacket->pts - m_nLastBlackBoxSync >= m_nBlackBoxSyncInterval))
+            {
+                m_pBlackBox->Sync();
+                m_nLastBlackBoxSync = m_pPacket->pts;
+            }
+        }
+
+        // Check if the current segment is full. Segments only ever start on a keyframe so they can be decoded on their own.
+        if (m_pFormatCtx && (m_pPacket->flags & AV_PKT_FLAG_KEY) && m_nSegmentStartTimestamp != AV_NOPTS_VALUE)
+        {
+            bool bDurationReached = m_nSegmentDuration > 0 && m_pPacket->pts - m_nSegmentStartTimestamp >= m_nSegmentDuration;
+            bool bSizeReached     = m_nSegmentMaxBytes > 0 && m_pFormatCtx->pb && avio_tell(m_pFormatCtx->pb) >= m_nSegmentMaxBytes;
+            if (bDurationReached || bSizeReached)
+            {
+                // Finish this segment and start the next one.
+                this->CloseSegment();
+                if (!this->OpenSegment())
+                {
+                    // Nothing can be written anymore, so drop the rest of the recording.
+                    this->CloseSegment();
+                }
+            }
+        }
+
+        // Check if there is a file to write to.
+        if (!m_pFormatCtx)
+        {
+            av_packet_unref(m_pPacket);
+            continue;
+        }
+
+        // Timestamps in each segment start at zero.
+        if (m_nSegmentStartTimestamp == AV_NOPTS_VALUE)
+        {
+            m_nSegmentStartTimestamp = m_pPacket->pts;
+        }
+        int64_t nCaptureTimestamp = m_nFirstTimestamp + m_pPacket->pts;
+        m_pPacket->pts -= m_nSegmentStartTimestamp;
+        m_pPacket->dts -= m_nSegmentStartTimestamp;
+        av_packet_rescale_ts(m_pPacket, m_pCodecCtx->time_base, m_pStream->time_base);
+        m_pPacket->stream_index = m_pStream->index;
+
+        // Index the frame. There are no B-frames, so packets come out in capture order.
+        if (m_pFrameIndex && m_pFrameIndex->GetIsOpen())
+        {
+            m_pFrameIndex->AddRecord({nCaptureTimestamp,
+                                      m_pPacket->pts,
+                                      m_unFrameSequence,
+                                      static_cast<uint64_t>(m_pFormatCtx->pb ? avio_tell(m_pFormatCtx->pb) : 0),
+                                      static_cast<uint32_t>(m_pPacket->size),
+                                      static_cast<uint32_t>(m_pPacket->flags)});
+        }
+        ++m_unFrameSequence;
+        av_interleaved_write_frame(m_pFormatCtx, m_pPacket);
+        av_packet_unref(m_pPacket);
+    }
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief Free callback for AVBuffers that wrap a cv::Mat. Releases the Mat's
+ *        reference to its data once the encoder is done with the frame.
+ *
+ * @param pOpaque - The heap allocated cv::Mat that owns the data.
+ * @param pData - The buffer data. Not used, the Mat owns it.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegRecordingMuxer::ReleaseMatBuffer(void* pOpaque, uint8_t* pData)
+{
+    // Not using this.
+    (void) pData;
+
+    // Release the Mat.
+    delete static_cast<cv::Mat*>(pOpaque);
+}
@@ -0,0 +1,172 @@
+/******************************************************************************
+ * @brief Defines the FFmpegRecordingMuxer class.
+ *
+ * @file FFmpegRecordingMuxer.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef FFMPEG_RECORDING_MUXER_H
+#define FFMPEG_RECORDING_MUXER_H
+
+#include "../../util/vision/FetchContainers.hpp"
+#include "AsyncFileWriter.h"
+#include "BlackBoxRing.h"
+#include "FrameIndexWriter.h"
+#include "ReplayBuffer.h"
+
+/// \cond
+#include <chrono>
+#include <mutex>
+#include <opencv2/opencv.hpp>
+#include <string>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+#include <libavutil/imgutils.h>
+#include <libswscale/swscale.h>
+}
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The FFmpegRecordingMuxer class encodes camera frames and writes them to a
+ *        video file using libavcodec and libavformat directly. Unlike cv::VideoWriter,
+ *        the codec, preset, rate control and encoder threads are configurable, planar
+ *        YUV 4:2:0 frames are handed to the encoder without any conversion or copy, and
+ *        every frame is stamped with the time it was captured instead of a fixed rate.
+ *        Recordings are variable frame rate, so gaps between frames are kept as they were.
+ *        When a camera drops out, nothing is encoded until it comes back. The outage is
+ *        left as a jump in the timestamps and the first frame after it is a keyframe.
+ *
+ *        Recordings can be split into segments every so many seconds or megabytes. A new
+ *        segment is only started on a keyframe and the previous one is finished with its
+ *        trailer, so every closed segment is a complete file that plays on its own and a
+ *        crash can only lose the segment that was being written.
+ *
+ *        If the async writer is enabled, files are written through an AsyncFileWriter
+ *        instead of plain blocking writes, so the encoder never waits on storage.
+ *
+ *        If the replay buffer is enabled, every encoded packet is also kept in a
+ *        ReplayBuffer. Writing to disk can then be turned off completely, and only
+ *        triggered events get saved.
+ *
+ *        If the black box is enabled, every encoded packet is also stored in a memory
+ *        mapped BlackBoxRing file, so the last few seconds survive a crash of the server
+ *        even if the current segment doesn't.
+ *
+ *        If the frame index is enabled, every file gets a FrameIndexWriter sidecar with
+ *        the capture time, timestamp and file position of each frame, so tools can find
+ *        a moment in a recording without reading through the whole file.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class FFmpegRecordingMuxer
+{
+    public:
+        /////////////////////////////////////////
+        // Define public structs specific to this class.
+        /////////////////////////////////////////
+
+        // Struct used to configure the encoder for a recording.
+        struct EncoderSettings
+        {
+            public:
+                std::string szCodecName;    // The libavcodec encoder name. Ex: libx264, libx265, h264_v4l2m2m.
+                std::string szPreset;       // The encoder speed preset. Empty uses the encoder default.
+                int nCRF;                   // The constant rate factor. Only used if nBitRate is 0.
+                int64_t nBitRate;           // The target bitrate in bits per second. 0 uses nCRF instead.
+                int nThreads;               // The number of threads the encoder may use. 0 lets the encoder decide.
+                int nFrameRate;             // The nominal frame rate. Only used as a hint, timestamps come from the frames.
+                int nGOPSize;               // The max number of frames between keyframes.
+        };
+
+        /////////////////////////////////////////
+        // Declare public class methods and variables.
+        /////////////////////////////////////////
+
+        FFmpegRecordingMuxer();
+        ~FFmpegRecordingMuxer();
+        void EnableAsyncWriter(const size_t siBufferSize, const size_t siMaxBuffers, const int nFSyncInterval);
+        void EnableReplayBuffer(const int nHistorySeconds, const size_t siMaxBytes, const bool bWriteToDisk);
+        void EnableBlackBox(const std::string& szRingPath, const size_t siDataSize, const uint32_t unIndexEntries, const int nSyncInterval);
+        void EnableFrameIndex();
+        void SetMetadata(const std::string& szKey, const std::string& szValue);
+        bool Open(const std::string& szOutputPath,
+                  const cv::Size& cvFrameSize,
+                  const EncoderSettings& stSettings,
+                  const int nSegmentDuration = 0,
+                  const int nSegmentMaxSize  = 0);
+        bool WriteFrame(const cv::Mat& cvFrame, const PIXEL_FORMATS eFrameFormat, const std::chrono::system_clock::time_point& tmCaptureTime);
+        void MarkDiscontinuity();
+        void Close();
+
+        /////////////////////////////////////////
+        // Accessors.
+        /////////////////////////////////////////
+
+        bool GetIsOpen() const;
+        std::string GetCurrentSegmentPath();
+        AsyncFileWriter::WriteStatistics GetWriteStatistics();
+        ReplayBuffer* GetReplayBuffer();
+
+        /////////////////////////////////////////
+        // Helpers shared with other recording muxers.
+        /////////////////////////////////////////
+
+        static AVCodecContext* CreateEncoder(const cv::Size& cvFrameSize, const EncoderSettings& stSettings, const bool bGlobalHeader);
+        static AVFrame* WrapFrame(const cv::Mat& cvFrame, const cv::Size& cvFrameSize);
+
+    private:
+        /////////////////////////////////////////
+        // Declare private methods.
+        /////////////////////////////////////////
+
+        bool OpenSegment();
+        void CloseSegment();
+        bool EncodeFrame(const AVFrame* pFrame);
+        static void ReleaseMatBuffer(void* pOpaque, uint8_t* pData);
+
+        /////////////////////////////////////////
+        // Declare private class member variables.
+        /////////////////////////////////////////
+
+        bool m_bIsOpen;
+        bool m_bSegmentHeaderWritten;
+        bool m_bWriteToDisk;
+        bool m_bDiscontinuity;
+        std::string m_szOutputPath;
+        std::string m_szSegmentPath;
+        std::mutex m_muSegmentPathMutex;
+        cv::Size m_cvFrameSize;
+        int64_t m_nFirstTimestamp;
+        int64_t m_nLastTimestamp;
+        int64_t m_nSegmentDuration;
+        int64_t m_nSegmentMaxBytes;
+        int64_t m_nSegmentStartTimestamp;
+        int m_nSegmentIndex;
+        AVFormatContext* m_pFormatCtx;
+        AVCodecContext* m_pCodecCtx;
+        AVStream* m_pStream;
+        AVPacket* m_pPacket;
+        AVFrame* m_pConvertedFrame;
+        SwsContext* m_pSwsCtx;
+        AsyncFileWriter* m_pFileWriter;
+        ReplayBuffer* m_pReplayBuffer;
+        BlackBoxRing* m_pBlackBox;
+        std::string m_szBlackBoxPath;
+        size_t m_siBlackBoxSize;
+        uint32_t m_unBlackBoxEntries;
+        int64_t m_nBlackBoxSyncInterval;
+        int64_t m_nLastBlackBoxSync;
+        FrameIndexWriter* m_pFrameIndex;
+        uint64_t m_unFrameSequence;
+        AVDictionary* m_pMetadata;
+};
+
+#endif    // FFMPEG_RECORDING_MUXER_H
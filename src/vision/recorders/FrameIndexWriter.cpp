@@ -0,0 +1,213 @@
+/******************************************************************************
+ * @brief Implements the FrameIndexWriter class.
+ *
+ * @file FrameIndexWriter.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "FrameIndexWriter.h"
+#include "../../RoveSoCameraServerLogging.h"
+
+/// \cond
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Construct a new Frame Index Writer:: Frame Index Writer object.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+FrameIndexWriter::FrameIndexWriter()
+{
+    // Initialize member variables.
+    m_nFileDescriptor = -1;
+    m_vPendingRecords.reserve(frameindex::FRAMEINDEX_WRITE_BATCH);
+}
+
+/******************************************************************************
+ * @brief Destroy the Frame Index Writer:: Frame Index Writer object.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+FrameIndexWriter::~FrameIndexWriter()
+{
+    // Write any pending records and close the file.
+    this->Close();
+}
+
+/******************************************************************************
+ * @brief Create a new index file and write its header.
+ *
+ * @param szFilePath - The index file to create. Usually the recording path with FRAMEINDEX_EXTENSION added.
+ * @param nTimeBaseNum - The numerator of the stream time base the record timestamps will be in.
+ * @param nTimeBaseDen - The denominator of the stream time base the record timestamps will be in.
+ * @param nStreamIndex - The stream in the recording the records describe.
+ * @return true - The index file is ready for records.
+ * @return false - The file could not be created.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool FrameIndexWriter::Open(const std::string& szFilePath, const int nTimeBaseNum, const int nTimeBaseDen, const int nStreamIndex)
+{
+    // Close any previous file.
+    this->Close();
+
+    // Create the file.
+    m_szFilePath      = szFilePath;
+    m_nFileDescriptor = ::open(szFilePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (m_nFileDescriptor < 0)
+    {
+        // Submit logger message.
+        LOG_ERROR(logging::g_qSharedLogger, "FrameIndexWriter: Could not create {}: {}", szFilePath, std::strerror(errno));
+        return false;
+    }
+
+    // Write the header.
+    frameindex::FileHeader stHeader = {};
+    stHeader.unMagic                = frameindex::FRAMEINDEX_MAGIC;
+    stHeader.unVersion              = frameindex::FRAMEINDEX_VERSION;
+    stHeader.unRecordSize           = sizeof(frameindex::Record);
+    stHeader.nTimeBaseNum           = nTimeBaseNum;
+    stHeader.nTimeBaseDen           = nTimeBaseDen;
+    stHeader.nStreamIndex           = nStreamIndex;
+    if (!this->WriteAll(&stHeader, sizeof(stHeader)))
+    {
+        this->Close();
+        return false;
+    }
+
+    return true;
+}
+
+/******************************************************************************
+ * @brief Add a record for the next frame. Records are written to the file once a
+ *      full batch has been collected.
+ *
+ * @param stRecord - The record to add.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FrameIndexWriter::AddRecord(const frameindex::Record& stRecord)
+{
+    // Check if the file is open.
+    if (m_nFileDescriptor < 0)
+    {
+        return;
+    }
+
+    // Store the record and write the batch if it's full.
+    m_vPendingRecords.push_back(stRecord);
+    if (m_vPendingRecords.size() >= frameindex::FRAMEINDEX_WRITE_BATCH)
+    {
+        this->Flush();
+    }
+}
+
+/******************************************************************************
+ * @brief Write every pending record to the file.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FrameIndexWriter::Flush()
+{
+    // Check if there is anything to write.
+    if (m_nFileDescriptor < 0 || m_vPendingRecords.empty())
+    {
+        return;
+    }
+
+    // Write the records. If the write fails the index is closed, since a gap would shift every record after it.
+    if (!this->WriteAll(m_vPendingRecords.data(), m_vPendingRecords.size() * sizeof(frameindex::Record)))
+    {
+        m_vPendingRecords.clear();
+        this->Close();
+        return;
+    }
+    m_vPendingRecords.clear();
+}
+
+/******************************************************************************
+ * @brief Write any pending records and close the file. Safe to call if nothing is
+ *      open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FrameIndexWriter::Close()
+{
+    // Check if the file is open.
+    if (m_nFileDescriptor < 0)
+    {
+        return;
+    }
+
+    // Write the last records and close the file.
+    this->Flush();
+    if (m_nFileDescriptor >= 0)
+    {
+        ::close(m_nFileDescriptor);
+        m_nFileDescriptor = -1;
+    }
+}
+
+/******************************************************************************
+ * @brief Accessor for the open status of the index file.
+ *
+ * @return true - Records are being written.
+ * @return false - The index file isn't open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool FrameIndexWriter::GetIsOpen() const
+{
+    // Return whether the file is open.
+    return m_nFileDescriptor >= 0;
+}
+
+/******************************************************************************
+ * @brief Write a buffer to the index file, retrying short writes.
+ *
+ * @param pData - The data to write.
+ * @param siSize - The number of bytes to write.
+ * @return true - Everything was written.
+ * @return false - The write failed. Check the log.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool FrameIndexWriter::WriteAll(const void* pData, const size_t siSize)
+{
+    // Write until everything is out.
+    const uint8_t* pBytes = static_cast<const uint8_t*>(pData);
+    size_t siWritten      = 0;
+    while (siWritten < siSize)
+    {
+        ssize_t siResult = ::write(m_nFileDescriptor, pBytes + siWritten, siSize - siWritten);
+        if (siResult < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (siResult <= 0)
+        {
+            // Submit logger message.
+            LOG_ERROR(logging::g_qSharedLogger, "FrameIndexWriter: Could not write to {}: {}", m_szFilePath, std::strerror(errno));
+            return false;
+        }
+        siWritten += static_cast<size_t>(siResult);
+    }
+
+    return true;
+}
@@ -0,0 +1,117 @@
+/******************************************************************************
+ * @brief Defines the FrameIndexWriter class and the layout of frame index files.
+ *
+ * @file FrameIndexWriter.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef FRAME_INDEX_WRITER_H
+#define FRAME_INDEX_WRITER_H
+
+/// \cond
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Namespace containing the on-disk layout of a frame index file. The file
+ *      is a fixed size header followed by one fixed size record per frame of the
+ *      recording it sits next to, in the order they were written. Every field is
+ *      little endian, so the file can be mapped and read as an array of Records.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+namespace frameindex
+{
+    // Identifies a frame index file. "RSFRMIDX".
+    constexpr uint64_t FRAMEINDEX_MAGIC   = 0x5844494D52465352;
+    constexpr uint32_t FRAMEINDEX_VERSION = 1;
+    // The extension added to the recording's file name.
+    constexpr const char* FRAMEINDEX_EXTENSION = ".idx";
+    // The number of records the writer collects before writing them to the file.
+    constexpr size_t FRAMEINDEX_WRITE_BATCH = 64;
+
+    // Struct stored at the start of the file.
+    struct FileHeader
+    {
+        public:
+            uint64_t unMagic;         // Always FRAMEINDEX_MAGIC.
+            uint32_t unVersion;       // Always FRAMEINDEX_VERSION.
+            uint32_t unRecordSize;    // The size of each record. Always sizeof(Record).
+            int32_t nTimeBaseNum;     // The numerator of the stream time base the record timestamps are in.
+            int32_t nTimeBaseDen;     // The denominator of the stream time base the record timestamps are in.
+            int32_t nStreamIndex;     // The stream in the recording the records describe.
+            uint32_t unReserved;      // Always 0.
+            uint64_t aReserved[4];    // Always 0.
+    };
+    static_assert(sizeof(FileHeader) == 64, "The frame index file header must stay 64 bytes.");
+
+    // Struct stored for each frame. Frames are written in order, so nCaptureTime never decreases.
+    struct Record
+    {
+        public:
+            int64_t nCaptureTime;     // When the frame was captured, in microseconds since the epoch.
+            int64_t nPTS;             // The frame timestamp in the recording, in the stream time base.
+            uint64_t unSequence;      // The frame number in the recording, counting across segments.
+            uint64_t unFileOffset;    // The position of the output when the frame was handed to the muxer. The frame's data is
+                                      // always after it. For Matroska this is the start of the cluster holding the frame.
+            uint32_t unSize;          // The number of bytes of encoded frame data.
+            uint32_t unFlags;         // The AVPacket flags. Ex: AV_PKT_FLAG_KEY.
+    };
+    static_assert(sizeof(Record) == 40, "Frame index records must stay 40 bytes.");
+}    // namespace frameindex
+
+/******************************************************************************
+ * @brief The FrameIndexWriter class writes the frame index file that sits next to
+ *      each recording file. Records are collected in memory and written in batches,
+ *      so recording a frame doesn't cost a system call. If the server crashes, the
+ *      index is only missing the last batch, and a partly written record at the end
+ *      is ignored by readers since every record is the same size.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class FrameIndexWriter
+{
+    public:
+        /////////////////////////////////////////
+        // Declare public class methods and variables.
+        /////////////////////////////////////////
+
+        FrameIndexWriter();
+        ~FrameIndexWriter();
+        bool Open(const std::string& szFilePath, const int nTimeBaseNum, const int nTimeBaseDen, const int nStreamIndex);
+        void AddRecord(const frameindex::Record& stRecord);
+        void Flush();
+        void Close();
+
+        /////////////////////////////////////////
+        // Accessors.
+        /////////////////////////////////////////
+
+        bool GetIsOpen() const;
+
+    private:
+        /////////////////////////////////////////
+        // Declare private methods.
+        /////////////////////////////////////////
+
+        bool WriteAll(const void* pData, const size_t siSize);
+
+        /////////////////////////////////////////
+        // Declare private class member variables.
+        /////////////////////////////////////////
+
+        int m_nFileDescriptor;
+        std::string m_szFilePath;
+        std::vector<frameindex::Record> m_vPendingRecords;
+};
+
+#endif    // FRAME_INDEX_WRITER_H
@@ -0,0 +1,205 @@
+/******************************************************************************
+ * @brief Implements the RecordingRetention class.
+ *
+ * @file RecordingRetention.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RecordingRetention.h"
+#include "../../RoveSoCameraServerLogging.h"
+
+/// \cond
+#include <algorithm>
+#include <filesystem>
+#include <utility>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Construct a new Recording Retention:: Recording Retention object.
+ *
+ * @param szRecordingsPath - The folder to look for recordings in. Segments in any cameras folder under it count against the budget.
+ * @param nDiskBudget - The max size in megabytes of every camera recording put together.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+RecordingRetention::RecordingRetention(const std::string& szRecordingsPath, const int64_t nDiskBudget)
+{
+    // Initialize member variables.
+    m_szRecordingsPath  = szRecordingsPath;
+    m_unBudgetBytes     = static_cast<uintmax_t>(std::max<int64_t>(nDiskBudget, 0)) * 1024 * 1024;
+    m_bScanRequested    = false;
+    m_unDeletedSegments = 0;
+}
+
+/******************************************************************************
+ * @brief Destroy the Recording Retention:: Recording Retention object.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+RecordingRetention::~RecordingRetention()
+{
+    // Signal and wait for the retention thread to stop.
+    this->RequestStop();
+    m_cdScanRequestedCondition.notify_all();
+    this->Join();
+}
+
+/******************************************************************************
+ * @brief Mutator for the recording files that are still being written. They are
+ *      never deleted. This also starts a scan of the recordings.
+ *
+ * @param setOpenSegments - The normalized paths of the open recording files.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingRetention::SetOpenSegments(const std::unordered_set<std::string>& setOpenSegments)
+{
+    // Acquire lock on open segments.
+    std::unique_lock<std::mutex> lkOpenSegmentsLock(m_muOpenSegmentsMutex);
+    m_setOpenSegments = setOpenSegments;
+    m_bScanRequested  = true;
+    lkOpenSegmentsLock.unlock();
+    // Wake up the retention thread.
+    m_cdScanRequestedCondition.notify_one();
+}
+
+/******************************************************************************
+ * @brief Accessor for the number of segments deleted to stay under the budget.
+ *
+ * @return uint64_t - The number of deleted segments.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+uint64_t RecordingRetention::GetDeletedSegments() const
+{
+    // Return member variable value.
+    return m_unDeletedSegments;
+}
+
+/******************************************************************************
+ * @brief This code will run continuously in a separate thread. Each time new open
+ *      segments are handed over, the recordings are scanned and the oldest segments
+ *      are deleted until they fit the budget.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingRetention::ThreadedContinuousCode()
+{
+    // Acquire lock on open segments.
+    std::unique_lock<std::mutex> lkOpenSegmentsLock(m_muOpenSegmentsMutex);
+    // Wait for a scan to be requested. Time out every so often so a stop request is noticed.
+    if (!m_cdScanRequestedCondition.wait_for(lkOpenSegmentsLock,
+                                             std::chrono::milliseconds(100),
+                                             [this] { return m_bScanRequested || this->GetThreadState() == AutonomyThreadState::eStopping; }) ||
+        !m_bScanRequested)
+    {
+        return;
+    }
+
+    // Take the open segments, so new ones can be handed over while scanning.
+    std::unordered_set<std::string> setOpenSegments = std::move(m_setOpenSegments);
+    m_setOpenSegments.clear();
+    m_bScanRequested = false;
+    lkOpenSegmentsLock.unlock();
+
+    // Delete the oldest recording segments if needed.
+    this->EnforceDiskBudget(setOpenSegments);
+}
+
+/******************************************************************************
+ * @brief This method holds the code that is ran in the thread pool started by
+ *      the ThreadedLinearCode() method. It currently does nothing and is not
+ *      needed in the current implementation of the RecordingRetention.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingRetention::PooledLinearCode() {}
+
+/******************************************************************************
+ * @brief Delete the oldest camera recording segments until every camera recording
+ *      put together fits the disk budget. Files that are still being written are
+ *      never deleted.
+ *
+ * @param setOpenSegments - The normalized paths of the open recording files.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingRetention::EnforceDiskBudget(const std::unordered_set<std::string>& setOpenSegments)
+{
+    // Find every camera recording under the recordings directory. Error codes are used so a file disappearing mid-scan doesn't throw.
+    std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> vSegments;
+    uintmax_t unTotalBytes = 0;
+    std::error_code errCode;
+    for (std::filesystem::recursive_directory_iterator itFile(m_szRecordingsPath, errCode), itEnd; !errCode && itFile != itEnd; itFile.increment(errCode))
+    {
+        // Check if this is a file in a cameras folder.
+        if (!itFile->is_regular_file(errCode) || itFile->path().parent_path().filename() != "cameras")
+        {
+            continue;
+        }
+
+        // Add it to the list.
+        uintmax_t unFileBytes = itFile->file_size(errCode);
+        if (!errCode)
+        {
+            unTotalBytes += unFileBytes;
+            vSegments.emplace_back(itFile->last_write_time(errCode), itFile->path());
+        }
+        errCode.clear();
+    }
+
+    // Check if the recordings are over budget.
+    if (unTotalBytes <= m_unBudgetBytes)
+    {
+        return;
+    }
+
+    // Delete the oldest segments until the recordings fit.
+    std::sort(vSegments.begin(), vSegments.end());
+    for (const std::pair<std::filesystem::file_time_type, std::filesystem::path>& stSegment : vSegments)
+    {
+        // Check if we are under budget now, or the thread is stopping.
+        if (unTotalBytes <= m_unBudgetBytes || this->GetThreadState() == AutonomyThreadState::eStopping)
+        {
+            break;
+        }
+        // Skip files that are still open.
+        if (setOpenSegments.count(stSegment.second.lexically_normal().string()))
+        {
+            continue;
+        }
+
+        // Delete the segment.
+        uintmax_t unFileBytes = std::filesystem::file_size(stSegment.second, errCode);
+        if (!errCode && std::filesystem::remove(stSegment.second, errCode))
+        {
+            unTotalBytes -= unFileBytes;
+            ++m_unDeletedSegments;
+            // Submit logger message.
+            LOG_INFO(logging::g_qSharedLogger, "RecordingRetention: Deleted recording segment {} to stay under the disk budget.", stSegment.second.string());
+        }
+        errCode.clear();
+    }
+
+    // Check if the open segments alone are over budget.
+    if (unTotalBytes > m_unBudgetBytes)
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger,
+                    "RecordingRetention: Camera recordings use {} MB, which is over the {} MB disk budget even after deleting old segments.",
+                    unTotalBytes / (1024 * 1024),
+                    m_unBudgetBytes / (1024 * 1024));
+    }
+}
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * @brief Defines the RecordingRetention class.
+ *
+ * @file RecordingRetention.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef RECORDING_RETENTION_H
+#define RECORDING_RETENTION_H
+
+#include "../../interfaces/AutonomyThread.hpp"
+
+/// \cond
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RecordingRetention class keeps the camera recordings under a disk
+ *      budget by deleting the oldest segments, in its own thread. Walking the
+ *      recordings folder can take a while on a full SD card, so it is kept off the
+ *      thread that schedules frames. A scan runs each time the RecordingHandler hands
+ *      it the set of files that are still being written, which are never deleted.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class RecordingRetention : public AutonomyThread<void>
+{
+    public:
+        /////////////////////////////////////////
+        // Declare public class methods and variables.
+        /////////////////////////////////////////
+
+        RecordingRetention(const std::string& szRecordingsPath, const int64_t nDiskBudget);
+        ~RecordingRetention();
+
+        /////////////////////////////////////////
+        // Mutators.
+        /////////////////////////////////////////
+
+        void SetOpenSegments(const std::unordered_set<std::string>& setOpenSegments);
+
+        /////////////////////////////////////////
+        // Accessors.
+        /////////////////////////////////////////
+
+        uint64_t GetDeletedSegments() const;
+
+    private:
+        /////////////////////////////////////////
+        // Declare private methods.
+        /////////////////////////////////////////
+
+        void ThreadedContinuousCode() override;
+        void PooledLinearCode() override;
+        void EnforceDiskBudget(const std::unordered_set<std::string>& setOpenSegments);
+
+        /////////////////////////////////////////
+        // Declare private class member variables.
+        /////////////////////////////////////////
+
+        std::string m_szRecordingsPath;
+        uintmax_t m_unBudgetBytes;
+        std::unordered_set<std::string> m_setOpenSegments;
+        bool m_bScanRequested;
+        std::mutex m_muOpenSegmentsMutex;
+        std::condition_variable m_cdScanRequestedCondition;
+        std::atomic<uint64_t> m_unDeletedSegments;
+};
+#endif
@@ -0,0 +1,546 @@
+/******************************************************************************
+ * @brief Implements the RecordingTranscoder class.
+ *
+ * @file RecordingTranscoder.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "RecordingTranscoder.h"
+#include "../../RoveSoCameraServerConstants.h"
+#include "../../RoveSoCameraServerLogging.h"
+
+/// \cond
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Construct a new Recording Transcoder:: Recording Transcoder object.
+ *
+ * @param szRecordingsPath - The folder to look for recordings in. Segments in any cameras folder under it are re-encoded.
+ * @param stEncoderSettings - The encoder settings to re-encode with. Threads are always set to 1.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+RecordingTranscoder::RecordingTranscoder(const std::string& szRecordingsPath, const FFmpegRecordingMuxer::EncoderSettings& stEncoderSettings)
+{
+    // Initialize member variables.
+    m_szRecordingsPath           = szRecordingsPath;
+    m_stEncoderSettings          = stEncoderSettings;
+    m_stEncoderSettings.nThreads = 1;
+    m_unLastTotalTicks           = 0;
+    m_unLastBusyTicks            = 0;
+    m_nLastThreadCPUTime         = 0;
+    m_tmIdleSince                = std::chrono::steady_clock::now();
+    m_tmLastLoadCheck            = std::chrono::steady_clock::now();
+    m_tmNextScan                 = std::chrono::steady_clock::now();
+    m_unTranscodedSegments       = 0;
+    m_unSavedBytes               = 0;
+
+    // Set max IPS of the ThreadedContinuousCode method. Each iteration re-encodes at most one segment.
+    this->SetMainThreadIPSLimit(1);
+}
+
+/******************************************************************************
+ * @brief Destroy the Recording Transcoder:: Recording Transcoder object. A segment
+ *      that is being re-encoded is left as it was.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+RecordingTranscoder::~RecordingTranscoder()
+{
+    // Signal and wait for the transcoder thread to stop.
+    this->RequestStop();
+    this->Join();
+}
+
+/******************************************************************************
+ * @brief Mutator for the recording files that are still being written. They are
+ *      never re-encoded.
+ *
+ * @param setOpenSegments - The normalized paths of the open recording files.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingTranscoder::SetOpenSegments(const std::unordered_set<std::string>& setOpenSegments)
+{
+    // Acquire lock on open segments.
+    std::lock_guard<std::mutex> lkOpenSegmentsLock(m_muOpenSegmentsMutex);
+    m_setOpenSegments = setOpenSegments;
+}
+
+/******************************************************************************
+ * @brief Accessor for the number of segments that have been re-encoded.
+ *
+ * @return uint64_t - The number of segments replaced by a smaller file.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+uint64_t RecordingTranscoder::GetTranscodedSegments() const
+{
+    // Return member variable value.
+    return m_unTranscodedSegments;
+}
+
+/******************************************************************************
+ * @brief Accessor for the disk space freed by re-encoding.
+ *
+ * @return uint64_t - The number of bytes saved across every re-encoded segment.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+uint64_t RecordingTranscoder::GetSavedBytes() const
+{
+    // Return member variable value.
+    return m_unSavedBytes;
+}
+
+/******************************************************************************
+ * @brief This code will run continuously in a separate thread. Once the CPU has
+ *      been idle for long enough, the oldest finished segment that hasn't been
+ *      re-encoded yet is re-encoded.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingTranscoder::ThreadedContinuousCode()
+{
+    // Wait for the CPU to be idle. This returns early if the thread is stopping.
+    if (!this->WaitForIdle())
+    {
+        return;
+    }
+
+    // Check if it's time to look for segments. New segments only finish every so often, so don't scan the disk every second.
+    if (std::chrono::steady_clock::now() < m_tmNextScan)
+    {
+        return;
+    }
+    std::string szSegmentPath = this->FindNextSegment();
+    if (szSegmentPath.empty())
+    {
+        m_tmNextScan = std::chrono::steady_clock::now() + std::chrono::seconds(constants::RECORDER_RETENTION_CHECK_INTERVAL);
+        return;
+    }
+
+    // Re-encode the segment.
+    this->TranscodeSegment(szSegmentPath);
+}
+
+/******************************************************************************
+ * @brief This method holds the code that is ran in the thread pool started by
+ *      the ThreadedLinearCode() method. It currently does nothing and is not
+ *      needed in the current implementation of the RecordingTranscoder.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void RecordingTranscoder::PooledLinearCode() {}
+
+/******************************************************************************
+ * @brief Measure how busy the CPU has been since the last call, not counting the
+ *      CPU time used by this thread. The decoder and encoder run single threaded
+ *      on this thread, so the result is the load from everything else: capture,
+ *      streaming, recording and any other process.
+ *
+ * @return double - The fraction of all CPU time that was used, from 0 to 1. The first call returns 1.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+double RecordingTranscoder::SampleCPULoad()
+{
+    // Read the time every CPU has spent in each state. user nice system idle iowait irq softirq steal.
+    std::ifstream fStatFile("/proc/stat");
+    std::string szCPULabel;
+    uint64_t aTicks[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    fStatFile >> szCPULabel;
+    for (uint64_t& unTicks : aTicks)
+    {
+        fStatFile >> unTicks;
+    }
+    if (!fStatFile || szCPULabel != "cpu")
+    {
+        return 1.0;
+    }
+    uint64_t unTotalTicks = 0;
+    for (const uint64_t unTicks : aTicks)
+    {
+        unTotalTicks += unTicks;
+    }
+    uint64_t unBusyTicks = unTotalTicks - aTicks[3] - aTicks[4];
+
+    // Get the CPU time used by this thread.
+    timespec stThreadTime;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &stThreadTime);
+    int64_t nThreadCPUTime = static_cast<int64_t>(stThreadTime.tv_sec) * 1000000000 + stThreadTime.tv_nsec;
+
+    // Work out the load since the last sample.
+    double dLoad = 1.0;
+    if (m_unLastTotalTicks != 0 && unTotalTicks > m_unLastTotalTicks)
+    {
+        double dTotalTicks  = static_cast<double>(unTotalTicks - m_unLastTotalTicks);
+        double dBusyTicks   = static_cast<double>(unBusyTicks - m_unLastBusyTicks);
+        double dThreadTicks = (nThreadCPUTime - m_nLastThreadCPUTime) * static_cast<double>(sysconf(_SC_CLK_TCK)) / 1000000000.0;
+        dLoad               = std::clamp((dBusyTicks - dThreadTicks) / dTotalTicks, 0.0, 1.0);
+    }
+    m_unLastTotalTicks   = unTotalTicks;
+    m_unLastBusyTicks    = unBusyTicks;
+    m_nLastThreadCPUTime = nThreadCPUTime;
+    m_tmLastLoadCheck    = std::chrono::steady_clock::now();
+
+    return dLoad;
+}
+
+/******************************************************************************
+ * @brief Wait until the CPU load has stayed under RECORDER_TRANSCODE_MAX_CPU_LOAD
+ *      for RECORDER_TRANSCODE_IDLE_TIME seconds.
+ *
+ * @return true - The CPU is idle.
+ * @return false - The thread was asked to stop while waiting.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool RecordingTranscoder::WaitForIdle()
+{
+    // Keep checking the load until it has been low for long enough.
+    while (this->GetThreadState() != AutonomyThreadState::eStopping)
+    {
+        // Check the load. Anything over the max starts the idle time over.
+        if (this->SampleCPULoad() > constants::RECORDER_TRANSCODE_MAX_CPU_LOAD)
+        {
+            m_tmIdleSince = std::chrono::steady_clock::now();
+        }
+        else if (std::chrono::steady_clock::now() - m_tmIdleSince >= std::chrono::seconds(constants::RECORDER_TRANSCODE_IDLE_TIME))
+        {
+            return true;
+        }
+
+        // Wait before checking again.
+        std::this_thread::sleep_for(std::chrono::milliseconds(constants::RECORDER_TRANSCODE_LOAD_CHECK_INTERVAL));
+    }
+
+    return false;
+}
+
+/******************************************************************************
+ * @brief Find the oldest recording segment that is finished and hasn't been
+ *      re-encoded. Temporary files left by a re-encode that never finished, like
+ *      after a crash, are deleted along the way.
+ *
+ * @return std::string - The path of the segment, or an empty string if there is nothing to do.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+std::string RecordingTranscoder::FindNextSegment()
+{
+    // Get the files that are still being written.
+    std::unique_lock<std::mutex> lkOpenSegmentsLock(m_muOpenSegmentsMutex);
+    std::unordered_set<std::string> setOpenSegments = m_setOpenSegments;
+    lkOpenSegmentsLock.unlock();
+
+    // Look through every camera recording. Error codes are used so a file disappearing mid-scan doesn't throw.
+    std::unordered_set<std::string> setSeenSegments;
+    std::filesystem::path szOldestPath;
+    std::filesystem::file_time_type tmOldestWriteTime = std::filesystem::file_time_type::max();
+    std::filesystem::file_time_type tmNewestAllowed   = std::filesystem::file_time_type::clock::now() - std::chrono::seconds(constants::RECORDER_TRANSCODE_MIN_AGE);
+    std::error_code errCode;
+    for (std::filesystem::recursive_directory_iterator itFile(m_szRecordingsPath, errCode), itEnd; !errCode && itFile != itEnd; itFile.increment(errCode))
+    {
+        // Check if this is a file in a cameras or transcode folder.
+        std::string szFolderName = itFile->path().parent_path().filename().string();
+        if (!itFile->is_regular_file(errCode) || (szFolderName != "cameras" && szFolderName != "transcode"))
+        {
+            errCode.clear();
+            continue;
+        }
+        std::filesystem::path szPath = itFile->path().lexically_normal();
+
+        // Delete temporary files. Only this thread writes them, and it isn't writing one right now.
+        if (szFolderName == "transcode")
+        {
+            std::filesystem::remove(szPath, errCode);
+            errCode.clear();
+            continue;
+        }
+
+        // Check if this is a finished segment that hasn't been looked at yet.
+        if (szPath.extension() != ".mkv")
+        {
+            continue;
+        }
+        setSeenSegments.insert(szPath.string());
+        if (setOpenSegments.count(szPath.string()) || m_setFinishedSegments.count(szPath.string()))
+        {
+            continue;
+        }
+        // Files that were written recently may still be in the hands of the writer.
+        std::filesystem::file_time_type tmWriteTime = itFile->last_write_time(errCode);
+        if (!errCode && tmWriteTime <= tmNewestAllowed && tmWriteTime < tmOldestWriteTime)
+        {
+            tmOldestWriteTime = tmWriteTime;
+            szOldestPath      = szPath;
+        }
+        errCode.clear();
+    }
+
+    // Forget segments that were deleted, so the set doesn't grow for as long as the server runs. Only a full scan can tell.
+    if (!errCode)
+    {
+        std::erase_if(m_setFinishedSegments, [&setSeenSegments](const std::string& szSegmentPath) { return !setSeenSegments.count(szSegmentPath); });
+    }
+
+    return szOldestPath.string();
+}
+
+/******************************************************************************
+ * @brief Re-encode a recording segment and replace it with the result. Frames keep
+ *      their original timestamps and capture times. The work pauses whenever the CPU
+ *      load goes over the max, and is thrown away if the thread is stopped.
+ *
+ * @param szSegmentPath - The segment to re-encode.
+ * @return true - The segment was replaced by a smaller file.
+ * @return false - The segment was left as it was.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool RecordingTranscoder::TranscodeSegment(const std::string& szSegmentPath)
+{
+    // The tag put on files that have been re-encoded.
+    constexpr const char* TRANSCODED_METADATA_KEY     = "ROVESO_TRANSCODED";
+    std::chrono::steady_clock::time_point tmStartTime = std::chrono::steady_clock::now();
+
+    // Open the segment. Only the header is read.
+    AVFormatContext* pInputCtx = nullptr;
+    if (avformat_open_input(&pInputCtx, szSegmentPath.c_str(), nullptr, nullptr) < 0)
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger, "RecordingTranscoder: Could not open {}. Skipping it.", szSegmentPath);
+        m_setFinishedSegments.insert(szSegmentPath);
+        return false;
+    }
+    // Skip files that were already re-encoded, and anything but a single video stream, like a camera group recording.
+    if (av_dict_get(pInputCtx->metadata, TRANSCODED_METADATA_KEY, nullptr, 0) || pInputCtx->nb_streams != 1 ||
+        pInputCtx->streams[0]->codecpar->codec_type != AVMEDIA_TYPE_VIDEO)
+    {
+        avformat_close_input(&pInputCtx);
+        m_setFinishedSegments.insert(szSegmentPath);
+        return false;
+    }
+    AVStream* pInputStream = pInputCtx->streams[0];
+
+    // Set up a single threaded decoder.
+    const AVCodec* pDecoder     = avcodec_find_decoder(pInputStream->codecpar->codec_id);
+    AVCodecContext* pDecoderCtx = pDecoder ? avcodec_alloc_context3(pDecoder) : nullptr;
+    bool bDecoderOpen           = false;
+    if (pDecoderCtx && avcodec_parameters_to_context(pDecoderCtx, pInputStream->codecpar) >= 0)
+    {
+        pDecoderCtx->thread_count = 1;
+        bDecoderOpen              = avcodec_open2(pDecoderCtx, pDecoder, nullptr) >= 0;
+    }
+    if (!bDecoderOpen)
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger, "RecordingTranscoder: Could not decode {}. Skipping it.", szSegmentPath);
+        avcodec_free_context(&pDecoderCtx);
+        avformat_close_input(&pInputCtx);
+        m_setFinishedSegments.insert(szSegmentPath);
+        return false;
+    }
+
+    // Load the capture times from the segment's frame index, if it has one.
+    std::vector<frameindex::Record> vRecords;
+    AVRational stIndexTimeBase = pInputStream->time_base;
+    std::ifstream fIndexFile(szSegmentPath + frameindex::FRAMEINDEX_EXTENSION, std::ios::binary);
+    frameindex::FileHeader stHeader;
+    if (fIndexFile && fIndexFile.read(reinterpret_cast<char*>(&stHeader), sizeof(stHeader)) && stHeader.unMagic == frameindex::FRAMEINDEX_MAGIC &&
+        stHeader.unVersion == frameindex::FRAMEINDEX_VERSION && stHeader.unRecordSize == sizeof(frameindex::Record) && stHeader.nTimeBaseNum > 0 &&
+        stHeader.nTimeBaseDen > 0)
+    {
+        // Read every record. A record cut off by a crash is ignored.
+        stIndexTimeBase = {stHeader.nTimeBaseNum, stHeader.nTimeBaseDen};
+        frameindex::Record stRecord;
+        while (fIndexFile.read(reinterpret_cast<char*>(&stRecord), sizeof(stRecord)))
+        {
+            vRecords.push_back(stRecord);
+        }
+    }
+    fIndexFile.close();
+
+    // Open the temporary output in a transcode folder next to the cameras folder, so the disk budget never sees it. It's on the
+    // same filesystem, so it can be renamed over the segment. It gets a new index if the segment had one.
+    std::filesystem::path szTemporaryPath = std::filesystem::path(szSegmentPath).parent_path().parent_path() / "transcode";
+    std::error_code errCode;
+    std::filesystem::create_directories(szTemporaryPath, errCode);
+    szTemporaryPath /= std::filesystem::path(szSegmentPath).filename().replace_extension(".transcode.mkv");
+    FFmpegRecordingMuxer FFmpegMuxer;
+    if (!vRecords.empty())
+    {
+        FFmpegMuxer.EnableFrameIndex();
+    }
+    FFmpegMuxer.SetMetadata(TRANSCODED_METADATA_KEY, m_stEncoderSettings.szCodecName + " " + m_stEncoderSettings.szPreset);
+    cv::Size cvFrameSize(pDecoderCtx->width, pDecoderCtx->height);
+    if (cvFrameSize.width <= 0 || cvFrameSize.height <= 0 || !FFmpegMuxer.Open(szTemporaryPath.string(), cvFrameSize, m_stEncoderSettings))
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger, "RecordingTranscoder: Could not open a re-encode of {}. Skipping it.", szSegmentPath);
+        avcodec_free_context(&pDecoderCtx);
+        avformat_close_input(&pInputCtx);
+        m_setFinishedSegments.insert(szSegmentPath);
+        return false;
+    }
+
+    // Decode and re-encode every frame. A frame the recorder couldn't have written abandons the re-encode.
+    bool bFailed            = false;
+    AVPacket* pPacket       = av_packet_alloc();
+    AVFrame* pDecodedFrame  = av_frame_alloc();
+    int nFrameBufferSize    = av_image_get_buffer_size(AV_PIX_FMT_YUV420P, cvFrameSize.width, cvFrameSize.height, 1);
+    auto WriteDecodedFrames = [&]() {
+        while (avcodec_receive_frame(pDecoderCtx, pDecodedFrame) >= 0)
+        {
+            // Check that the frame is planar YUV 4:2:0 at the size of the recording, which is all the recorder writes.
+            if ((pDecodedFrame->format != AV_PIX_FMT_YUV420P && pDecodedFrame->format != AV_PIX_FMT_YUVJ420P) || pDecodedFrame->width != cvFrameSize.width ||
+                pDecodedFrame->height != cvFrameSize.height || nFrameBufferSize != cvFrameSize.width * cvFrameSize.height * 3 / 2)
+            {
+                av_frame_unref(pDecodedFrame);
+                bFailed = true;
+                return;
+            }
+
+            // Find the capture time of the frame. Records are in timestamp order, so use the last one at or before the frame and add the difference.
+            int64_t nTimestamp   = av_rescale_q(pDecodedFrame->best_effort_timestamp, pInputStream->time_base, stIndexTimeBase);
+            int64_t nCaptureTime = av_rescale_q(nTimestamp, stIndexTimeBase, {1, 1000000});
+            if (!vRecords.empty())
+            {
+                auto itRecord = std::upper_bound(vRecords.begin(),
+                                                 vRecords.end(),
+                                                 nTimestamp,
+                                                 [](const int64_t nTime, const frameindex::Record& stRecord) { return nTime < stRecord.nPTS; });
+                if (itRecord != vRecords.begin())
+                {
+                    --itRecord;
+                }
+                nCaptureTime = itRecord->nCaptureTime + av_rescale_q(nTimestamp - itRecord->nPTS, stIndexTimeBase, {1, 1000000});
+            }
+
+            // Copy the frame into a new Mat. The encoder may keep a reference to it, so a Mat is never reused.
+            cv::Mat cvFrame(cvFrameSize.height * 3 / 2, cvFrameSize.width, CV_8UC1);
+            av_image_copy_to_buffer(cvFrame.data,
+                                    nFrameBufferSize,
+                                    pDecodedFrame->data,
+                                    pDecodedFrame->linesize,
+                                    AV_PIX_FMT_YUV420P,
+                                    cvFrameSize.width,
+                                    cvFrameSize.height,
+                                    1);
+            av_frame_unref(pDecodedFrame);
+            FFmpegMuxer.WriteFrame(cvFrame, PIXEL_FORMATS::eYUV420, std::chrono::system_clock::time_point(std::chrono::microseconds(nCaptureTime)));
+        }
+    };
+    while (!bFailed && av_read_frame(pInputCtx, pPacket) >= 0)
+    {
+        // Decode the packet and write the frames it produced.
+        if (avcodec_send_packet(pDecoderCtx, pPacket) >= 0)
+        {
+            WriteDecodedFrames();
+        }
+        av_packet_unref(pPacket);
+
+        // Stop right away if the thread is stopping.
+        if (this->GetThreadState() == AutonomyThreadState::eStopping)
+        {
+            bFailed = true;
+        }
+        // Check the load every so often, and pause until the CPU is idle again if something else needs it.
+        else if (std::chrono::steady_clock::now() - m_tmLastLoadCheck >= std::chrono::milliseconds(constants::RECORDER_TRANSCODE_LOAD_CHECK_INTERVAL) &&
+                 this->SampleCPULoad() > constants::RECORDER_TRANSCODE_MAX_CPU_LOAD)
+        {
+            // Submit logger message.
+            LOG_DEBUG(logging::g_qSharedLogger, "RecordingTranscoder: CPU is busy, pausing the re-encode of {}.", szSegmentPath);
+            m_tmIdleSince = std::chrono::steady_clock::now();
+            bFailed       = !this->WaitForIdle();
+        }
+    }
+    // Flush the frames still in the decoder.
+    if (!bFailed && avcodec_send_packet(pDecoderCtx, nullptr) >= 0)
+    {
+        WriteDecodedFrames();
+    }
+
+    // Finish the new file and clean up.
+    FFmpegMuxer.Close();
+    av_frame_free(&pDecodedFrame);
+    av_packet_free(&pPacket);
+    avcodec_free_context(&pDecoderCtx);
+    avformat_close_input(&pInputCtx);
+
+    // Check that the new file is worth keeping.
+    std::string szTemporaryIndexPath = szTemporaryPath.string() + frameindex::FRAMEINDEX_EXTENSION;
+    std::string szSegmentIndexPath   = szSegmentPath + frameindex::FRAMEINDEX_EXTENSION;
+    uintmax_t unOriginalBytes        = std::filesystem::file_size(szSegmentPath, errCode);
+    uintmax_t unNewBytes             = errCode ? 0 : std::filesystem::file_size(szTemporaryPath, errCode);
+    if (bFailed || errCode || unNewBytes == 0 || unNewBytes >= unOriginalBytes)
+    {
+        // Only try the segment again if the re-encode was interrupted by a stop.
+        if (this->GetThreadState() != AutonomyThreadState::eStopping)
+        {
+            m_setFinishedSegments.insert(szSegmentPath);
+        }
+        std::filesystem::remove(szTemporaryPath, errCode);
+        std::filesystem::remove(szTemporaryIndexPath, errCode);
+        return false;
+    }
+
+    // Keep the original modification times, so the disk budget still deletes segments in the order they were recorded.
+    std::filesystem::file_time_type tmWriteTime = std::filesystem::last_write_time(szSegmentPath, errCode);
+    if (!errCode)
+    {
+        std::filesystem::last_write_time(szTemporaryPath, tmWriteTime, errCode);
+        std::filesystem::last_write_time(szTemporaryIndexPath, tmWriteTime, errCode);
+    }
+
+    // Swap the new file in. The old index is removed first, so the new file is never paired with the old frame positions.
+    std::filesystem::remove(szSegmentIndexPath, errCode);
+    std::filesystem::rename(szTemporaryPath, szSegmentPath, errCode);
+    if (errCode)
+    {
+        // Submit logger message.
+        LOG_WARNING(logging::g_qSharedLogger, "RecordingTranscoder: Could not replace {} with its re-encode.", szSegmentPath);
+        std::filesystem::remove(szTemporaryPath, errCode);
+        std::filesystem::remove(szTemporaryIndexPath, errCode);
+        m_setFinishedSegments.insert(szSegmentPath);
+        return false;
+    }
+    std::filesystem::rename(szTemporaryIndexPath, szSegmentIndexPath, errCode);
+    m_setFinishedSegments.insert(szSegmentPath);
+
+    // Update statistics.
+    ++m_unTranscodedSegments;
+    m_unSavedBytes += unOriginalBytes - unNewBytes;
+    // Submit logger message.
+    LOG_INFO(logging::g_qSharedLogger,
+             "RecordingTranscoder: Re-encoded {} from {:.1f} MB to {:.1f} MB in {:.1f} s.",
+             szSegmentPath,
+             unOriginalBytes / (1024.0 * 1024.0),
+             unNewBytes / (1024.0 * 1024.0),
+             std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStartTime).count());
+
+    return true;
+}
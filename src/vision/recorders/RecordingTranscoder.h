@@ -0,0 +1,101 @@
+/******************************************************************************
+ * @brief Defines the RecordingTranscoder class.
+ *
+ * @file RecordingTranscoder.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef RECORDING_TRANSCODER_H
+#define RECORDING_TRANSCODER_H
+
+#include "../../interfaces/AutonomyThread.hpp"
+#include "FFmpegRecordingMuxer.h"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The RecordingTranscoder class re-encodes finished recording segments in
+ *      the background with slower, smaller encoder settings, so recordings can be
+ *      made with the cheapest encode while driving and still be small by the time
+ *      they are pulled off the rover. It only works while the rest of the system is
+ *      idle. The CPU load is measured from /proc/stat without counting this thread, and
+ *      re-encoding only starts once it has stayed under a threshold for a while.
+ *
+ *      The thread is given RECORDER_TRANSCODE_PRIORITY, and the decoder and encoder run
+ *      single threaded on it, so it yields to capture and streaming. The load is checked
+ *      again every few frames, and re-encoding pauses as soon as they pick back up.
+ *
+ *      Each segment is written to a temporary file in a transcode folder next to the
+ *      cameras folder, so the disk budget never deletes it, with a new frame index
+ *      holding the original capture times, and then renamed over the original. A
+ *      segment is only ever replaced by a finished, smaller file. Re-encoded files are
+ *      tagged, so they are never re-encoded twice, even by a later run.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class RecordingTranscoder : public AutonomyThread<void>
+{
+    public:
+        /////////////////////////////////////////
+        // Declare public class methods and variables.
+        /////////////////////////////////////////
+
+        RecordingTranscoder(const std::string& szRecordingsPath, const FFmpegRecordingMuxer::EncoderSettings& stEncoderSettings);
+        ~RecordingTranscoder();
+
+        /////////////////////////////////////////
+        // Mutators.
+        /////////////////////////////////////////
+
+        void SetOpenSegments(const std::unordered_set<std::string>& setOpenSegments);
+
+        /////////////////////////////////////////
+        // Accessors.
+        /////////////////////////////////////////
+
+        uint64_t GetTranscodedSegments() const;
+        uint64_t GetSavedBytes() const;
+
+    private:
+        /////////////////////////////////////////
+        // Declare private methods.
+        /////////////////////////////////////////
+
+        void ThreadedContinuousCode() override;
+        void PooledLinearCode() override;
+        double SampleCPULoad();
+        bool WaitForIdle();
+        std::string FindNextSegment();
+        bool TranscodeSegment(const std::string& szSegmentPath);
+
+        /////////////////////////////////////////
+        // Declare private class member variables.
+        /////////////////////////////////////////
+
+        std::string m_szRecordingsPath;
+        FFmpegRecordingMuxer::EncoderSettings m_stEncoderSettings;
+        std::unordered_set<std::string> m_setOpenSegments;
+        std::mutex m_muOpenSegmentsMutex;
+        std::unordered_set<std::string> m_setFinishedSegments;
+        uint64_t m_unLastTotalTicks;
+        uint64_t m_unLastBusyTicks;
+        int64_t m_nLastThreadCPUTime;
+        std::chrono::steady_clock::time_point m_tmIdleSince;
+        std::chrono::steady_clock::time_point m_tmLastLoadCheck;
+        std::chrono::steady_clock::time_point m_tmNextScan;
+        std::atomic<uint64_t> m_unTranscodedSegments;
+        std::atomic<uint64_t> m_unSavedBytes;
+};
+#endif
@@ -0,0 +1,452 @@
+/******************************************************************************
+ * @brief Implements the ReplayBuffer class.
+ *
+ * @file ReplayBuffer.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "ReplayBuffer.h"
+#include "../../RoveSoCameraServerLogging.h"
+
+/// \cond
+#include <algorithm>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Construct a new Replay Buffer:: Replay Buffer object.
+ *
+ * @param nHistorySeconds - The number of seconds of packets to keep before an event.
+ * @param siMaxBytes - The max number of bytes of packets to keep. Older GOPs are dropped first.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+ReplayBuffer::ReplayBuffer(const int nHistorySeconds, const size_t siMaxBytes)
+{
+    // Initialize member variables.
+    m_nHistorySeconds      = nHistorySeconds;
+    m_siMaxBytes           = siMaxBytes;
+    m_pCodecParameters     = avcodec_parameters_alloc();
+    m_stTimeBase           = {1, 1000000};
+    m_siHistoryBytes       = 0;
+    m_siEventBytes         = 0;
+    m_bEventActive         = false;
+    m_nEventEndTimestamp   = AV_NOPTS_VALUE;
+    m_pEventFormatCtx      = nullptr;
+    m_pEventStream         = nullptr;
+    m_nEventStartTimestamp = AV_NOPTS_VALUE;
+}
+
+/******************************************************************************
+ * @brief Destroy the Replay Buffer:: Replay Buffer object. An event that is still
+ *      being saved is finished with the packets received so far.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+ReplayBuffer::~ReplayBuffer()
+{
+    // End any active event.
+    std::unique_lock<std::mutex> lkReplayLock(m_muReplayMutex);
+    if (m_bEventActive)
+    {
+        m_dqEventJobs.push_back({nullptr, "", true});
+        m_bEventActive = false;
+    }
+    lkReplayLock.unlock();
+
+    // Signal and wait for event writer thread to stop.
+    this->RequestStop();
+    m_cdEventJobsCondition.notify_all();
+    this->Join();
+
+    // Write whatever the thread didn't get to.
+    while (!m_dqEventJobs.empty())
+    {
+        this->ProcessEventJob(m_dqEventJobs.front());
+        m_dqEventJobs.pop_front();
+    }
+    this->CloseEventFile();
+
+    // Free the history.
+    for (AVPacket*& pPacket : m_dqHistory)
+    {
+        av_packet_free(&pPacket);
+    }
+    m_dqHistory.clear();
+    avcodec_parameters_free(&m_pCodecParameters);
+}
+
+/******************************************************************************
+ * @brief Store the stream parameters of the encoder the packets come from. Must
+ *      be called once the encoder is open and before any packets are added.
+ *
+ * @param pCodecCtx - The encoder producing the packets.
+ * @return true - The parameters were stored.
+ * @return false - The parameters could not be copied.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool ReplayBuffer::SetStreamParameters(const AVCodecContext* pCodecCtx)
+{
+    // Acquire lock on replay buffer.
+    std::lock_guard<std::mutex> lkReplayLock(m_muReplayMutex);
+    // Copy the codec headers and time base. Event files are written with these.
+    m_stTimeBase = pCodecCtx->time_base;
+    return m_pCodecParameters && avcodec_parameters_from_context(m_pCodecParameters, pCodecCtx) >= 0;
+}
+
+/******************************************************************************
+ * @brief Add an encoded packet to the history. If an event is being saved, the
+ *      packet is also queued to be written. The packet is referenced, not copied.
+ *
+ * @param pPacket - The packet from the encoder, in the encoder's time base.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void ReplayBuffer::AddPacket(const AVPacket* pPacket)
+{
+    // Acquire lock on replay buffer.
+    std::unique_lock<std::mutex> lkReplayLock(m_muReplayMutex);
+
+    // Check if an event is being saved.
+    if (m_bEventActive)
+    {
+        // Check if the event is over.
+        if (pPacket->pts > m_nEventEndTimestamp)
+        {
+            m_dqEventJobs.push_back({nullptr, "", true});
+            m_bEventActive = false;
+        }
+        else
+        {
+            AVPacket* pEventPacket = av_packet_clone(pPacket);
+            if (pEventPacket)
+            {
+                m_siEventBytes += pEventPacket->size;
+                m_dqEventJobs.push_back({pEventPacket, "", false});
+            }
+        }
+        lkReplayLock.unlock();
+        m_cdEventJobsCondition.notify_one();
+        lkReplayLock.lock();
+    }
+
+    // The history has to start on a keyframe, so packets are ignored until one arrives.
+    if (m_dqHistory.empty() && !(pPacket->flags & AV_PKT_FLAG_KEY))
+    {
+        return;
+    }
+
+    // Add the packet to the history.
+    AVPacket* pHistoryPacket = av_packet_clone(pPacket);
+    if (!pHistoryPacket)
+    {
+        return;
+    }
+    m_siHistoryBytes += pHistoryPacket->size;
+    m_dqHistory.push_back(pHistoryPacket);
+
+    // Drop old packets.
+    this->TrimHistory();
+}
+
+/******************************************************************************
+ * @brief Save the history and the packets that follow for a while to a file. If an
+ *      event is already being saved, it is extended instead.
+ *
+ * @param szOutputPath - The file to save the event to.
+ * @param nPostEventSeconds - How many seconds after the trigger to keep saving.
+ * @return true - The event was started or extended.
+ * @return false - There is nothing to save yet.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool ReplayBuffer::Trigger(const std::string& szOutputPath, const int nPostEventSeconds)
+{
+    // Acquire lock on replay buffer.
+    std::unique_lock<std::mutex> lkReplayLock(m_muReplayMutex);
+    // Check if there are any packets yet.
+    if (m_dqHistory.empty())
+    {
+        return false;
+    }
+
+    // Find when the event should end.
+    int64_t nEventEndTimestamp = m_dqHistory.back()->pts + av_rescale_q(static_cast<int64_t>(nPostEventSeconds) * 1000000, {1, 1000000}, m_stTimeBase);
+
+    // Check if an event is already being saved.
+    if (m_bEventActive)
+    {
+        // Extend the current event.
+        m_nEventEndTimestamp = std::max(m_nEventEndTimestamp, nEventEndTimestamp);
+        return true;
+    }
+
+    // Start a new event file with everything in the history.
+    m_dqEventJobs.push_back({nullptr, szOutputPath, false});
+    for (const AVPacket* pHistoryPacket : m_dqHistory)
+    {
+        AVPacket* pEventPacket = av_packet_clone(pHistoryPacket);
+        if (pEventPacket)
+        {
+            m_siEventBytes += pEventPacket->size;
+            m_dqEventJobs.push_back({pEventPacket, "", false});
+        }
+    }
+    m_bEventActive       = true;
+    m_nEventEndTimestamp = nEventEndTimestamp;
+    lkReplayLock.unlock();
+
+    // Wake up event writer thread.
+    m_cdEventJobsCondition.notify_one();
+    return true;
+}
+
+/******************************************************************************
+ * @brief Accessor for the memory used by this replay buffer. Includes the history
+ *      and any event packets waiting to be written. Packets in both share their data,
+ *      so this is an upper bound.
+ *
+ * @return size_t - The number of bytes of packet data held.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+size_t ReplayBuffer::GetMemoryUsage()
+{
+    // Acquire lock on replay buffer.
+    std::lock_guard<std::mutex> lkReplayLock(m_muReplayMutex);
+    // Return the packet data held.
+    return m_siHistoryBytes + m_siEventBytes;
+}
+
+/******************************************************************************
+ * @brief Accessor for how much time the history currently covers.
+ *
+ * @return double - The number of seconds between the oldest and newest packet.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+double ReplayBuffer::GetBufferedSeconds()
+{
+    // Acquire lock on replay buffer.
+    std::lock_guard<std::mutex> lkReplayLock(m_muReplayMutex);
+    // Check if there is any history.
+    if (m_dqHistory.empty())
+    {
+        return 0.0;
+    }
+
+    // Return the span of the history.
+    return (m_dqHistory.back()->pts - m_dqHistory.front()->pts) * av_q2d(m_stTimeBase);
+}
+
+/******************************************************************************
+ * @brief Accessor for whether an event is being saved.
+ *
+ * @return true - Packets are being saved to an event file.
+ * @return false - No event is active.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+bool ReplayBuffer::GetIsSavingEvent()
+{
+    // Acquire lock on replay buffer.
+    std::lock_guard<std::mutex> lkReplayLock(m_muReplayMutex);
+    // Return member variable value.
+    return m_bEventActive;
+}
+
+/******************************************************************************
+ * @brief This code will run continuously in a separate thread. Queued event
+ *      packets are written to the event file.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void ReplayBuffer::ThreadedContinuousCode()
+{
+    // Acquire lock on replay buffer.
+    std::unique_lock<std::mutex> lkReplayLock(m_muReplayMutex);
+    // Wait for a job. Time out every so often so a stop request is noticed.
+    if (!m_cdEventJobsCondition.wait_for(lkReplayLock,
+                                         std::chrono::milliseconds(100),
+                                         [this] { return !m_dqEventJobs.empty() || this->GetThreadState() == AutonomyThreadState::eStopping; }) ||
+        m_dqEventJobs.empty())
+    {
+        return;
+    }
+
+    // Take the oldest job out of the queue.
+    EventJob stEventJob = std::move(m_dqEventJobs.front());
+    m_dqEventJobs.pop_front();
+    if (stEventJob.pPacket)
+    {
+        m_siEventBytes -= stEventJob.pPacket->size;
+    }
+    lkReplayLock.unlock();
+
+    // Write it.
+    this->ProcessEventJob(stEventJob);
+}
+
+/******************************************************************************
+ * @brief This method holds the code that is ran in the thread pool started by
+ *      the ThreadedLinearCode() method. It currently does nothing and is not
+ *      needed in the current implementation of the ReplayBuffer.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void ReplayBuffer::PooledLinearCode() {}
+
+/******************************************************************************
+ * @brief Drop the oldest GOPs from the history while what is left still covers the
+ *      history length, or while the history is over its memory limit. Must be called
+ *      with the replay mutex held.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void ReplayBuffer::TrimHistory()
+{
+    // Find the oldest time that still needs to be kept.
+    int64_t nHistoryDuration = av_rescale_q(static_cast<int64_t>(m_nHistorySeconds) * 1000000, {1, 1000000}, m_stTimeBase);
+    int64_t nOldestNeeded    = m_dqHistory.back()->pts - nHistoryDuration;
+
+    // Drop one GOP at a time.
+    while (!m_dqHistory.empty())
+    {
+        // Find the start of the second GOP.
+        size_t siNextKeyframe = 1;
+        while (siNextKeyframe < m_dqHistory.size() && !(m_dqHistory[siNextKeyframe]->flags & AV_PKT_FLAG_KEY))
+        {
+            ++siNextKeyframe;
+        }
+
+        // Check if the first GOP can be dropped.
+        bool bOverMemory = m_siHistoryBytes > m_siMaxBytes;
+        bool bHasNextGOP = siNextKeyframe < m_dqHistory.size();
+        if (!bOverMemory && !(bHasNextGOP && m_dqHistory[siNextKeyframe]->pts <= nOldestNeeded))
+        {
+            break;
+        }
+
+        // Drop the first GOP. If it's the only one and it's over the limit, everything goes and the history restarts at the next keyframe.
+        for (size_t siIter = 0; siIter < siNextKeyframe; ++siIter)
+        {
+            m_siHistoryBytes -= m_dqHistory.front()->size;
+            av_packet_free(&m_dqHistory.front());
+            m_dqHistory.pop_front();
+        }
+    }
+}
+
+/******************************************************************************
+ * @brief Open, write to or close the event file as the job asks.
+ *
+ * @param stEventJob - The job to do. The packet is freed.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void ReplayBuffer::ProcessEventJob(EventJob& stEventJob)
+{
+    // Check if a new event file should be opened.
+    if (!stEventJob.szOutputPath.empty())
+    {
+        // Finish any previous file.
+        this->CloseEventFile();
+        m_szEventPath          = stEventJob.szOutputPath;
+        m_nEventStartTimestamp = AV_NOPTS_VALUE;
+
+        // Create the file. The packets are already encoded, so the stream just copies the encoder's parameters.
+        avformat_alloc_output_context2(&m_pEventFormatCtx, nullptr, nullptr, m_szEventPath.c_str());
+        if (m_pEventFormatCtx)
+        {
+            m_pEventStream = avformat_new_stream(m_pEventFormatCtx, nullptr);
+        }
+        if (!m_pEventStream || avcodec_parameters_copy(m_pEventStream->codecpar, m_pCodecParameters) < 0 ||
+            avio_open(&m_pEventFormatCtx->pb, m_szEventPath.c_str(), AVIO_FLAG_WRITE) < 0)
+        {
+            // Submit logger message.
+            LOG_ERROR(logging::g_qSharedLogger, "ReplayBuffer: Could not create event file {}.", m_szEventPath);
+            this->CloseEventFile();
+        }
+        else
+        {
+            m_pEventStream->time_base = m_stTimeBase;
+            if (avformat_write_header(m_pEventFormatCtx, nullptr) < 0)
+            {
+                // Submit logger message.
+                LOG_ERROR(logging::g_qSharedLogger, "ReplayBuffer: Failed to write header for event file {}.", m_szEventPath);
+                m_pEventStream = nullptr;
+                this->CloseEventFile();
+            }
+        }
+    }
+
+    // Check if there is a packet to write.
+    if (stEventJob.pPacket)
+    {
+        // Check if the event file is open.
+        if (m_pEventStream)
+        {
+            // Timestamps in the event file start at zero.
+            if (m_nEventStartTimestamp == AV_NOPTS_VALUE)
+            {
+                m_nEventStartTimestamp = stEventJob.pPacket->pts;
+            }
+            stEventJob.pPacket->pts -= m_nEventStartTimestamp;
+            stEventJob.pPacket->dts -= m_nEventStartTimestamp;
+            av_packet_rescale_ts(stEventJob.pPacket, m_stTimeBase, m_pEventStream->time_base);
+            stEventJob.pPacket->stream_index = m_pEventStream->index;
+            av_interleaved_write_frame(m_pEventFormatCtx, stEventJob.pPacket);
+        }
+        av_packet_free(&stEventJob.pPacket);
+    }
+
+    // Check if the event is finished.
+    if (stEventJob.bCloseFile && m_pEventFormatCtx)
+    {
+        // Submit logger message.
+        LOG_INFO(logging::g_qSharedLogger, "ReplayBuffer: Saved event to {}.", m_szEventPath);
+        this->CloseEventFile();
+    }
+}
+
+/******************************************************************************
+ * @brief Write the trailer of the event file and close it. Safe to call if no file
+ *      is open.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void ReplayBuffer::CloseEventFile()
+{
+    // Check if there is a file to close.
+    if (!m_pEventFormatCtx)
+    {
+        return;
+    }
+
+    // Finish the file. The trailer is only valid if the header was written.
+    if (m_pEventStream && m_pEventFormatCtx->pb)
+    {
+        av_write_trailer(m_pEventFormatCtx);
+    }
+    avio_closep(&m_pEventFormatCtx->pb);
+    avformat_free_context(m_pEventFormatCtx);
+    m_pEventFormatCtx = nullptr;
+    m_pEventStream    = nullptr;
+}
@@ -0,0 +1,108 @@
+/******************************************************************************
+ * @brief Defines the ReplayBuffer class.
+ *
+ * @file ReplayBuffer.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef REPLAY_BUFFER_H
+#define REPLAY_BUFFER_H
+
+#include "../../interfaces/AutonomyThread.hpp"
+
+/// \cond
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+}
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The ReplayBuffer class keeps the last few seconds of encoded packets from
+ *      a recording in memory, like an instant replay. Packets are only referenced,
+ *      never copied or re-encoded. The history is trimmed a whole GOP at a time, so it
+ *      always starts on a keyframe, and it never grows past a memory limit.
+ *
+ *      When an event is triggered, the history and the packets that follow for a set
+ *      time are written to their own file by this class's thread. Triggering again
+ *      while an event is being saved extends that event instead of starting a new one.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class ReplayBuffer : public AutonomyThread<void>
+{
+    public:
+        /////////////////////////////////////////
+        // Declare public class methods and variables.
+        /////////////////////////////////////////
+
+        ReplayBuffer(const int nHistorySeconds, const size_t siMaxBytes);
+        ~ReplayBuffer();
+        bool SetStreamParameters(const AVCodecContext* pCodecCtx);
+        void AddPacket(const AVPacket* pPacket);
+        bool Trigger(const std::string& szOutputPath, const int nPostEventSeconds);
+
+        /////////////////////////////////////////
+        // Accessors.
+        /////////////////////////////////////////
+
+        size_t GetMemoryUsage();
+        double GetBufferedSeconds();
+        bool GetIsSavingEvent();
+
+    private:
+        /////////////////////////////////////////
+        // Declare private methods.
+        /////////////////////////////////////////
+
+        // Struct used to store a piece of work for the event writer thread.
+        struct EventJob
+        {
+            public:
+                AVPacket* pPacket;           // The packet to write, or nullptr.
+                std::string szOutputPath;    // If not empty, a new event file is opened at this path first.
+                bool bCloseFile;             // Whether the event file should be finished after this job.
+        };
+
+        void ThreadedContinuousCode() override;
+        void PooledLinearCode() override;
+        void TrimHistory();
+        void ProcessEventJob(EventJob& stEventJob);
+        void CloseEventFile();
+
+        /////////////////////////////////////////
+        // Declare private class member variables.
+        /////////////////////////////////////////
+
+        int m_nHistorySeconds;
+        size_t m_siMaxBytes;
+        AVCodecParameters* m_pCodecParameters;
+        AVRational m_stTimeBase;
+        std::deque<AVPacket*> m_dqHistory;
+        size_t m_siHistoryBytes;
+        std::deque<EventJob> m_dqEventJobs;
+        size_t m_siEventBytes;
+        bool m_bEventActive;
+        int64_t m_nEventEndTimestamp;
+        std::mutex m_muReplayMutex;
+        std::condition_variable m_cdEventJobsCondition;
+
+        // Only used by the event writer thread.
+        AVFormatContext* m_pEventFormatCtx;
+        AVStream* m_pEventStream;
+        int64_t m_nEventStartTimestamp;
+        std::string m_szEventPath;
+};
+
+#endif    // REPLAY_BUFFER_H
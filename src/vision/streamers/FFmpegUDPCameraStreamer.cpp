@@ -66,6 +66,9 @@ FFmpegUDPCameraStreamer::FFmpegUDPCameraStreamer(BasicCam* pCamera,
     m_nFrameRate        = frameRate;
     m_nPort             = port;
     m_nPoints           = 0;
+    m_bCameraOffline    = false;
+
+    m_cvRegionOfInterest = cv::Rect2d();
 
     m_dBrightness       = brightness;
     m_dContrast         = contrast;
@@ -184,90 +187,152 @@ FFmpegUDPCameraStreamer::FFmpegUDPCameraStreamer(BasicCam* pCamera,
  * @brief Capture a frame from the camera and stream it to the specified IP
  *        address and port at the specified frame rate.
  *
+ * @return AutonomyTask - The coroutine for one iteration of the stream.
+ *
  * @author Eli Byrd (edbgkk@mst.edu)
  * @date 2024-11-10
  ******************************************************************************/
-void FFmpegUDPCameraStreamer::ThreadedContinuousCode()
+AutonomyTask FFmpegUDPCameraStreamer::ThreadedContinuousCode()
 {
     cv::Mat cvNormalFrame1;
-
-    std::future<bool> fuCopyStatus1 = m_pCamera->RequestFrameCopy(cvNormalFrame1);
-
-    if (fuCopyStatus1.get() && !cvNormalFrame1.empty())
+    containers::FrameMetadata stFrameMetadata;
+
+    // Get the current region of interest. It only changes the crop the camera cuts from its full resolution frame, so the encoder is untouched.
+    cv::Rect2d cvRegionOfInterest = this->GetRegionOfInterest();
+
+    // Request a BGR frame already cropped and scaled to the stream resolution. The camera shares this conversion with any other consumer asking for the same
+    // format, size, and region. The camera sets the event once the copy is done, so this coroutine is woken up instead of polling the future.
+    std::shared_ptr<CoroutineReactor::Event> pFrameCopied = std::make_shared<CoroutineReactor::Event>();
+    std::future<bool> fuCopyStatus1                       = m_pCamera->RequestFrameCopy(cvNormalFrame1,
+                                                                                        PIXEL_FORMATS::eBGR,
+                                                                                        cv::Size(m_nStreamWidth, m_nStreamHeight),
+                                                                                        cvRegionOfInterest,
+                                                                                        &stFrameMetadata,
+                                                                                        [pFrameCopied]() { pFrameCopied->Set(); });
+
+    // Wait for the frame without holding a thread, so the other streams can run in the meantime.
+    co_await this->WaitForEvent(*pFrameCopied);
+    bool bCopyStatus1 = fuCopyStatus1.get();
+    if (bCopyStatus1 && !cvNormalFrame1.empty())
     {
-        // Apply brightness and contrast adjustment
-        cv::Mat adjustedFrame = cvNormalFrame1;
-        // cvNormalFrame1.convertTo(adjustedFrame, -1, m_dContrast, m_dBrightness);
-
-        // Check and adjust channels to ensure compatibility with the encoder
-        if (adjustedFrame.channels() == 1)
-        {
-            cv::cvtColor(adjustedFrame, adjustedFrame, cv::COLOR_GRAY2BGR);
-        }
-        else if (adjustedFrame.channels() == 4)
-        {
-            cv::cvtColor(adjustedFrame, adjustedFrame, cv::COLOR_BGRA2BGR);
-        }
-
-        // Log frame details for debugging
-        // LOG_DEBUG(logging::g_qSharedLogger, "Captured frame size: {}x{}, channels: {}", adjustedFrame.cols, adjustedFrame.rows, adjustedFrame.channels());
-
-        // Ensure the frame is resized to the expected dimensions
-        if (adjustedFrame.cols != m_nStreamWidth || adjustedFrame.rows != m_nStreamHeight)
-        {
-            // LOG_WARNING(logging::g_qSharedLogger, "Resizing frame from {}x{} to {}x{}", adjustedFrame.cols, adjustedFrame.rows, m_nStreamWidth, m_nStreamHeight);
-            cv::resize(adjustedFrame, adjustedFrame, cv::Size(m_nStreamWidth, m_nStreamHeight));
-        }
-
-        // Ensure the frame has 3 channels (BGR)
-        if (adjustedFrame.channels() != 3)
+        // Check if the camera is disconnected. Its frames are black filler, so stop encoding until it's back.
+        if (!stFrameMetadata.bCameraIsOnline)
         {
-            // LOG_WARNING(logging::g_qSharedLogger, "Converting frame to 3-channel BGR format.");
-            if (adjustedFrame.channels() == 1)
+            // Check if it just went offline.
+            if (!m_bCameraOffline)
             {
-                cv::cvtColor(adjustedFrame, adjustedFrame, cv::COLOR_GRAY2BGR);
-            }
-            else if (adjustedFrame.channels() == 4)
-            {
-                cv::cvtColor(adjustedFrame, adjustedFrame, cv::COLOR_BGRA2BGR);
+                // Submit logger message.
+                LOG_WARNING(logging::g_qSharedLogger, "Camera {} went offline. Stream paused until it reconnects.", m_pCamera->GetCameraLocation());
+                m_bCameraOffline = true;
             }
+            co_return;
         }
 
-        uint8_t* inData[1] = {adjustedFrame.data};
-        int inLinesize[1]  = {static_cast<int>(adjustedFrame.step)};
+        // Resume with a keyframe after an outage so viewers can decode right away.
+        m_pFrameYUV->pict_type = m_bCameraOffline ? AV_PICTURE_TYPE_I : AV_PICTURE_TYPE_NONE;
+        m_bCameraOffline       = false;
 
-        int scaledHeight   = sws_scale(m_swsCtx, inData, inLinesize, 0, m_nStreamHeight, m_pFrameYUV->data, m_pFrameYUV->linesize);
-        if (scaledHeight <= 0)
-        {
-            LOG_ERROR(logging::g_qSharedLogger,
-                      "Error: sws_scale failed or returned invalid height. Frame size: {}x{}, input linesize: {}",
-                      adjustedFrame.cols,
-                      adjustedFrame.rows,
-                      inLinesize[0]);
-            return;
-        }
+        // Scale, encode, and send the frame on the encode threads, in this stream's priority class. The coroutine is resumed once it's sent.
+        m_stEncodeTasks.SetPriority(this->GetThreadPriority());
+        co_await this->WaitForTask(GetEncodeExecutor(), m_stEncodeTasks, [this, &cvNormalFrame1]() { this->EncodeFrame(cvNormalFrame1); });
+    }
+}
 
-        m_pFrameYUV->pts = m_nPoints++;
+/******************************************************************************
+ * @brief Scale a frame to the encoder's pixel format, encode it, and send the
+ *        packets. Runs on the encode threads.
+ *
+ * @param cvFrame - The BGR frame at the stream resolution.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+void FFmpegUDPCameraStreamer::EncodeFrame(const cv::Mat& cvFrame)
+{
+    uint8_t* inData[1] = {cvFrame.data};
+    int inLinesize[1]  = {static_cast<int>(cvFrame.step)};
 
-        if (avcodec_send_frame(m_pCodecCtx, m_pFrameYUV) >= 0)
+    int scaledHeight   = sws_scale(m_swsCtx, inData, inLinesize, 0, m_nStreamHeight, m_pFrameYUV->data, m_pFrameYUV->linesize);
+    if (scaledHeight <= 0)
+    {
+        LOG_ERROR(logging::g_qSharedLogger,
+                  "Error: sws_scale failed or returned invalid height. Frame size: {}x{}, input linesize: {}",
+                  cvFrame.cols,
+                  cvFrame.rows,
+                  inLinesize[0]);
+        return;
+    }
+
+    m_pFrameYUV->pts = m_nPoints++;
+
+    if (avcodec_send_frame(m_pCodecCtx, m_pFrameYUV) >= 0)
+    {
+        while (avcodec_receive_packet(m_pCodecCtx, m_pPacket) >= 0)
         {
-            while (avcodec_receive_packet(m_pCodecCtx, m_pPacket) >= 0)
-            {
-                m_pPacket->stream_index = m_pStream->index;
-                av_interleaved_write_frame(m_pFormatCtx, m_pPacket);
-                av_packet_unref(m_pPacket);
-            }
+            m_pPacket->stream_index = m_pStream->index;
+            av_interleaved_write_frame(m_pFormatCtx, m_pPacket);
+            av_packet_unref(m_pPacket);
         }
     }
 }
 
 /******************************************************************************
- * @brief PooledLinearCode is not used in the FFmpegUDPCameraStreamer class.
+ * @brief Accessor for the executor every stream encodes on. It is created the
+ *        first time it is asked for, with constants::STREAM_ENCODE_THREADS threads.
  *
- * @author Eli Byrd (edbgkk@mst.edu)
- * @date 2024-11-10
+ * @return WorkStealingExecutor& - The encode executor.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+WorkStealingExecutor& FFmpegUDPCameraStreamer::GetEncodeExecutor()
+{
+    // Make sure the reactor outlives the encode executor, since encode tasks resume coroutines with it.
+    CoroutineReactor::GetSharedReactor();
+    // Create the executor on first use, and log exceptions from its tasks.
+    static WorkStealingExecutor s_EncodeExecutor(constants::STREAM_ENCODE_THREADS);
+    static std::once_flag s_stExceptionHandlerFlag;
+    std::call_once(s_stExceptionHandlerFlag, []() { s_EncodeExecutor.SetExceptionHandler(logging::LogTaskException); });
+    return s_EncodeExecutor;
+}
+
+/******************************************************************************
+ * @brief Set the region of the camera image to stream. The region is cut from the
+ *        full resolution camera frame and scaled to the stream resolution, so the
+ *        stream keeps its size and bitrate while showing more detail. Takes effect
+ *        on the next frame.
+ *
+ * @param cvRegionOfInterest - The normalized (0 to 1) region of the camera image to
+ *                             stream. An empty region streams the whole image.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
  ******************************************************************************/
-void FFmpegUDPCameraStreamer::PooledLinearCode() {}
+void FFmpegUDPCameraStreamer::SetRegionOfInterest(const cv::Rect2d& cvRegionOfInterest)
+{
+    // Clip the region to the image.
+    cv::Rect2d cvRegion = cvRegionOfInterest & cv::Rect2d(0.0, 0.0, 1.0, 1.0);
+
+    // Acquire lock on region of interest.
+    std::lock_guard<std::mutex> lkRegionLock(m_muRegionOfInterestMutex);
+    // Empty regions reset the stream to the whole image.
+    m_cvRegionOfInterest = cvRegion.empty() ? cv::Rect2d() : cvRegion;
+}
+
+/******************************************************************************
+ * @brief Get the region of the camera image that is currently being streamed.
+ *
+ * @return cv::Rect2d - The normalized (0 to 1) region. Empty means the whole image.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+cv::Rect2d FFmpegUDPCameraStreamer::GetRegionOfInterest()
+{
+    // Acquire lock on region of interest.
+    std::lock_guard<std::mutex> lkRegionLock(m_muRegionOfInterestMutex);
+    return m_cvRegionOfInterest;
+}
 
 /******************************************************************************
  * @brief Destroy the FFmpegUDPCameraStreamer::FFmpegUDPCameraStreamer object.
@@ -277,9 +342,10 @@ void FFmpegUDPCameraStreamer::PooledLinearCode() {}
  ******************************************************************************/
 FFmpegUDPCameraStreamer::~FFmpegUDPCameraStreamer()
 {
-    // Signal and wait for recording thread to stop.
+    // Signal and wait for the stream coroutine to stop, and for its last encode task to let go of the group.
     this->RequestStop();
     this->Join();
+    GetEncodeExecutor().Wait(m_stEncodeTasks);
 
     // Write trailer and clean up
     av_write_trailer(m_pFormatCtx);
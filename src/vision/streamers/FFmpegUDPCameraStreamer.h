@@ -12,9 +12,11 @@
 #ifndef FFMPEG_UDPCAMERA_STREAMER_H
 #define FFMPEG_UDPCAMERA_STREAMER_H
 
+#include "../../interfaces/AutonomyCoroutine.hpp"
 #include "../cameras/BasicCam.h"
 
 /// \cond
+#include <mutex>
 #include <opencv2/opencv.hpp>
 
 extern "C"
@@ -34,7 +36,7 @@ extern "C"
  * @author Eli Byrd (edbgkk@mst.edu)
  * @date 2024-11-10
  ******************************************************************************/
-class FFmpegUDPCameraStreamer : public AutonomyThread<void>
+class FFmpegUDPCameraStreamer : public AutonomyCoroutine
 {
     private:
         int m_nOutputBitRate;
@@ -45,6 +47,7 @@ class FFmpegUDPCameraStreamer : public AutonomyThread<void>
         int m_nFrameRate;
         int m_nPort;
         int64_t m_nPoints;
+        bool m_bCameraOffline;
         double m_dBrightness;
         double m_dContrast;
         double m_dSaturation;
@@ -56,16 +59,19 @@ class FFmpegUDPCameraStreamer : public AutonomyThread<void>
         std::string m_szIPAddress;
         std::string m_szUDPAddress;
         BasicCam* m_pCamera;
+        cv::Rect2d m_cvRegionOfInterest;
+        std::mutex m_muRegionOfInterestMutex;
         AVPacket* m_pPacket;
         SwsContext* m_swsCtx;
         AVFrame* m_pFrameYUV;
         AVStream* m_pStream;
         AVCodecContext* m_pCodecCtx;
         AVFormatContext* m_pFormatCtx;
+        WorkStealingExecutor::TaskGroup m_stEncodeTasks;
 
-        void ThreadedContinuousCode() override;
-
-        void PooledLinearCode() override;
+        AutonomyTask ThreadedContinuousCode() override;
+        void EncodeFrame(const cv::Mat& cvFrame);
+        static WorkStealingExecutor& GetEncodeExecutor();
 
     public:
         FFmpegUDPCameraStreamer(BasicCam* pCamera,
@@ -87,6 +93,9 @@ class FFmpegUDPCameraStreamer : public AutonomyThread<void>
                                 double whiteBalance          = 0.0);
 
         ~FFmpegUDPCameraStreamer();
+
+        void SetRegionOfInterest(const cv::Rect2d& cvRegionOfInterest);
+        cv::Rect2d GetRegionOfInterest();
 };
 
 #endif    // FFMPEG_UDPCAMERA_STREAMER_H
@@ -0,0 +1,154 @@
+/******************************************************************************
+ * @brief Unit tests for the AutonomyThread class's ParallelizeLoop() method.
+ *
+ * @file AutonomyThread.cc
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../../src/interfaces/AutonomyThread.hpp"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief An AutonomyThread that never starts its thread, and only exposes
+ *      ParallelizeLoop() to the tests.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class LoopThread : public AutonomyThread<void>
+{
+    public:
+        template<typename N, typename F>
+        bool RunLoop(const int nNumThreads, const N tTotalIterations, F&& tLoopFunction, const std::atomic_bool* pCancelLoop = nullptr)
+        {
+            return this->ParallelizeLoop(nNumThreads, tTotalIterations, std::forward<F>(tLoopFunction), pCancelLoop);
+        }
+
+    private:
+        void ThreadedContinuousCode() override {}
+        void PooledLinearCode() override {}
+};
+
+/******************************************************************************
+ * @brief Check that every iteration of a loop long enough to be split across
+ *      threads is run exactly once.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST(AutonomyThreadTest, ParallelizeLoopRunsEveryIterationOnce)
+{
+    LoopThread cLoopThread;
+    // Give each iteration about a microsecond of work, so the loop takes long enough to be handed to other threads.
+    std::vector<std::atomic_int> vRunCounts(20000);
+    auto fnSpin = [](const size_t siIter)
+    {
+        std::chrono::steady_clock::time_point tmEnd = std::chrono::steady_clock::now() + std::chrono::microseconds(1);
+        while (std::chrono::steady_clock::now() < tmEnd)
+        {
+        }
+        return siIter;
+    };
+    EXPECT_TRUE(cLoopThread.RunLoop(4,
+                                    vRunCounts.size(),
+                                    [&vRunCounts, &fnSpin](const size_t siStart, const size_t siEnd)
+                                    {
+                                        for (size_t siIter = siStart; siIter < siEnd; ++siIter)
+                                        {
+                                            ++vRunCounts[fnSpin(siIter)];
+                                        }
+                                    }));
+    for (size_t siIter = 0; siIter < vRunCounts.size(); ++siIter)
+    {
+        ASSERT_EQ(vRunCounts[siIter], 1) << "Iteration " << siIter;
+    }
+
+    // Loops with no iterations run nothing.
+    EXPECT_TRUE(cLoopThread.RunLoop(4, 0, [](const int, const int) { FAIL(); }));
+}
+
+/******************************************************************************
+ * @brief Check that a cancelled loop stops early and says so.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST(AutonomyThreadTest, ParallelizeLoopStopsWhenCancelled)
+{
+    LoopThread cLoopThread;
+    std::atomic_bool bCancelLoop(false);
+    std::atomic_int nIterationsRun(0);
+    // Cancel from inside the loop once part of it has run. Each iteration sleeps, so the loop can't finish before it's noticed.
+    EXPECT_FALSE(cLoopThread.RunLoop(4,
+                                     10000,
+                                     [&bCancelLoop, &nIterationsRun](const int nStart, const int nEnd)
+                                     {
+                                         for (int nIter = nStart; nIter < nEnd; ++nIter)
+                                         {
+                                             std::this_thread::sleep_for(std::chrono::microseconds(10));
+                                             if (++nIterationsRun == 100)
+                                             {
+                                                 bCancelLoop = true;
+                                             }
+                                         }
+                                     },
+                                     &bCancelLoop));
+    EXPECT_LT(nIterationsRun, 10000);
+}
+
+/******************************************************************************
+ * @brief Check the cost ParallelizeLoop() adds over calling the loop function
+ *      directly, for loops too cheap to be worth splitting. These are finished on
+ *      the calling thread, so the cost must stay small enough to call per frame.
+ *      A release build adds about 0.3 us to a 16 iteration loop and 1 us to a 1000
+ *      iteration loop, the bounds leave room for slow and instrumented builds.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST(AutonomyThreadTest, ParallelizeLoopPerCallOverhead)
+{
+    LoopThread cLoopThread;
+    std::atomic_uint64_t unSum(0);
+    auto fnLoop = [&unSum](const int nStart, const int nEnd)
+    {
+        for (int nIter = nStart; nIter < nEnd; ++nIter)
+        {
+            unSum.fetch_add(nIter, std::memory_order_relaxed);
+        }
+    };
+
+    // Time a small and a large cheap loop, with and without ParallelizeLoop().
+    const int nCalls = 10000;
+    for (const std::pair<int, double>& stCase : {std::pair<int, double>(16, 2.5), std::pair<int, double>(1000, 10.0)})
+    {
+        std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+        for (int nCall = 0; nCall < nCalls; ++nCall)
+        {
+            fnLoop(0, stCase.first);
+        }
+        std::chrono::steady_clock::duration tmDirectTime = std::chrono::steady_clock::now() - tmStart;
+
+        tmStart = std::chrono::steady_clock::now();
+        for (int nCall = 0; nCall < nCalls; ++nCall)
+        {
+            cLoopThread.RunLoop(4, stCase.first, fnLoop);
+        }
+        std::chrono::steady_clock::duration tmLoopTime = std::chrono::steady_clock::now() - tmStart;
+
+        double dMicrosecondsPerCall = std::chrono::duration<double, std::micro>(tmLoopTime - tmDirectTime).count() / nCalls;
+        EXPECT_LT(dMicrosecondsPerCall, stCase.second) << stCase.first << " iteration loop";
+    }
+    EXPECT_EQ(unSum, uint64_t(2) * nCalls * (16 * 15 / 2 + 1000 * 999 / 2));
+}
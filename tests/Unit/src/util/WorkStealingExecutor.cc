@@ -0,0 +1,280 @@
+/******************************************************************************
+ * @brief Unit tests for the WorkStealingExecutor class.
+ *
+ * @file WorkStealingExecutor.cc
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../../src/util/WorkStealingExecutor.hpp"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Test fixture with a single worker, so the order tasks run in is known.
+ *      The worker can be held on a task while others are queued behind it.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class WorkStealingExecutorTest : public ::testing::Test
+{
+    protected:
+        WorkStealingExecutorTest() : m_cExecutor(1) {}
+
+        // Queue a task that holds the only worker until ReleaseWorker() is called.
+        void HoldWorker()
+        {
+            std::promise<void> stStarted;
+            std::future<void> fuStarted = stStarted.get_future();
+            m_cExecutor.Submit(m_stHoldGroup,
+                               [this, &stStarted]()
+                               {
+                                   stStarted.set_value();
+                                   m_fuRelease.wait();
+                               });
+            fuStarted.wait();
+        }
+
+        // Let the held worker go and wait for it.
+        void ReleaseWorker()
+        {
+            m_stRelease.set_value();
+            m_cExecutor.Wait(m_stHoldGroup);
+        }
+
+        WorkStealingExecutor m_cExecutor;
+        WorkStealingExecutor::TaskGroup m_stHoldGroup;
+        std::promise<void> m_stRelease;
+        std::shared_future<void> m_fuRelease = m_stRelease.get_future().share();
+};
+
+/******************************************************************************
+ * @brief Check that waiting on a group returns once every one of its tasks ran.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(WorkStealingExecutorTest, WaitRunsEveryTask)
+{
+    // Queue a lot of small tasks.
+    WorkStealingExecutor::TaskGroup stGroup;
+    std::atomic<int> nRunTasks = 0;
+    for (int nIter = 0; nIter < 1000; ++nIter)
+    {
+        m_cExecutor.Submit(stGroup, [&nRunTasks]() { ++nRunTasks; });
+    }
+    m_cExecutor.Wait(stGroup);
+
+    // Every task ran and the group is empty.
+    EXPECT_EQ(nRunTasks, 1000);
+    EXPECT_EQ(stGroup.GetPendingTasks(), 0);
+    EXPECT_EQ(stGroup.GetQueuedTasks(), 0);
+}
+
+/******************************************************************************
+ * @brief Check that a task can submit to and wait on its own group from a worker
+ *      without deadlocking, since waiting helps with the queued tasks.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(WorkStealingExecutorTest, NestedWaitRunsInline)
+{
+    // The only worker waits on tasks it queued itself.
+    WorkStealingExecutor::TaskGroup stGroup;
+    std::atomic<int> nRunTasks = 0;
+    m_cExecutor.Submit(stGroup,
+                       [this, &nRunTasks]()
+                       {
+                           WorkStealingExecutor::TaskGroup stInnerGroup;
+                           for (int nIter = 0; nIter < 10; ++nIter)
+                           {
+                               m_cExecutor.Submit(stInnerGroup, [&nRunTasks]() { ++nRunTasks; });
+                           }
+                           m_cExecutor.Wait(stInnerGroup);
+                       });
+    m_cExecutor.Wait(stGroup);
+
+    EXPECT_EQ(nRunTasks, 10);
+}
+
+/******************************************************************************
+ * @brief Check that purging a group only removes that group's queued tasks.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(WorkStealingExecutorTest, PurgeOnlyRemovesGroup)
+{
+    // Queue tasks from two groups behind the held worker.
+    this->HoldWorker();
+    WorkStealingExecutor::TaskGroup stPurgedGroup;
+    WorkStealingExecutor::TaskGroup stKeptGroup;
+    std::atomic<int> nPurgedRuns = 0;
+    std::atomic<int> nKeptRuns   = 0;
+    for (int nIter = 0; nIter < 5; ++nIter)
+    {
+        m_cExecutor.Submit(stPurgedGroup, [&nPurgedRuns]() { ++nPurgedRuns; });
+        m_cExecutor.Submit(stKeptGroup, [&nKeptRuns]() { ++nKeptRuns; });
+    }
+    EXPECT_EQ(stPurgedGroup.GetQueuedTasks(), 5);
+
+    // Purge one group. Waiting on it returns right away.
+    EXPECT_EQ(m_cExecutor.Purge(stPurgedGroup), 5);
+    EXPECT_EQ(stPurgedGroup.GetPendingTasks(), 0);
+    m_cExecutor.Wait(stPurgedGroup);
+    EXPECT_EQ(m_cExecutor.Purge(stPurgedGroup), 0);
+
+    // The other group still runs.
+    this->ReleaseWorker();
+    m_cExecutor.Wait(stKeptGroup);
+    EXPECT_EQ(nPurgedRuns, 0);
+    EXPECT_EQ(nKeptRuns, 5);
+}
+
+/******************************************************************************
+ * @brief Check that queued tasks run in priority order no matter when they were
+ *      submitted. Within a class a worker runs its own newest task first.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(WorkStealingExecutorTest, RunsHigherPriorityFirst)
+{
+    // Queue background, then normal, then critical tasks behind the held worker.
+    this->HoldWorker();
+    WorkStealingExecutor::TaskGroup stBackgroundGroup;
+    WorkStealingExecutor::TaskGroup stNormalGroup;
+    WorkStealingExecutor::TaskGroup stCriticalGroup;
+    stBackgroundGroup.SetPriority(THREAD_PRIORITIES::eBackground);
+    stCriticalGroup.SetPriority(THREAD_PRIORITIES::eCritical);
+    std::mutex muOrderMutex;
+    std::vector<int> vOrder;
+    std::promise<void> stAllRun;
+    auto fnRecord = [&muOrderMutex, &vOrder, &stAllRun](const int nTask)
+    {
+        return [&muOrderMutex, &vOrder, &stAllRun, nTask]()
+        {
+            std::lock_guard<std::mutex> lkOrderLock(muOrderMutex);
+            vOrder.push_back(nTask);
+            if (vOrder.size() == 5)
+            {
+                stAllRun.set_value();
+            }
+        };
+    };
+    m_cExecutor.Submit(stBackgroundGroup, fnRecord(0));
+    m_cExecutor.Submit(stBackgroundGroup, fnRecord(1));
+    m_cExecutor.Submit(stNormalGroup, fnRecord(2));
+    m_cExecutor.Submit(stCriticalGroup, fnRecord(3));
+    m_cExecutor.Submit(stCriticalGroup, fnRecord(4));
+
+    // Let the worker run them all. Waiting on a group would run its tasks on this thread, so wait for the last task instead.
+    this->ReleaseWorker();
+    ASSERT_EQ(stAllRun.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    m_cExecutor.Wait(stBackgroundGroup);
+    m_cExecutor.Wait(stNormalGroup);
+    m_cExecutor.Wait(stCriticalGroup);
+
+    // Critical, then normal, then background. The only worker owns every queue, so each class runs newest first.
+    EXPECT_EQ(vOrder, (std::vector<int>{4, 3, 2, 1, 0}));
+}
+
+/******************************************************************************
+ * @brief Check that a task's future gets its exception, and that the group and
+ *      the worker carry on afterwards.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(WorkStealingExecutorTest, FutureHoldsException)
+{
+    // Queue a task that throws, and one that doesn't.
+    WorkStealingExecutor::TaskGroup stGroup;
+    std::future<void> fuThrows  = m_cExecutor.SubmitWithFuture(stGroup, []() { throw std::runtime_error("Task failed."); });
+    std::future<void> fuReturns = m_cExecutor.SubmitWithFuture(stGroup, []() {});
+    m_cExecutor.Wait(stGroup);
+
+    // The exception comes out of the future.
+    EXPECT_THROW(fuThrows.get(), std::runtime_error);
+    EXPECT_NO_THROW(fuReturns.get());
+    EXPECT_EQ(stGroup.GetPendingTasks(), 0);
+
+    // The worker still runs tasks.
+    std::future<void> fuAfter = m_cExecutor.SubmitWithFuture(stGroup, []() {});
+    EXPECT_EQ(fuAfter.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    m_cExecutor.Wait(stGroup);
+}
+
+/******************************************************************************
+ * @brief Check that the exception of a task without a future goes to the
+ *      exception handler, and that the worker carries on afterwards.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(WorkStealingExecutorTest, HandlerGetsException)
+{
+    // Without a handler the exception is dropped.
+    WorkStealingExecutor::TaskGroup stGroup;
+    m_cExecutor.Submit(stGroup, []() { throw std::runtime_error("Task failed."); });
+    m_cExecutor.Wait(stGroup);
+
+    // Record the exceptions the handler is given.
+    std::mutex muExceptionsMutex;
+    std::vector<std::exception_ptr> vExceptions;
+    m_cExecutor.SetExceptionHandler(
+        [&muExceptionsMutex, &vExceptions](std::exception_ptr pException)
+        {
+            std::lock_guard<std::mutex> lkExceptionsLock(muExceptionsMutex);
+            vExceptions.push_back(pException);
+        });
+    m_cExecutor.Submit(stGroup, []() { throw std::runtime_error("Task failed."); });
+    m_cExecutor.Submit(stGroup, []() {});
+    // Tasks with a future keep their exception to themselves.
+    std::future<void> fuThrows = m_cExecutor.SubmitWithFuture(stGroup, []() { throw std::logic_error("Task failed."); });
+    m_cExecutor.Wait(stGroup);
+
+    ASSERT_EQ(vExceptions.size(), 1u);
+    EXPECT_THROW(std::rethrow_exception(vExceptions[0]), std::runtime_error);
+    EXPECT_THROW(fuThrows.get(), std::logic_error);
+    EXPECT_EQ(stGroup.GetPendingTasks(), 0);
+
+    // The worker still runs tasks.
+    std::future<void> fuAfter = m_cExecutor.SubmitWithFuture(stGroup, []() {});
+    EXPECT_EQ(fuAfter.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    m_cExecutor.Wait(stGroup);
+}
+
+/******************************************************************************
+ * @brief Check that the future of a purged task reports a broken promise instead
+ *      of waiting forever.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(WorkStealingExecutorTest, PurgedFutureIsBroken)
+{
+    // Queue a task behind the held worker and purge it.
+    this->HoldWorker();
+    WorkStealingExecutor::TaskGroup stGroup;
+    std::future<void> fuPurged = m_cExecutor.SubmitWithFuture(stGroup, []() {});
+    EXPECT_EQ(m_cExecutor.Purge(stGroup), 1);
+    this->ReleaseWorker();
+
+    // The future is ready with an error.
+    ASSERT_EQ(fuPurged.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_THROW(fuPurged.get(), std::future_error);
+}
@@ -0,0 +1,216 @@
+/******************************************************************************
+ * @brief Unit tests for the pixel format conversion kernels. Each kernel is
+ *      checked against the OpenCV function it replaces.
+ *
+ * @file PixelConversions.cc
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../../../src/util/vision/PixelConversions.hpp"
+
+/// \cond
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Test fixture that gives each test the same random BGR frame.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class PixelConversionsTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override
+        {
+            // Fill the frame with noise, so every pixel differs from its neighbours.
+            m_cvFrame.create(48, 64, CV_8UC3);
+            cv::RNG cvRNG(42);
+            cvRNG.fill(m_cvFrame, cv::RNG::UNIFORM, 0, 256);
+        }
+
+        // Get the largest difference between two images in any channel, or -1 if they aren't the same size and type.
+        static double MaxDifference(const cv::Mat& cvImage1, const cv::Mat& cvImage2)
+        {
+            if (cvImage1.size() != cvImage2.size() || cvImage1.type() != cvImage2.type())
+            {
+                return -1.0;
+            }
+            return cv::norm(cvImage1, cvImage2, cv::NORM_INF);
+        }
+
+        cv::Mat m_cvFrame;
+};
+
+/******************************************************************************
+ * @brief Check that conversions that only reorder or add channels match
+ *      cv::cvtColor() exactly.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(PixelConversionsTest, ChannelOrderMatchesCvtColor)
+{
+    // Make a four channel frame to convert from too.
+    cv::Mat cvBGRAFrame;
+    cv::cvtColor(m_cvFrame, cvBGRAFrame, cv::COLOR_BGR2BGRA);
+
+    cv::Mat cvResult;
+    cv::Mat cvExpected;
+    ASSERT_TRUE(conversions::Convert(m_cvFrame, cvResult, PIXEL_FORMATS::eBGR, PIXEL_FORMATS::eRGB));
+    cv::cvtColor(m_cvFrame, cvExpected, cv::COLOR_BGR2RGB);
+    EXPECT_EQ(MaxDifference(cvResult, cvExpected), 0.0);
+
+    ASSERT_TRUE(conversions::Convert(m_cvFrame, cvResult, PIXEL_FORMATS::eBGR, PIXEL_FORMATS::eBGRA));
+    EXPECT_EQ(MaxDifference(cvResult, cvBGRAFrame), 0.0);
+
+    ASSERT_TRUE(conversions::Convert(m_cvFrame, cvResult, PIXEL_FORMATS::eBGR, PIXEL_FORMATS::eRGBA));
+    cv::cvtColor(m_cvFrame, cvExpected, cv::COLOR_BGR2RGBA);
+    EXPECT_EQ(MaxDifference(cvResult, cvExpected), 0.0);
+
+    ASSERT_TRUE(conversions::Convert(cvBGRAFrame, cvResult, PIXEL_FORMATS::eBGRA, PIXEL_FORMATS::eRGBA));
+    cv::cvtColor(cvBGRAFrame, cvExpected, cv::COLOR_BGRA2RGBA);
+    EXPECT_EQ(MaxDifference(cvResult, cvExpected), 0.0);
+
+    ASSERT_TRUE(conversions::Convert(cvBGRAFrame, cvResult, PIXEL_FORMATS::eBGRA, PIXEL_FORMATS::eBGR));
+    EXPECT_EQ(MaxDifference(cvResult, m_cvFrame), 0.0);
+
+    // Converting in place gives the same result.
+    cv::Mat cvInPlace = m_cvFrame.clone();
+    ASSERT_TRUE(conversions::Convert(cvInPlace, cvInPlace, PIXEL_FORMATS::eBGR, PIXEL_FORMATS::eRGB));
+    cv::cvtColor(m_cvFrame, cvExpected, cv::COLOR_BGR2RGB);
+    EXPECT_EQ(MaxDifference(cvInPlace, cvExpected), 0.0);
+}
+
+/******************************************************************************
+ * @brief Check that the fixed-point grayscale and YUV kernels stay within rounding
+ *      of cv::cvtColor().
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(PixelConversionsTest, LumaAndChromaMatchCvtColor)
+{
+    cv::Mat cvResult;
+    cv::Mat cvExpected;
+    ASSERT_TRUE(conversions::Convert(m_cvFrame, cvResult, PIXEL_FORMATS::eBGR, PIXEL_FORMATS::eGrayscale));
+    cv::cvtColor(m_cvFrame, cvExpected, cv::COLOR_BGR2GRAY);
+    EXPECT_LE(MaxDifference(cvResult, cvExpected), 1.0);
+
+    // The chroma weights are 8 bit, so they can be off by one more than luma.
+    ASSERT_TRUE(conversions::Convert(m_cvFrame, cvResult, PIXEL_FORMATS::eBGR, PIXEL_FORMATS::eYUV));
+    cv::cvtColor(m_cvFrame, cvExpected, cv::COLOR_BGR2YUV);
+    EXPECT_LE(MaxDifference(cvResult, cvExpected), 2.0);
+
+    ASSERT_TRUE(conversions::Convert(cvExpected, cvResult, PIXEL_FORMATS::eYUV, PIXEL_FORMATS::eBGR));
+    cv::Mat cvExpectedBGR;
+    cv::cvtColor(cvExpected, cvExpectedBGR, cv::COLOR_YUV2BGR);
+    EXPECT_LE(MaxDifference(cvResult, cvExpectedBGR), 1.0);
+}
+
+/******************************************************************************
+ * @brief Check that fused bilinear scaling stays within rounding of cv::resize()
+ *      when growing and when shrinking by less than half.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(PixelConversionsTest, BilinearScaleMatchesResize)
+{
+    // Scale the frame up, and down to just over half, with uneven ratios.
+    for (const cv::Size& cvSize : {cv::Size(96, 72), cv::Size(33, 25), cv::Size(40, 30)})
+    {
+        cv::Mat cvResult;
+        cv::Mat cvExpected;
+        ASSERT_TRUE(conversions::Convert(m_cvFrame, cvResult, PIXEL_FORMATS::eBGR, PIXEL_FORMATS::eBGR, conversions::FrameTransform(), cvSize, cv::INTER_LINEAR));
+        cv::resize(m_cvFrame, cvExpected, cvSize, 0.0, 0.0, cv::INTER_LINEAR);
+        EXPECT_LE(MaxDifference(cvResult, cvExpected), 1.0) << "Output size " << cvSize;
+    }
+}
+
+/******************************************************************************
+ * @brief Check that fused nearest neighbour scaling picks the same pixels as
+ *      cv::resize(). The scale is a whole number, so no sample falls halfway
+ *      between two pixels.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(PixelConversionsTest, NearestScaleMatchesResize)
+{
+    cv::Mat cvResult;
+    cv::Mat cvExpected;
+    const cv::Size cvSize(m_cvFrame.cols * 3, m_cvFrame.rows * 3);
+    ASSERT_TRUE(conversions::Convert(m_cvFrame, cvResult, PIXEL_FORMATS::eBGR, PIXEL_FORMATS::eRGB, conversions::FrameTransform(), cvSize, cv::INTER_NEAREST));
+    cv::resize(m_cvFrame, cvExpected, cvSize, 0.0, 0.0, cv::INTER_NEAREST_EXACT);
+    cv::cvtColor(cvExpected, cvExpected, cv::COLOR_BGR2RGB);
+    EXPECT_EQ(MaxDifference(cvResult, cvExpected), 0.0);
+}
+
+/******************************************************************************
+ * @brief Check that shrinking below half size is area averaged, the same as
+ *      cv::resize() with cv::INTER_AREA, including when the frame is rotated.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(PixelConversionsTest, LargeShrinkMatchesAreaResize)
+{
+    // Shrink to a quarter without rotating.
+    cv::Mat cvResult;
+    cv::Mat cvExpected;
+    ASSERT_TRUE(conversions::Convert(m_cvFrame, cvResult, PIXEL_FORMATS::eBGR, PIXEL_FORMATS::eRGB, conversions::FrameTransform(), cv::Size(16, 12), cv::INTER_LINEAR));
+    cv::resize(m_cvFrame, cvExpected, cv::Size(16, 12), 0.0, 0.0, cv::INTER_AREA);
+    cv::cvtColor(cvExpected, cvExpected, cv::COLOR_BGR2RGB);
+    EXPECT_EQ(MaxDifference(cvResult, cvExpected), 0.0);
+
+    // Rotating swaps the axes, so the frame is shrunk to the swapped size before it's turned.
+    conversions::FrameTransform stTransform;
+    stTransform.nRotation = 90;
+    ASSERT_TRUE(conversions::Convert(m_cvFrame, cvResult, PIXEL_FORMATS::eBGR, PIXEL_FORMATS::eBGR, stTransform, cv::Size(12, 16), cv::INTER_LINEAR));
+    cv::Mat cvShrunk;
+    cv::resize(m_cvFrame, cvShrunk, cv::Size(16, 12), 0.0, 0.0, cv::INTER_AREA);
+    cv::rotate(cvShrunk, cvExpected, cv::ROTATE_90_CLOCKWISE);
+    EXPECT_EQ(MaxDifference(cvResult, cvExpected), 0.0);
+}
+
+/******************************************************************************
+ * @brief Check that crops, rotations, and flips without scaling move the pixels
+ *      exactly where cropping, cv::rotate(), and cv::flip() would.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(PixelConversionsTest, CropRotateFlipMatchesOpenCV)
+{
+    const cv::Rect cvCrop(5, 3, 40, 30);
+    for (const int nRotation : {0, 90, 180, 270})
+    {
+        // Flip horizontally after rotating.
+        conversions::FrameTransform stTransform;
+        stTransform.nRotation       = nRotation;
+        stTransform.bFlipHorizontal = true;
+        stTransform.cvCrop          = cvCrop;
+
+        cv::Mat cvResult;
+        ASSERT_TRUE(conversions::Convert(m_cvFrame, cvResult, PIXEL_FORMATS::eBGR, PIXEL_FORMATS::eBGR, stTransform, cv::Size(), cv::INTER_LINEAR));
+
+        // Crop, rotate clockwise, and flip with OpenCV.
+        cv::Mat cvRotated = m_cvFrame(cvCrop).clone();
+        switch (nRotation)
+        {
+            case 90: cv::rotate(m_cvFrame(cvCrop), cvRotated, cv::ROTATE_90_CLOCKWISE); break;
+            case 180: cv::rotate(m_cvFrame(cvCrop), cvRotated, cv::ROTATE_180); break;
+            case 270: cv::rotate(m_cvFrame(cvCrop), cvRotated, cv::ROTATE_90_COUNTERCLOCKWISE); break;
+            default: break;
+        }
+        cv::Mat cvExpected;
+        cv::flip(cvRotated, cvExpected, 1);
+        EXPECT_EQ(MaxDifference(cvResult, cvExpected), 0.0) << "Rotation " << nRotation;
+    }
+}
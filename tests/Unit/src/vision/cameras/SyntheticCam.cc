@@ -0,0 +1,130 @@
+/******************************************************************************
+ * @brief Unit tests for the frame stamp SyntheticCam draws into its frames.
+ *
+ * @file SyntheticCam.cc
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../../../src/vision/cameras/SyntheticCam.h"
+
+/// \cond
+#include <chrono>
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Test fixture that gives each test the same noisy BGR frame, and the
+ *      frame number and capture time to stamp into it.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class SyntheticCamStampTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override
+        {
+            // Fill the frame with noise, so the stamp has to stand out from the picture.
+            m_cvFrame.create(480, 640, CV_8UC3);
+            cv::RNG cvRNG(42);
+            cvRNG.fill(m_cvFrame, cv::RNG::UNIFORM, 0, 256);
+
+            // The stamp only holds whole microseconds.
+            m_tmCaptureTime = std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()));
+        }
+
+        cv::Mat m_cvFrame;
+        const uint64_t m_unFrameNumber = 123456789;
+        std::chrono::system_clock::time_point m_tmCaptureTime;
+};
+
+/******************************************************************************
+ * @brief Check that a stamp reads back as the frame number and capture time that
+ *      were written.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(SyntheticCamStampTest, RoundTrip)
+{
+    SyntheticCam::WriteFrameStamp(m_cvFrame, m_unFrameNumber, m_tmCaptureTime);
+
+    uint64_t unFrameNumber = 0;
+    std::chrono::system_clock::time_point tmCaptureTime;
+    ASSERT_TRUE(SyntheticCam::ReadFrameStamp(m_cvFrame, unFrameNumber, tmCaptureTime));
+    EXPECT_EQ(unFrameNumber, m_unFrameNumber);
+    EXPECT_EQ(tmCaptureTime, m_tmCaptureTime);
+
+    // The time is truncated to microseconds, not rounded.
+    SyntheticCam::WriteFrameStamp(m_cvFrame, m_unFrameNumber, m_tmCaptureTime + std::chrono::nanoseconds(999));
+    ASSERT_TRUE(SyntheticCam::ReadFrameStamp(m_cvFrame, unFrameNumber, tmCaptureTime));
+    EXPECT_EQ(tmCaptureTime, m_tmCaptureTime);
+}
+
+/******************************************************************************
+ * @brief Check that a stamp still reads back after the frame is resized, blurred,
+ *      and JPEG compressed, the way it would be after passing through a stream.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(SyntheticCamStampTest, SurvivesResizeAndCompression)
+{
+    SyntheticCam::WriteFrameStamp(m_cvFrame, m_unFrameNumber, m_tmCaptureTime);
+
+    // Shrink to half size and soften the block edges.
+    cv::Mat cvResized;
+    cv::resize(m_cvFrame, cvResized, cv::Size(320, 240), 0.0, 0.0, cv::INTER_AREA);
+    cv::GaussianBlur(cvResized, cvResized, cv::Size(3, 3), 0.0);
+
+    uint64_t unFrameNumber = 0;
+    std::chrono::system_clock::time_point tmCaptureTime;
+    ASSERT_TRUE(SyntheticCam::ReadFrameStamp(cvResized, unFrameNumber, tmCaptureTime));
+    EXPECT_EQ(unFrameNumber, m_unFrameNumber);
+    EXPECT_EQ(tmCaptureTime, m_tmCaptureTime);
+
+    // Compress the full size frame hard.
+    std::vector<uchar> vEncoded;
+    ASSERT_TRUE(cv::imencode(".jpg", m_cvFrame, vEncoded, {cv::IMWRITE_JPEG_QUALITY, 30}));
+    cv::Mat cvDecoded = cv::imdecode(vEncoded, cv::IMREAD_COLOR);
+    ASSERT_TRUE(SyntheticCam::ReadFrameStamp(cvDecoded, unFrameNumber, tmCaptureTime));
+    EXPECT_EQ(unFrameNumber, m_unFrameNumber);
+    EXPECT_EQ(tmCaptureTime, m_tmCaptureTime);
+}
+
+/******************************************************************************
+ * @brief Check that frames without a stamp, or too small to hold one, aren't read
+ *      as stamped, and that too small frames are left as they are.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(SyntheticCamStampTest, RejectsUnstampedFrames)
+{
+    uint64_t unFrameNumber = 0;
+    std::chrono::system_clock::time_point tmCaptureTime;
+
+    // Picture content fails the check row.
+    EXPECT_FALSE(SyntheticCam::ReadFrameStamp(m_cvFrame, unFrameNumber, tmCaptureTime));
+    EXPECT_FALSE(SyntheticCam::ReadFrameStamp(cv::Mat::zeros(480, 640, CV_8UC3), unFrameNumber, tmCaptureTime));
+
+    // Empty frames and frames of the wrong type can't be read.
+    EXPECT_FALSE(SyntheticCam::ReadFrameStamp(cv::Mat(), unFrameNumber, tmCaptureTime));
+    cv::Mat cvGrayFrame(480, 640, CV_8UC1, cv::Scalar(0));
+    EXPECT_FALSE(SyntheticCam::ReadFrameStamp(cvGrayFrame, unFrameNumber, tmCaptureTime));
+
+    // Frames narrower than 64 pixels aren't stamped.
+    cv::Mat cvSmallFrame = m_cvFrame(cv::Rect(0, 0, 48, 48)).clone();
+    cv::Mat cvOriginal   = cvSmallFrame.clone();
+    SyntheticCam::WriteFrameStamp(cvSmallFrame, m_unFrameNumber, m_tmCaptureTime);
+    EXPECT_EQ(cv::norm(cvSmallFrame, cvOriginal, cv::NORM_INF), 0.0);
+    EXPECT_FALSE(SyntheticCam::ReadFrameStamp(cvSmallFrame, unFrameNumber, tmCaptureTime));
+    EXPECT_EQ(unFrameNumber, 0u);
+}
@@ -0,0 +1,284 @@
+/******************************************************************************
+ * @brief Unit tests for the BlackBoxRing class and black box recovery.
+ *
+ * @file BlackBoxRing.cc
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../../../src/vision/recorders/BlackBoxRing.h"
+#include "../../../../../tools/blackbox/BlackBoxRecovery.h"
+
+/// \cond
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <vector>
+
+extern "C"
+{
+#include <libavformat/avformat.h>
+}
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Test fixture that gives each test a fresh ring file path and a codec
+ *      context to describe the packets.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class BlackBoxRingTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override
+        {
+            // Pick a ring file path for this test.
+            m_szRingPath = (std::filesystem::temp_directory_path() /
+                            (std::string("BlackBoxRingTest_") + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".ring"))
+                               .string();
+            this->RemoveFiles();
+
+            // Describe the packets. FFV1 has no parser, so the made up packet data is never looked at.
+            m_pCodecCtx             = avcodec_alloc_context3(nullptr);
+            m_pCodecCtx->codec_type = AVMEDIA_TYPE_VIDEO;
+            m_pCodecCtx->codec_id   = AV_CODEC_ID_FFV1;
+            m_pCodecCtx->width      = 64;
+            m_pCodecCtx->height     = 48;
+            m_pCodecCtx->time_base  = AVRational{1, 1000000};
+        }
+
+        void TearDown() override
+        {
+            avcodec_free_context(&m_pCodecCtx);
+            this->RemoveFiles();
+        }
+
+        void RemoveFiles()
+        {
+            std::error_code errCode;
+            std::filesystem::remove(m_szRingPath, errCode);
+            std::filesystem::remove(m_szRingPath + ".prev", errCode);
+            std::filesystem::remove(m_szRingPath + ".nut", errCode);
+        }
+
+        // Store a packet of nSize bytes that are all unFill.
+        void AddPacket(BlackBoxRing& cRing, const int nSize, const uint8_t unFill, const int64_t nTimestamp, const bool bKeyframe)
+        {
+            AVPacket* pPacket = av_packet_alloc();
+            ASSERT_EQ(av_new_packet(pPacket, nSize), 0);
+            std::memset(pPacket->data, unFill, nSize);
+            pPacket->pts   = nTimestamp;
+            pPacket->dts   = nTimestamp;
+            pPacket->flags = bKeyframe ? AV_PKT_FLAG_KEY : 0;
+            cRing.AddPacket(pPacket);
+            av_packet_free(&pPacket);
+        }
+
+        // Read the whole ring file.
+        std::vector<uint8_t> ReadRingFile()
+        {
+            std::ifstream fRingFile(m_szRingPath, std::ios::binary);
+            return std::vector<uint8_t>(std::istreambuf_iterator<char>(fRingFile), std::istreambuf_iterator<char>());
+        }
+
+        std::string m_szRingPath;
+        AVCodecContext* m_pCodecCtx = nullptr;
+};
+
+/******************************************************************************
+ * @brief Check that the header, index and data are laid out the way the recovery
+ *      tool reads them.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(BlackBoxRingTest, StoresPackets)
+{
+    // Store a few packets.
+    BlackBoxRing cRing;
+    ASSERT_TRUE(cRing.Open(m_szRingPath, 8192, 16, m_pCodecCtx));
+    EXPECT_TRUE(cRing.GetIsOpen());
+    for (int nIter = 0; nIter < 4; ++nIter)
+    {
+        this->AddPacket(cRing, 100, static_cast<uint8_t>(nIter + 1), nIter * 1000, nIter == 0);
+    }
+    cRing.Close();
+    EXPECT_FALSE(cRing.GetIsOpen());
+
+    // Check the header.
+    std::vector<uint8_t> vFile = this->ReadRingFile();
+    ASSERT_EQ(vFile.size(), blackbox::BLACKBOX_HEADER_SIZE + 4096 + 8192);
+    const blackbox::FileHeader* pHeader = reinterpret_cast<const blackbox::FileHeader*>(vFile.data());
+    EXPECT_EQ(pHeader->unMagic, blackbox::BLACKBOX_MAGIC);
+    EXPECT_EQ(pHeader->unVersion, blackbox::BLACKBOX_VERSION);
+    EXPECT_EQ(pHeader->unIndexEntries, 16u);
+    EXPECT_EQ(pHeader->unDataSize, 8192u);
+    EXPECT_EQ(pHeader->nCodecID, AV_CODEC_ID_FFV1);
+    EXPECT_EQ(pHeader->nWidth, 64);
+    EXPECT_EQ(pHeader->nHeight, 48);
+    EXPECT_EQ(pHeader->unNextSequence, 4u);
+    EXPECT_EQ(pHeader->unReservedEnd, 400u);
+
+    // Check each entry and its data.
+    const blackbox::IndexEntry* pIndex = reinterpret_cast<const blackbox::IndexEntry*>(vFile.data() + blackbox::BLACKBOX_HEADER_SIZE);
+    const uint8_t* pData               = vFile.data() + blackbox::BLACKBOX_HEADER_SIZE + 4096;
+    for (int nIter = 0; nIter < 4; ++nIter)
+    {
+        EXPECT_EQ(pIndex[nIter].unSequence, static_cast<uint64_t>(nIter + 1));
+        EXPECT_EQ(pIndex[nIter].unDataPosition, static_cast<uint64_t>(nIter * 100));
+        EXPECT_EQ(pIndex[nIter].unSize, 100u);
+        EXPECT_EQ(pIndex[nIter].nPTS, nIter * 1000);
+        EXPECT_EQ(pIndex[nIter].unFlags & AV_PKT_FLAG_KEY, nIter == 0 ? static_cast<uint32_t>(AV_PKT_FLAG_KEY) : 0u);
+        EXPECT_EQ(pData[pIndex[nIter].unDataPosition], nIter + 1);
+        EXPECT_EQ(pData[pIndex[nIter].unDataPosition + 99], nIter + 1);
+    }
+    // The unused entries are still empty.
+    EXPECT_EQ(pIndex[4].unSequence, 0u);
+}
+
+/******************************************************************************
+ * @brief Check that the data ring and the index wrap around, that a packet never
+ *      straddles the end of the ring, and that the newest packets are kept.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(BlackBoxRingTest, WrapsAround)
+{
+    // Store more packets than the ring and index can hold. 4 packets fit in the data ring and the index holds 4 entries.
+    BlackBoxRing cRing;
+    ASSERT_TRUE(cRing.Open(m_szRingPath, 4096, 4, m_pCodecCtx));
+    for (int nIter = 0; nIter < 10; ++nIter)
+    {
+        this->AddPacket(cRing, 1000, static_cast<uint8_t>(nIter + 1), nIter * 1000, false);
+    }
+    // Packets bigger than the ring are ignored.
+    this->AddPacket(cRing, 5000, 0xFF, 10000, false);
+    cRing.Close();
+
+    // Each pass through the ring fits 4 packets, then skips the last 96 bytes to start again at the beginning.
+    std::vector<uint8_t> vFile          = this->ReadRingFile();
+    const blackbox::FileHeader* pHeader = reinterpret_cast<const blackbox::FileHeader*>(vFile.data());
+    EXPECT_EQ(pHeader->unNextSequence, 10u);
+    EXPECT_EQ(pHeader->unReservedEnd, 2u * 4096 + 2000);
+
+    // The index only has the newest 4 packets, each in the slot for its sequence number.
+    const blackbox::IndexEntry* pIndex = reinterpret_cast<const blackbox::IndexEntry*>(vFile.data() + blackbox::BLACKBOX_HEADER_SIZE);
+    const uint8_t* pData               = vFile.data() + blackbox::BLACKBOX_HEADER_SIZE + 4096;
+    for (uint64_t unSequence = 6; unSequence < 10; ++unSequence)
+    {
+        const blackbox::IndexEntry& stEntry = pIndex[unSequence % 4];
+        EXPECT_EQ(stEntry.unSequence, unSequence + 1);
+        EXPECT_LE(stEntry.unDataPosition % 4096 + stEntry.unSize, 4096u);
+        EXPECT_EQ(stEntry.nPTS, static_cast<int64_t>(unSequence * 1000));
+    }
+    // The last two packets are at the start of the third pass and still intact.
+    EXPECT_EQ(pIndex[8 % 4].unDataPosition, 2u * 4096);
+    EXPECT_EQ(pIndex[9 % 4].unDataPosition, 2u * 4096 + 1000);
+    EXPECT_EQ(pData[0], 9);
+    EXPECT_EQ(pData[999], 9);
+    EXPECT_EQ(pData[1000], 10);
+    EXPECT_EQ(pData[1999], 10);
+}
+
+/******************************************************************************
+ * @brief Check that opening a ring keeps the file from the previous run.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(BlackBoxRingTest, KeepsPreviousRun)
+{
+    // Write a ring, then open a new one at the same path.
+    BlackBoxRing cRing;
+    ASSERT_TRUE(cRing.Open(m_szRingPath, 4096, 4, m_pCodecCtx));
+    this->AddPacket(cRing, 100, 1, 0, true);
+    cRing.Close();
+    ASSERT_TRUE(cRing.Open(m_szRingPath, 4096, 4, m_pCodecCtx));
+    cRing.Close();
+
+    // The old ring is kept as .prev and still has its packet.
+    ASSERT_TRUE(std::filesystem::exists(m_szRingPath + ".prev"));
+    std::ifstream fPrevFile(m_szRingPath + ".prev", std::ios::binary);
+    std::vector<uint8_t> vFile((std::istreambuf_iterator<char>(fPrevFile)), std::istreambuf_iterator<char>());
+    ASSERT_GE(vFile.size(), blackbox::BLACKBOX_HEADER_SIZE);
+    EXPECT_EQ(reinterpret_cast<const blackbox::FileHeader*>(vFile.data())->unNextSequence, 1u);
+    // The new ring starts out empty.
+    EXPECT_EQ(reinterpret_cast<const blackbox::FileHeader*>(this->ReadRingFile().data())->unNextSequence, 0u);
+}
+
+/******************************************************************************
+ * @brief Check that recovery writes only the packets that weren't overwritten,
+ *      starting on a keyframe, and that a torn entry is skipped.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(BlackBoxRingTest, RecoversIntactPackets)
+{
+    // Store 10 packets. Only the last 4 are still in the data ring, and the first of those is a keyframe.
+    BlackBoxRing cRing;
+    ASSERT_TRUE(cRing.Open(m_szRingPath, 4096, 64, m_pCodecCtx));
+    for (int nIter = 0; nIter < 10; ++nIter)
+    {
+        this->AddPacket(cRing, 1000, static_cast<uint8_t>(nIter + 1), nIter * 1000, nIter % 6 == 0);
+    }
+    cRing.Close();
+
+    // Tear the newest entry, like a crash in the middle of writing it.
+    {
+        std::fstream fRingFile(m_szRingPath, std::ios::binary | std::ios::in | std::ios::out);
+        uint64_t unTornSequence = 0;
+        fRingFile.seekp(blackbox::BLACKBOX_HEADER_SIZE + 9 * sizeof(blackbox::IndexEntry) + offsetof(blackbox::IndexEntry, unSequence));
+        fRingFile.write(reinterpret_cast<const char*>(&unTornSequence), sizeof(unTornSequence));
+    }
+
+    // Recover the ring.
+    std::string szOutputPath = m_szRingPath + ".nut";
+    ASSERT_EQ(tools::RecoverBlackBox(m_szRingPath, szOutputPath, 0), 0);
+
+    // Read the recovered packets back.
+    AVFormatContext* pFormatCtx = nullptr;
+    ASSERT_EQ(avformat_open_input(&pFormatCtx, szOutputPath.c_str(), nullptr, nullptr), 0);
+    std::vector<uint8_t> vPacketFills;
+    AVPacket* pPacket = av_packet_alloc();
+    while (av_read_frame(pFormatCtx, pPacket) >= 0)
+    {
+        EXPECT_EQ(pPacket->size, 1000);
+        EXPECT_EQ(pPacket->data[0], pPacket->data[pPacket->size - 1]);
+        vPacketFills.push_back(pPacket->data[0]);
+        av_packet_unref(pPacket);
+    }
+    av_packet_free(&pPacket);
+    avformat_close_input(&pFormatCtx);
+
+    // Packets 7 to 9 survive. Packet 10 was torn, and everything before 7 was overwritten.
+    EXPECT_EQ(vPacketFills, (std::vector<uint8_t>{7, 8, 9}));
+}
+
+/******************************************************************************
+ * @brief Check that recovery refuses a file that isn't a ring file.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(BlackBoxRingTest, RejectsInvalidFile)
+{
+    // Write a file full of zeros.
+    {
+        std::ofstream fRingFile(m_szRingPath, std::ios::binary);
+        std::vector<char> vZeros(3 * 4096, 0);
+        fRingFile.write(vZeros.data(), vZeros.size());
+    }
+
+    // Recovery fails without writing anything.
+    EXPECT_EQ(tools::RecoverBlackBox(m_szRingPath, m_szRingPath + ".nut", 0), 1);
+    EXPECT_FALSE(std::filesystem::exists(m_szRingPath + ".nut"));
+}
@@ -0,0 +1,178 @@
+/******************************************************************************
+ * @brief Unit tests for the FrameIndexWriter class.
+ *
+ * @file FrameIndexWriter.cc
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../../../../../src/vision/recorders/FrameIndexWriter.h"
+
+/// \cond
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Test fixture that gives each test a fresh index file path.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+class FrameIndexWriterTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override
+        {
+            // Pick an index file path for this test.
+            m_szIndexPath = (std::filesystem::temp_directory_path() / (std::string("FrameIndexWriterTest_") +
+                                                                      ::testing::UnitTest::GetInstance()->current_test_info()->name() +
+                                                                      frameindex::FRAMEINDEX_EXTENSION))
+                                .string();
+            std::error_code errCode;
+            std::filesystem::remove(m_szIndexPath, errCode);
+        }
+
+        void TearDown() override
+        {
+            std::error_code errCode;
+            std::filesystem::remove(m_szIndexPath, errCode);
+        }
+
+        // Make a record with every field worked out from the frame number.
+        static frameindex::Record MakeRecord(const uint64_t unSequence)
+        {
+            frameindex::Record stRecord;
+            stRecord.nCaptureTime = 1700000000000000 + static_cast<int64_t>(unSequence) * 33333;
+            stRecord.nPTS         = static_cast<int64_t>(unSequence) * 3000;
+            stRecord.unSequence   = unSequence;
+            stRecord.unFileOffset = unSequence * 4096 + 17;
+            stRecord.unSize       = static_cast<uint32_t>(1000 + unSequence);
+            stRecord.unFlags      = unSequence % 30 == 0 ? 1 : 0;
+            return stRecord;
+        }
+
+        // Read the whole index file.
+        std::vector<uint8_t> ReadIndexFile()
+        {
+            std::ifstream fIndexFile(m_szIndexPath, std::ios::binary);
+            return std::vector<uint8_t>(std::istreambuf_iterator<char>(fIndexFile), std::istreambuf_iterator<char>());
+        }
+
+        std::string m_szIndexPath;
+};
+
+/******************************************************************************
+ * @brief Check that records read back exactly as they were written, across
+ *      several batches and a partial last batch.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(FrameIndexWriterTest, RoundTrip)
+{
+    // Write a bit more than two batches of records.
+    const uint64_t unTotalRecords = 2 * frameindex::FRAMEINDEX_WRITE_BATCH + 5;
+    FrameIndexWriter cWriter;
+    ASSERT_TRUE(cWriter.Open(m_szIndexPath, 1, 90000, 2));
+    EXPECT_TRUE(cWriter.GetIsOpen());
+    for (uint64_t unIter = 0; unIter < unTotalRecords; ++unIter)
+    {
+        cWriter.AddRecord(MakeRecord(unIter));
+    }
+    cWriter.Close();
+    EXPECT_FALSE(cWriter.GetIsOpen());
+
+    // Check the header.
+    std::vector<uint8_t> vFile = this->ReadIndexFile();
+    ASSERT_EQ(vFile.size(), sizeof(frameindex::FileHeader) + unTotalRecords * sizeof(frameindex::Record));
+    frameindex::FileHeader stHeader;
+    std::memcpy(&stHeader, vFile.data(), sizeof(stHeader));
+    EXPECT_EQ(stHeader.unMagic, frameindex::FRAMEINDEX_MAGIC);
+    EXPECT_EQ(stHeader.unVersion, frameindex::FRAMEINDEX_VERSION);
+    EXPECT_EQ(stHeader.unRecordSize, sizeof(frameindex::Record));
+    EXPECT_EQ(stHeader.nTimeBaseNum, 1);
+    EXPECT_EQ(stHeader.nTimeBaseDen, 90000);
+    EXPECT_EQ(stHeader.nStreamIndex, 2);
+    EXPECT_EQ(stHeader.unReserved, 0u);
+
+    // Check every record.
+    for (uint64_t unIter = 0; unIter < unTotalRecords; ++unIter)
+    {
+        frameindex::Record stRecord;
+        std::memcpy(&stRecord, vFile.data() + sizeof(frameindex::FileHeader) + unIter * sizeof(frameindex::Record), sizeof(stRecord));
+        frameindex::Record stExpected = MakeRecord(unIter);
+        EXPECT_EQ(stRecord.nCaptureTime, stExpected.nCaptureTime);
+        EXPECT_EQ(stRecord.nPTS, stExpected.nPTS);
+        EXPECT_EQ(stRecord.unSequence, stExpected.unSequence);
+        EXPECT_EQ(stRecord.unFileOffset, stExpected.unFileOffset);
+        EXPECT_EQ(stRecord.unSize, stExpected.unSize);
+        EXPECT_EQ(stRecord.unFlags, stExpected.unFlags);
+    }
+}
+
+/******************************************************************************
+ * @brief Check that records are only written once a full batch is collected, or
+ *      when flushed.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(FrameIndexWriterTest, WritesInBatches)
+{
+    // Add one record less than a batch. Only the header is in the file.
+    FrameIndexWriter cWriter;
+    ASSERT_TRUE(cWriter.Open(m_szIndexPath, 1, 1000000, 0));
+    for (uint64_t unIter = 0; unIter < frameindex::FRAMEINDEX_WRITE_BATCH - 1; ++unIter)
+    {
+        cWriter.AddRecord(MakeRecord(unIter));
+    }
+    EXPECT_EQ(this->ReadIndexFile().size(), sizeof(frameindex::FileHeader));
+
+    // Finishing the batch writes it.
+    cWriter.AddRecord(MakeRecord(frameindex::FRAMEINDEX_WRITE_BATCH - 1));
+    EXPECT_EQ(this->ReadIndexFile().size(), sizeof(frameindex::FileHeader) + frameindex::FRAMEINDEX_WRITE_BATCH * sizeof(frameindex::Record));
+
+    // A flush writes a partial batch.
+    cWriter.AddRecord(MakeRecord(frameindex::FRAMEINDEX_WRITE_BATCH));
+    cWriter.Flush();
+    EXPECT_EQ(this->ReadIndexFile().size(), sizeof(frameindex::FileHeader) + (frameindex::FRAMEINDEX_WRITE_BATCH + 1) * sizeof(frameindex::Record));
+}
+
+/******************************************************************************
+ * @brief Check that opening a new index replaces the old one, and that records
+ *      added while closed are ignored.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+TEST_F(FrameIndexWriterTest, ReopenStartsOver)
+{
+    // Write a few records, then open the same path again.
+    FrameIndexWriter cWriter;
+    ASSERT_TRUE(cWriter.Open(m_szIndexPath, 1, 1000000, 0));
+    for (uint64_t unIter = 0; unIter < 10; ++unIter)
+    {
+        cWriter.AddRecord(MakeRecord(unIter));
+    }
+    ASSERT_TRUE(cWriter.Open(m_szIndexPath, 1, 1000000, 0));
+    cWriter.AddRecord(MakeRecord(42));
+    cWriter.Close();
+    // Nothing is written once the index is closed.
+    cWriter.AddRecord(MakeRecord(43));
+    cWriter.Flush();
+
+    // Only the record added after reopening is in the file.
+    std::vector<uint8_t> vFile = this->ReadIndexFile();
+    ASSERT_EQ(vFile.size(), sizeof(frameindex::FileHeader) + sizeof(frameindex::Record));
+    frameindex::Record stRecord;
+    std::memcpy(&stRecord, vFile.data() + sizeof(frameindex::FileHeader), sizeof(stRecord));
+    EXPECT_EQ(stRecord.unSequence, 42u);
+}
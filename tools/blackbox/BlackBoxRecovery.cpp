@@ -0,0 +1,203 @@
+/******************************************************************************
+ * @brief Implements the offline black box recovery tool. Reads a ring file left
+ *      by a BlackBoxRing, usually after a crash, and writes the last seconds of
+ *      video it holds to a normal video file.
+ *
+ *      Run with: ./RoveSoCameraServer --recover-blackbox <ring file> <output.mkv> [seconds]
+ *
+ * @file BlackBoxRecovery.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "BlackBoxRecovery.h"
+#include "../../src/vision/recorders/BlackBoxRing.h"
+
+/// \cond
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+}
+
+/// \endcond
+
+namespace tools
+{
+    /******************************************************************************
+     * @brief Write the packets that are still intact in a black box ring file to a
+     *      video file. Only entries whose sequence number was committed and whose data
+     *      hasn't been overwritten since are used, so a ring from a crashed run is safe
+     *      to read. The output starts on a keyframe.
+     *
+     * @param szRingPath - The ring file to read.
+     * @param szOutputPath - The video file to write. The container is picked from the extension.
+     * @param nSeconds - The number of seconds to recover, counting back from the newest packet. 0 recovers everything.
+     * @return int - 0 if the video was written, 1 otherwise.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    int RecoverBlackBox(const std::string& szRingPath, const std::string& szOutputPath, const int nSeconds)
+    {
+        // Open and map the ring file.
+        int nFileDescriptor = ::open(szRingPath.c_str(), O_RDONLY | O_CLOEXEC);
+        struct stat stFileStatus;
+        if (nFileDescriptor < 0 || ::fstat(nFileDescriptor, &stFileStatus) != 0 || static_cast<size_t>(stFileStatus.st_size) < blackbox::BLACKBOX_HEADER_SIZE)
+        {
+            std::cerr << "Could not open black box ring file " << szRingPath << std::endl;
+            if (nFileDescriptor >= 0)
+            {
+                ::close(nFileDescriptor);
+            }
+            return 1;
+        }
+        size_t siMappingSize = static_cast<size_t>(stFileStatus.st_size);
+        void* pMapping       = ::mmap(nullptr, siMappingSize, PROT_READ, MAP_PRIVATE, nFileDescriptor, 0);
+        ::close(nFileDescriptor);
+        if (pMapping == MAP_FAILED)
+        {
+            std::cerr << "Could not map black box ring file " << szRingPath << std::endl;
+            return 1;
+        }
+        const uint8_t* pFile                = static_cast<const uint8_t*>(pMapping);
+        const blackbox::FileHeader* pHeader = reinterpret_cast<const blackbox::FileHeader*>(pFile);
+
+        // Check that this is a ring file we understand and that its layout fits in the file.
+        size_t siIndexSize = (static_cast<size_t>(pHeader->unIndexEntries) * sizeof(blackbox::IndexEntry) + 4095) / 4096 * 4096;
+        if (pHeader->unMagic != blackbox::BLACKBOX_MAGIC || pHeader->unVersion != blackbox::BLACKBOX_VERSION || pHeader->unIndexEntries == 0 ||
+            pHeader->unDataSize == 0 || pHeader->unExtradataSize > blackbox::BLACKBOX_MAX_EXTRADATA_SIZE ||
+            blackbox::BLACKBOX_HEADER_SIZE + siIndexSize + pHeader->unDataSize > siMappingSize)
+        {
+            std::cerr << szRingPath << " is not a valid black box ring file." << std::endl;
+            ::munmap(pMapping, siMappingSize);
+            return 1;
+        }
+        const blackbox::IndexEntry* pIndex = reinterpret_cast<const blackbox::IndexEntry*>(pFile + blackbox::BLACKBOX_HEADER_SIZE);
+        const uint8_t* pData               = pFile + blackbox::BLACKBOX_HEADER_SIZE + siIndexSize;
+        uint64_t unNextSequence            = pHeader->unNextSequence;
+        uint64_t unReservedEnd             = pHeader->unReservedEnd;
+
+        // Collect every committed entry whose data is still in the ring.
+        std::vector<blackbox::IndexEntry> vEntries;
+        for (uint32_t unIter = 0; unIter < pHeader->unIndexEntries; ++unIter)
+        {
+            blackbox::IndexEntry stEntry = pIndex[unIter];
+            // Check if the entry was committed, and is the newest one stored in this slot.
+            if (stEntry.unSequence == 0 || stEntry.unSequence > unNextSequence || unNextSequence - stEntry.unSequence >= pHeader->unIndexEntries ||
+                (stEntry.unSequence - 1) % pHeader->unIndexEntries != unIter)
+            {
+                continue;
+            }
+            // Check if the data was overwritten by newer packets.
+            if (stEntry.unSize == 0 || stEntry.unDataPosition + stEntry.unSize > unReservedEnd || unReservedEnd - stEntry.unDataPosition > pHeader->unDataSize ||
+                stEntry.unDataPosition % pHeader->unDataSize + stEntry.unSize > pHeader->unDataSize)
+            {
+                continue;
+            }
+            vEntries.push_back(stEntry);
+        }
+        std::sort(vEntries.begin(),
+                  vEntries.end(),
+                  [](const blackbox::IndexEntry& stA, const blackbox::IndexEntry& stB) { return stA.unSequence < stB.unSequence; });
+
+        // Only keep the last few seconds if asked.
+        AVRational stTimeBase = {pHeader->nTimeBaseNum, pHeader->nTimeBaseDen};
+        if (nSeconds > 0 && !vEntries.empty() && stTimeBase.num > 0 && stTimeBase.den > 0)
+        {
+            int64_t nNewestTimestamp = vEntries.back().nPTS;
+            for (const blackbox::IndexEntry& stEntry : vEntries)
+            {
+                nNewestTimestamp = std::max(nNewestTimestamp, stEntry.nPTS);
+            }
+            int64_t nCutoffTimestamp = nNewestTimestamp - av_rescale_q(nSeconds, AVRational{1, 1}, stTimeBase);
+            vEntries.erase(std::remove_if(vEntries.begin(),
+                                          vEntries.end(),
+                                          [nCutoffTimestamp](const blackbox::IndexEntry& stEntry) { return stEntry.nPTS < nCutoffTimestamp; }),
+                           vEntries.end());
+        }
+
+        // Start on a keyframe so the output can be decoded.
+        std::vector<blackbox::IndexEntry>::iterator itFirstKeyframe =
+            std::find_if(vEntries.begin(), vEntries.end(), [](const blackbox::IndexEntry& stEntry) { return stEntry.unFlags & AV_PKT_FLAG_KEY; });
+        vEntries.erase(vEntries.begin(), itFirstKeyframe);
+        if (vEntries.empty())
+        {
+            std::cerr << "No recoverable video starting on a keyframe in " << szRingPath << std::endl;
+            ::munmap(pMapping, siMappingSize);
+            return 1;
+        }
+
+        // Set up the output file.
+        AVFormatContext* pFormatCtx = nullptr;
+        AVStream* pStream           = nullptr;
+        if (avformat_alloc_output_context2(&pFormatCtx, nullptr, nullptr, szOutputPath.c_str()) < 0 || !pFormatCtx ||
+            !(pStream = avformat_new_stream(pFormatCtx, nullptr)))
+        {
+            std::cerr << "Could not create output file " << szOutputPath << std::endl;
+            avformat_free_context(pFormatCtx);
+            ::munmap(pMapping, siMappingSize);
+            return 1;
+        }
+        pStream->time_base                = stTimeBase;
+        pStream->codecpar->codec_type     = AVMEDIA_TYPE_VIDEO;
+        pStream->codecpar->codec_id       = static_cast<AVCodecID>(pHeader->nCodecID);
+        pStream->codecpar->width          = pHeader->nWidth;
+        pStream->codecpar->height         = pHeader->nHeight;
+        pStream->codecpar->extradata_size = pHeader->unExtradataSize;
+        pStream->codecpar->extradata      = static_cast<uint8_t*>(av_mallocz(pHeader->unExtradataSize + AV_INPUT_BUFFER_PADDING_SIZE));
+        std::memcpy(pStream->codecpar->extradata, pHeader->aExtradata, pHeader->unExtradataSize);
+        if (avio_open(&pFormatCtx->pb, szOutputPath.c_str(), AVIO_FLAG_WRITE) < 0 || avformat_write_header(pFormatCtx, nullptr) < 0)
+        {
+            std::cerr << "Could not write output file " << szOutputPath << std::endl;
+            avio_closep(&pFormatCtx->pb);
+            avformat_free_context(pFormatCtx);
+            ::munmap(pMapping, siMappingSize);
+            return 1;
+        }
+
+        // Write the packets, starting the output at zero.
+        int64_t nStartTimestamp = vEntries.front().nDTS;
+        AVPacket* pPacket       = av_packet_alloc();
+        for (const blackbox::IndexEntry& stEntry : vEntries)
+        {
+            // Copy the packet out of the ring.
+            if (av_new_packet(pPacket, stEntry.unSize) < 0)
+            {
+                break;
+            }
+            std::memcpy(pPacket->data, pData + stEntry.unDataPosition % pHeader->unDataSize, stEntry.unSize);
+            pPacket->pts          = stEntry.nPTS - nStartTimestamp;
+            pPacket->dts          = stEntry.nDTS - nStartTimestamp;
+            pPacket->flags        = stEntry.unFlags;
+            pPacket->stream_index = pStream->index;
+            av_packet_rescale_ts(pPacket, stTimeBase, pStream->time_base);
+            av_interleaved_write_frame(pFormatCtx, pPacket);
+            av_packet_unref(pPacket);
+        }
+
+        // Finish the output file and clean up.
+        av_write_trailer(pFormatCtx);
+        avio_closep(&pFormatCtx->pb);
+        avformat_free_context(pFormatCtx);
+        av_packet_free(&pPacket);
+        ::munmap(pMapping, siMappingSize);
+
+        // Print a summary.
+        double dRecoveredSeconds = (vEntries.back().nPTS - vEntries.front().nPTS) * av_q2d(stTimeBase);
+        std::cout << "Recovered " << vEntries.size() << " packets (" << dRecoveredSeconds << " seconds) from " << szRingPath << " to " << szOutputPath << std::endl;
+
+        return 0;
+    }
+}    // namespace tools
@@ -0,0 +1,31 @@
+/******************************************************************************
+ * @brief Defines the offline black box recovery tool.
+ *
+ * @file BlackBoxRecovery.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef BLACK_BOX_RECOVERY_H
+#define BLACK_BOX_RECOVERY_H
+
+/// \cond
+#include <string>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Namespace containing the offline tools that are run as a mode of the
+ *      server instead of starting it.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+namespace tools
+{
+    int RecoverBlackBox(const std::string& szRingPath, const std::string& szOutputPath, const int nSeconds);
+}    // namespace tools
+
+#endif    // BLACK_BOX_RECOVERY_H
@@ -0,0 +1,172 @@
+/******************************************************************************
+ * @brief Implements the offline recording encode benchmark. Records the same
+ *      synthetic frames once with cv::VideoWriter, the way recordings were written
+ *      before, and once with the libav recording muxer, the way CameraRecorder writes
+ *      them now, then prints the CPU time each one took per frame. This gives the
+ *      before and after CPU cost of one recorded camera without any cameras attached.
+ *
+ *      Run with: ./RoveSoCameraServer --benchmark-encode <output directory> [width] [height] [frames]
+ *      The defaults are 1280x720 and 300 frames. Both files are left in the output directory.
+ *
+ * @file EncodeBenchmark.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "EncodeBenchmark.h"
+#include "../../src/RoveSoCameraServerConstants.h"
+#include "../../src/RoveSoCameraServerLogging.h"
+#include "../../src/vision/recorders/FFmpegRecordingMuxer.h"
+
+/// \cond
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <opencv2/opencv.hpp>
+#include <time.h>
+#include <vector>
+
+/// \endcond
+
+namespace tools
+{
+    /******************************************************************************
+     * @brief Get the CPU time used by every thread of this process. Encoders may run
+     *      worker threads, so the time of the calling thread alone would miss them.
+     *
+     * @return double - The CPU time in seconds.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    static double GetProcessCPUSeconds()
+    {
+        timespec stTime;
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &stTime);
+        return static_cast<double>(stTime.tv_sec) + static_cast<double>(stTime.tv_nsec) / 1e9;
+    }
+
+    /******************************************************************************
+     * @brief Print the CPU cost of one encode run.
+     *
+     * @param szName - The name of the encode path.
+     * @param dCPUSeconds - The CPU time the run took.
+     * @param dWallSeconds - The wall time the run took.
+     * @param nFrames - The number of frames encoded.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    static void PrintResult(const std::string& szName, const double dCPUSeconds, const double dWallSeconds, const int nFrames)
+    {
+        // A camera is recorded at RECORDER_FPS, so that's how many frames one core has to encode each second.
+        double dCPUMillisecondsPerFrame = 1000.0 * dCPUSeconds / nFrames;
+        std::cout << std::fixed << std::setprecision(2) << szName << ": " << dCPUMillisecondsPerFrame << " ms CPU per frame, "
+                  << dCPUMillisecondsPerFrame * constants::RECORDER_FPS / 10.0 << "% of one core at " << constants::RECORDER_FPS << " FPS (" << dCPUSeconds
+                  << " s CPU, " << dWallSeconds << " s wall)" << std::endl;
+    }
+
+    /******************************************************************************
+     * @brief Encode the same synthetic frames with cv::VideoWriter and with the libav
+     *      recording muxer, and print the CPU time of each.
+     *
+     *      The cv::VideoWriter run opens the writer the way RecordingHandler used to, with
+     *      an H264 fourcc and RECORDER_FPS, and is given BGR frames. The muxer run uses the
+     *      RECORDER_* encoder settings and is given YUV 4:2:0 frames. The BGR to YUV
+     *      conversion the camera does for recorders is timed as part of the muxer run, so
+     *      both runs start from the same BGR frame.
+     *
+     * @param szOutputDirectory - The directory to write the two benchmark recordings to.
+     * @param nWidth - The width of the synthetic frames. Must be even.
+     * @param nHeight - The height of the synthetic frames. Must be even.
+     * @param nFrames - The number of frames to encode in each run.
+     * @return int - 0 if both runs finished, 1 otherwise.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    int BenchmarkEncode(const std::string& szOutputDirectory, const int nWidth, const int nHeight, const int nFrames)
+    {
+        // Check the arguments.
+        if (nWidth <= 0 || nHeight <= 0 || nWidth % 2 != 0 || nHeight % 2 != 0 || nFrames <= 0)
+        {
+            std::cerr << "The width and height must be even and positive, and at least one frame must be encoded." << std::endl;
+            return 1;
+        }
+        std::error_code errCode;
+        std::filesystem::create_directories(szOutputDirectory, errCode);
+
+        // The muxer logs through the shared logger.
+        logging::InitializeLoggers(constants::LOGGING_OUTPUT_PATH_ABSOLUTE);
+
+        // Make a blurred noise image a bit wider than the frame, and pan across it so every frame has texture and motion to encode.
+        // The frames are made before either run so the time to make them isn't counted.
+        const int nPanWidth = 64;
+        cv::Mat cvScene(nHeight, nWidth + nPanWidth, CV_8UC3);
+        cv::RNG cvRNG(42);
+        cvRNG.fill(cvScene, cv::RNG::UNIFORM, 0, 256);
+        cv::GaussianBlur(cvScene, cvScene, cv::Size(9, 9), 0.0);
+        std::vector<cv::Mat> vFrames;
+        for (int nIter = 0; nIter < nPanWidth / 4; ++nIter)
+        {
+            vFrames.push_back(cvScene(cv::Rect(nIter * 4, 0, nWidth, nHeight)).clone());
+        }
+        std::cout << "Encoding " << nFrames << " synthetic " << nWidth << "x" << nHeight << " frames with each encode path." << std::endl;
+
+        // Record the frames with cv::VideoWriter.
+        std::filesystem::path szVideoWriterPath = std::filesystem::path(szOutputDirectory) / "benchmark_videowriter.mkv";
+        cv::VideoWriter cvVideoWriter;
+        std::chrono::steady_clock::time_point tmStartTime = std::chrono::steady_clock::now();
+        double dStartCPUSeconds                           = GetProcessCPUSeconds();
+        if (!cvVideoWriter.open(szVideoWriterPath.string(), cv::VideoWriter::fourcc('H', '2', '6', '4'), constants::RECORDER_FPS, cv::Size(nWidth, nHeight)))
+        {
+            std::cerr << "Could not open cv::VideoWriter for " << szVideoWriterPath.string() << std::endl;
+            return 1;
+        }
+        for (int nIter = 0; nIter < nFrames; ++nIter)
+        {
+            cvVideoWriter.write(vFrames[nIter % vFrames.size()]);
+        }
+        cvVideoWriter.release();
+        PrintResult("cv::VideoWriter",
+                    GetProcessCPUSeconds() - dStartCPUSeconds,
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStartTime).count(),
+                    nFrames);
+
+        // Record the frames with the libav recording muxer.
+        std::filesystem::path szMuxerPath = std::filesystem::path(szOutputDirectory) / "benchmark_muxer.mkv";
+        FFmpegRecordingMuxer::EncoderSettings stEncoderSettings{constants::RECORDER_CODEC,
+                                                                constants::RECORDER_PRESET,
+                                                                constants::RECORDER_CRF,
+                                                                constants::RECORDER_BITRATE,
+                                                                constants::RECORDER_ENCODER_THREADS,
+                                                                constants::RECORDER_FPS,
+                                                                constants::RECORDER_GOP_SIZE};
+        FFmpegRecordingMuxer FFmpegMuxer;
+        cv::Mat cvYUVFrame;
+        std::chrono::system_clock::time_point tmCaptureTime = std::chrono::system_clock::now();
+        tmStartTime                                         = std::chrono::steady_clock::now();
+        dStartCPUSeconds                                    = GetProcessCPUSeconds();
+        if (!FFmpegMuxer.Open(szMuxerPath.string(), cv::Size(nWidth, nHeight), stEncoderSettings))
+        {
+            std::cerr << "Could not open the recording muxer for " << szMuxerPath.string() << std::endl;
+            return 1;
+        }
+        for (int nIter = 0; nIter < nFrames; ++nIter)
+        {
+            // Convert the frame the way the camera does for recorders, and space the frames out as if they were captured at RECORDER_FPS.
+            cv::cvtColor(vFrames[nIter % vFrames.size()], cvYUVFrame, cv::COLOR_BGR2YUV_I420);
+            FFmpegMuxer.WriteFrame(cvYUVFrame, PIXEL_FORMATS::eYUV420, tmCaptureTime + std::chrono::microseconds(nIter * 1000000LL / constants::RECORDER_FPS));
+        }
+        FFmpegMuxer.Close();
+        PrintResult("FFmpegRecordingMuxer",
+                    GetProcessCPUSeconds() - dStartCPUSeconds,
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStartTime).count(),
+                    nFrames);
+
+        return 0;
+    }
+}    // namespace tools
@@ -0,0 +1,31 @@
+/******************************************************************************
+ * @brief Defines the offline recording encode benchmark.
+ *
+ * @file EncodeBenchmark.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef ENCODE_BENCHMARK_H
+#define ENCODE_BENCHMARK_H
+
+/// \cond
+#include <string>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Namespace containing the offline tools that are run as a mode of the
+ *      server instead of starting it.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+namespace tools
+{
+    int BenchmarkEncode(const std::string& szOutputDirectory, const int nWidth, const int nHeight, const int nFrames);
+}    // namespace tools
+
+#endif    // ENCODE_BENCHMARK_H
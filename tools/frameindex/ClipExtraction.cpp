@@ -0,0 +1,197 @@
+/******************************************************************************
+ * @brief Implements the offline clip extraction tool. Uses the frame index next to
+ *      a recording to find the frames around a mission time with a binary search,
+ *      then copies them into a new file without decoding or scanning the recording.
+ *
+ *      Run with: ./RoveSoCameraServer --extract-clip <recording.mkv> <output.mkv> <start time> <seconds>
+ *      The start time is in seconds since the epoch, and may have a fraction.
+ *
+ * @file ClipExtraction.cpp
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "ClipExtraction.h"
+#include "../../src/vision/recorders/FrameIndexWriter.h"
+
+/// \cond
+#include <algorithm>
+#include <cmath>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+}
+
+/// \endcond
+
+namespace tools
+{
+    /******************************************************************************
+     * @brief Copy the frames of a recording between two capture times into a new
+     *      file. The clip starts on the last keyframe at or before the start time so it
+     *      can be decoded, and its timestamps start at zero. The recording is read from
+     *      the file position the index stores for that keyframe, so only the clip itself
+     *      is read, even if the recording was never finished.
+     *
+     * @param szRecordingPath - The recording to cut from. Its index must be next to it, named with FRAMEINDEX_EXTENSION added.
+     * @param szOutputPath - The clip file to write. The container is picked from the extension.
+     * @param dStartTime - The capture time to start the clip at, in seconds since the epoch.
+     * @param dSeconds - The length of the clip in seconds.
+     * @return int - 0 if the clip was written, 1 otherwise.
+     *
+     * @author agent (agent@local)
+     * @date 2026-10-18
+     ******************************************************************************/
+    int ExtractClip(const std::string& szRecordingPath, const std::string& szOutputPath, const double dStartTime, const double dSeconds)
+    {
+        // Open and map the index file.
+        std::string szIndexPath = szRecordingPath + frameindex::FRAMEINDEX_EXTENSION;
+        int nFileDescriptor     = ::open(szIndexPath.c_str(), O_RDONLY | O_CLOEXEC);
+        struct stat stFileStatus;
+        if (nFileDescriptor < 0 || ::fstat(nFileDescriptor, &stFileStatus) != 0 || static_cast<size_t>(stFileStatus.st_size) < sizeof(frameindex::FileHeader))
+        {
+            std::cerr << "Could not open frame index " << szIndexPath << std::endl;
+            if (nFileDescriptor >= 0)
+            {
+                ::close(nFileDescriptor);
+            }
+            return 1;
+        }
+        size_t siMappingSize = static_cast<size_t>(stFileStatus.st_size);
+        void* pMapping       = ::mmap(nullptr, siMappingSize, PROT_READ, MAP_PRIVATE, nFileDescriptor, 0);
+        ::close(nFileDescriptor);
+        if (pMapping == MAP_FAILED)
+        {
+            std::cerr << "Could not map frame index " << szIndexPath << std::endl;
+            return 1;
+        }
+        const frameindex::FileHeader* pHeader = static_cast<const frameindex::FileHeader*>(pMapping);
+        if (pHeader->unMagic != frameindex::FRAMEINDEX_MAGIC || pHeader->unVersion != frameindex::FRAMEINDEX_VERSION ||
+            pHeader->unRecordSize != sizeof(frameindex::Record) || pHeader->nTimeBaseNum <= 0 || pHeader->nTimeBaseDen <= 0)
+        {
+            std::cerr << szIndexPath << " is not a valid frame index." << std::endl;
+            ::munmap(pMapping, siMappingSize);
+            return 1;
+        }
+        // A record cut off by a crash is ignored.
+        const frameindex::Record* pFirstRecord = reinterpret_cast<const frameindex::Record*>(static_cast<const uint8_t*>(pMapping) + sizeof(frameindex::FileHeader));
+        const frameindex::Record* pEndRecord   = pFirstRecord + (siMappingSize - sizeof(frameindex::FileHeader)) / sizeof(frameindex::Record);
+
+        // Binary search for the clip. Capture times never decrease, so the records are sorted by them.
+        auto IsBeforeRecord                    = [](const int64_t nTime, const frameindex::Record& stRecord) { return nTime < stRecord.nCaptureTime; };
+        int64_t nStartTime                     = static_cast<int64_t>(std::llround(dStartTime * 1000000.0));
+        int64_t nEndTime                       = nStartTime + static_cast<int64_t>(std::llround(dSeconds * 1000000.0));
+        const frameindex::Record* pStartRecord = std::upper_bound(pFirstRecord, pEndRecord, nStartTime, IsBeforeRecord);
+        const frameindex::Record* pFinalRecord = std::upper_bound(pStartRecord, pEndRecord, nEndTime, IsBeforeRecord);
+        // Step back to the keyframe the start time falls in.
+        while (pStartRecord > pFirstRecord && (pStartRecord == pEndRecord || pStartRecord->nCaptureTime > nStartTime || !(pStartRecord->unFlags & AV_PKT_FLAG_KEY)))
+        {
+            --pStartRecord;
+        }
+        if (pStartRecord >= pFinalRecord || !(pStartRecord->unFlags & AV_PKT_FLAG_KEY))
+        {
+            std::cerr << "No frames between those times in " << szRecordingPath << std::endl;
+            ::munmap(pMapping, siMappingSize);
+            return 1;
+        }
+        frameindex::Record stStartRecord = *pStartRecord;
+        frameindex::Record stFinalRecord = *(pFinalRecord - 1);
+        AVRational stTimeBase            = {pHeader->nTimeBaseNum, pHeader->nTimeBaseDen};
+        int nInputStreamIndex            = pHeader->nStreamIndex;
+        ::munmap(pMapping, siMappingSize);
+
+        // Open the recording. Only the header is read, the stream parameters are all in it.
+        AVFormatContext* pInputCtx = nullptr;
+        if (avformat_open_input(&pInputCtx, szRecordingPath.c_str(), nullptr, nullptr) < 0 || nInputStreamIndex < 0 ||
+            nInputStreamIndex >= static_cast<int>(pInputCtx->nb_streams))
+        {
+            std::cerr << "Could not open recording " << szRecordingPath << std::endl;
+            avformat_close_input(&pInputCtx);
+            return 1;
+        }
+        AVStream* pInputStream = pInputCtx->streams[nInputStreamIndex];
+
+        // Jump straight to the start keyframe. Seeking by position works even if the recording was never finished and has no cues.
+        if (av_seek_frame(pInputCtx, nInputStreamIndex, static_cast<int64_t>(stStartRecord.unFileOffset), AVSEEK_FLAG_BYTE) < 0 &&
+            av_seek_frame(pInputCtx, nInputStreamIndex, av_rescale_q(stStartRecord.nPTS, stTimeBase, pInputStream->time_base), AVSEEK_FLAG_BACKWARD) < 0)
+        {
+            std::cerr << "Could not seek in recording " << szRecordingPath << std::endl;
+            avformat_close_input(&pInputCtx);
+            return 1;
+        }
+
+        // Set up the output file.
+        AVFormatContext* pOutputCtx = nullptr;
+        AVStream* pOutputStream     = nullptr;
+        if (avformat_alloc_output_context2(&pOutputCtx, nullptr, nullptr, szOutputPath.c_str()) < 0 || !pOutputCtx ||
+            !(pOutputStream = avformat_new_stream(pOutputCtx, nullptr)) || avcodec_parameters_copy(pOutputStream->codecpar, pInputStream->codecpar) < 0)
+        {
+            std::cerr << "Could not create output file " << szOutputPath << std::endl;
+            avformat_free_context(pOutputCtx);
+            avformat_close_input(&pInputCtx);
+            return 1;
+        }
+        pOutputStream->codecpar->codec_tag = 0;
+        pOutputStream->time_base           = pInputStream->time_base;
+        if (avio_open(&pOutputCtx->pb, szOutputPath.c_str(), AVIO_FLAG_WRITE) < 0 || avformat_write_header(pOutputCtx, nullptr) < 0)
+        {
+            std::cerr << "Could not write output file " << szOutputPath << std::endl;
+            avio_closep(&pOutputCtx->pb);
+            avformat_free_context(pOutputCtx);
+            avformat_close_input(&pInputCtx);
+            return 1;
+        }
+
+        // Copy the packets of the clip, starting the output at zero.
+        int64_t nFirstTimestamp = av_rescale_q(stStartRecord.nPTS, stTimeBase, pInputStream->time_base);
+        int64_t nLastTimestamp  = av_rescale_q(stFinalRecord.nPTS, stTimeBase, pInputStream->time_base);
+        size_t siCopiedPackets  = 0;
+        AVPacket* pPacket       = av_packet_alloc();
+        while (av_read_frame(pInputCtx, pPacket) >= 0)
+        {
+            // Check if the packet is in the clip.
+            if (pPacket->stream_index != nInputStreamIndex || pPacket->pts == AV_NOPTS_VALUE || pPacket->pts < nFirstTimestamp)
+            {
+                av_packet_unref(pPacket);
+                continue;
+            }
+            if (pPacket->pts > nLastTimestamp)
+            {
+                av_packet_unref(pPacket);
+                break;
+            }
+
+            // Write the packet.
+            pPacket->pts -= nFirstTimestamp;
+            pPacket->dts = pPacket->dts == AV_NOPTS_VALUE ? pPacket->pts : pPacket->dts - nFirstTimestamp;
+            av_packet_rescale_ts(pPacket, pInputStream->time_base, pOutputStream->time_base);
+            pPacket->stream_index = pOutputStream->index;
+            pPacket->pos          = -1;
+            av_interleaved_write_frame(pOutputCtx, pPacket);
+            ++siCopiedPackets;
+        }
+
+        // Finish the output file and clean up.
+        av_write_trailer(pOutputCtx);
+        avio_closep(&pOutputCtx->pb);
+        avformat_free_context(pOutputCtx);
+        avformat_close_input(&pInputCtx);
+        av_packet_free(&pPacket);
+
+        // Print a summary.
+        double dClipSeconds = (stFinalRecord.nCaptureTime - stStartRecord.nCaptureTime) / 1000000.0;
+        std::cout << "Copied " << siCopiedPackets << " packets (" << dClipSeconds << " seconds, frames " << stStartRecord.unSequence << " to "
+                  << stFinalRecord.unSequence << ") from " << szRecordingPath << " to " << szOutputPath << std::endl;
+
+        return siCopiedPackets > 0 ? 0 : 1;
+    }
+}    // namespace tools
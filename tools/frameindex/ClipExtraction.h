@@ -0,0 +1,31 @@
+/******************************************************************************
+ * @brief Defines the offline clip extraction tool.
+ *
+ * @file ClipExtraction.h
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef CLIP_EXTRACTION_H
+#define CLIP_EXTRACTION_H
+
+/// \cond
+#include <string>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Namespace containing the offline tools that are run as a mode of the
+ *      server instead of starting it.
+ *
+ * @author agent (agent@local)
+ * @date 2026-10-18
+ ******************************************************************************/
+namespace tools
+{
+    int ExtractClip(const std::string& szRecordingPath, const std::string& szOutputPath, const double dStartTime, const double dSeconds);
+}    // namespace tools
+
+#endif    // CLIP_EXTRACTION_H